@@ -0,0 +1 @@
+(function(a){a.extend(a.fn,{swapClass:function(e,d){var c=this.filter("."+e);this.filter("."+d).removeClass(d).addClass(e);c.removeClass(e).addClass(d);return this},replaceClass:function(d,c){return this.filter("."+d).removeClass(d).addClass(c).end()},hoverClass:function(c){c=c||"hover";return this.hover(function(){a(this).addClass(c)},function(){a(this).removeClass(c)})},heightToggle:function(c,d){c?this.animate({height:"toggle"},c,d):this.each(function(){jQuery(this)[jQuery(this).is(":hidden")?"show":"hide"]();if(d){d.apply(this,arguments)}})},heightHide:function(c,d){if(c){this.animate({height:"hide"},c,d)}else{this.hide();if(d){this.each(d)}}},prepareBranches:function(c){if(!c.prerendered){this.filter(":last-child:not(ul)").addClass(b.last);this.filter((c.collapsed?"":"."+b.closed)+":not(."+b.open+")").find(">ul").hide()}return this.filter(":has(>ul)")},applyClasses:function(c,d){this.filter(":has(>ul):not(:has(>a))").find(">span").click(function(e){d.apply(a(this).next())}).add(a("a",this)).hoverClass();if(!c.prerendered){this.filter(":has(>ul:hidden)").addClass(b.expandable).replaceClass(b.last,b.lastExpandable);this.not(":has(>ul:hidden)").addClass(b.collapsable).replaceClass(b.last,b.lastCollapsable);this.prepend('<div class="'+b.hitarea+'"/>').find("div."+b.hitarea).each(function(){var e="";a.each(a(this).parent().attr("class").split(" "),function(){e+=this+"-hitarea "});a(this).addClass(e)})}this.find("div."+b.hitarea).click(d)},setcookie:function(d,f){function e(){function i(j){return j?1:0}var h=[];d.each(function(k,l){var j=a(l);h[k]=a(l).is(":has(>ul:visible)")?1:0});a.cookie(f.cookieId,h.join(""))}function c(){var h=a.cookie(f.cookieId);if(h){var i=h.split("");d.each(function(j,k){a(k).find(">ul")[parseInt(i[j])?"show":"hide"]()})}}switch(f.persist){case"cookie":f.toggle=function(){e()};c();break;case"location":var g=this.find("a").filter(function(){return this.href.toLowerCase()==location.href.toLowerCase()});if(g.length){g.addClass("selected").parents("ul, li").add(g.next()).show()}break}},treeview:function(d){d=a.extend({cookieId:"treeview"},d);if(d.add){return this.trigger("add",[d.add])}if(d.toggle){var g=d.toggle;d.toggle=function(){return g.apply(a(this).parent()[0],arguments)}}function f(h,j){function i(k){return function(){e.apply(a("div."+b.hitarea,h).filter(function(){return k?a(this).parent("."+k).length:true}));return true}}a("a:eq(0)",j).click(i(b.collapsable));a("a:eq(1)",j).click(i(b.expandable));a("a:eq(2)",j).click(i())}function e(){a(this).parent().find(">.hitarea").swapClass(b.collapsableHitarea,b.expandableHitarea).swapClass(b.lastCollapsableHitarea,b.lastExpandableHitarea).end().swapClass(b.collapsable,b.expandable).swapClass(b.lastCollapsable,b.lastExpandable).find(">ul").heightToggle(d.animated,d.toggle);if(d.unique){a(this).parent().siblings().find(">.hitarea").replaceClass(b.collapsableHitarea,b.expandableHitarea).replaceClass(b.lastCollapsableHitarea,b.lastExpandableHitarea).end().replaceClass(b.collapsable,b.expandable).replaceClass(b.lastCollapsable,b.lastExpandable).find(">ul").heightHide(d.animated,d.toggle)}return true}this.addClass("treeview");var c=this.find("li").prepareBranches(d);this.setcookie(c,d);c.applyClasses(d,e);if(d.control){f(this,d.control);a(d.control).show()}return this.bind("add",function(i,h){a(h).prev().removeClass(b.last).removeClass(b.lastCollapsable).removeClass(b.lastExpandable).find(">.hitarea").removeClass(b.lastCollapsableHitarea).removeClass(b.lastExpandableHitarea);a(h).find("li").andSelf().prepareBranches(d).applyClasses(d,e);var j=a(h).find("li").andSelf().prepareBranches(d);a(this).setcookie(j,d)})}});var b=a.fn.treeview.classes={open:"open",closed:"closed",expandable:"expandable",expandableHitarea:"expandable-hitarea",lastExpandableHitarea:"lastExpandable-hitarea",collapsable:"collapsable",collapsableHitarea:"collapsable-hitarea",lastCollapsableHitarea:"lastCollapsable-hitarea",lastCollapsable:"lastCollapsable",lastExpandable:"lastExpandable",last:"last",hitarea:"hitarea"};a.fn.Treeview=a.fn.treeview})(jQuery);(function(c){function b(f,e,g,d){c.getJSON(f.url,{root:e},function(h){function i(k){var l=c("<li/>").attr("id",this.id||"").html("<span>"+this.text+"</span>").appendTo(k);if(this.classes){l.children("span").addClass(this.classes)}if(this.url){l.children("span").attr("data-url",this.url)}if(this.expanded){l.addClass("open")}if(this.hasChildren||this.children&&this.children.length){var j=c("<ul/>").appendTo(l);if(this.hasChildren){l.addClass("hasChildren");i.call({text:"placeholder",id:"placeholder",children:[]},j)}if(this.children&&this.children.length){c.each(this.children,i,[j])}}}c.each(h,i,[g]);c(d).treeview({add:g})})}var a=c.fn.treeview;c.fn.treeview=function(f){if(!f.url){return a.apply(this,arguments)}var d=this;b(f,"source",this,d);var e=f.toggle;return a.call(this,c.extend({},f,{collapsed:true,toggle:function(){var h=c(this);if(h.hasClass("hasChildren")){var g=h.removeClass("hasChildren").find("ul");g.empty();b(f,this.id,g,d)}if(e){e.apply(this,arguments)}}}))}})(jQuery);jQuery.cookie=function(b,k,n){if(typeof k!="undefined"){n=n||{};if(k===null){k="";n.expires=-1}var e="";if(n.expires&&(typeof n.expires=="number"||n.expires.toUTCString)){var f;if(typeof n.expires=="number"){f=new Date();f.setTime(f.getTime()+(n.expires*24*60*60*1000))}else{f=n.expires}e="; expires="+f.toUTCString()}var m=n.path?"; path="+n.path:"";var g=n.domain?"; domain="+n.domain:"";var a=n.secure?"; secure":"";var j=[b,"=",encodeURIComponent(k),e,m,g,a].join("");document.cookie=[b,"=",encodeURIComponent(k),e,m,g,a].join("")}else{var d=null;if(document.cookie&&document.cookie!=""){var l=document.cookie.split(";");for(var h=0;h<l.length;h++){var c=jQuery.trim(l[h]);if(c.substring(0,b.length+1)==(b+"=")){d=decodeURIComponent(c.substring(b.length+1));break}}}return d}};
\ No newline at end of file
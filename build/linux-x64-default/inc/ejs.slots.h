@@ -0,0 +1,2518 @@
+/*
+   ejs.slots.h -- Native property slot definitions for the "ejs" module
+  
+   This file is generated by ejsmod
+  
+   Slot definitions. Version 2.5.2.
+ */
+
+#ifndef _h_SLOTS_EjsSlots
+#define _h_SLOTS_EjsSlots 1
+
+#ifndef EJS_VERSION
+    #define EJS_VERSION "2.5.2"
+#endif
+
+/*
+   Slots for the "ejs" module 
+ */
+
+
+/*
+    Global property slots
+ */
+#define ES_stderr                                                      0
+#define ES_stdin                                                       1
+#define ES_stdout                                                      2
+#define ES_App                                                         3
+#define ES_appInit                                                     4
+#define ES_Args                                                        5
+#define ES_Array                                                       6
+#define ES_BinaryStream                                                7
+#define ES_Block                                                       8
+#define ES_Boolean                                                     9
+#define ES_ByteArray                                                   10
+#define ES_Cache                                                       11
+#define ES_Cmd                                                         12
+#define ES_gc                                                          13
+#define ES_readFile                                                    14
+#define ES_Config                                                      15
+#define ES_Date                                                        16
+#define ES_Debug                                                       17
+#define ES_breakpoint                                                  18
+#define ES_Emitter                                                     19
+#define ES_Endpoint                                                    20
+#define ES_Error                                                       21
+#define ES_ArgError                                                    22
+#define ES_ArithmeticError                                             23
+#define ES_AssertError                                                 24
+#define ES_InstructionError                                            25
+#define ES_IOError                                                     26
+#define ES_InternalError                                               27
+#define ES_MemoryError                                                 28
+#define ES_OutOfBoundsError                                            29
+#define ES_ReferenceError                                              30
+#define ES_ResourceError                                               31
+#define ES_SecurityError                                               32
+#define ES_StateError                                                  33
+#define ES_SyntaxError                                                 34
+#define ES_TypeError                                                   35
+#define ES_URIError                                                    36
+#define ES_File                                                        37
+#define ES_FileSystem                                                  38
+#define ES_Frame                                                       39
+#define ES_Function                                                    40
+#define ES_GC                                                          41
+#define ES_EJSCRIPT                                                    42
+#define ES_ejs                                                         43
+#define ES_public                                                      44
+#define ES_internal                                                    45
+#define ES_iterator                                                    46
+#define ES_boolean                                                     47
+#define ES_double                                                      48
+#define ES_num                                                         49
+#define ES_string                                                      50
+#define ES_empty                                                       51
+#define ES_false                                                       52
+#define ES_global                                                      53
+#define ES_null                                                        54
+#define ES_Infinity                                                    55
+#define ES_NegativeInfinity                                            56
+#define ES_NaN                                                         57
+#define ES_true                                                        58
+#define ES_undefined                                                   59
+#define ES_void                                                        60
+#define ES_commaProt                                                   61
+#define ES_one                                                         62
+#define ES_zero                                                        63
+#define ES_length                                                      64
+#define ES_minusOne                                                    65
+#define ES_emptySpace                                                  66
+#define ES_max                                                         67
+#define ES_min                                                         68
+#define ES_nop                                                         69
+#define ES_assert                                                      70
+#define ES_cloneBase                                                   71
+#define ES_dump                                                        72
+#define ES_dumpAll                                                     73
+#define ES_dumpDef                                                     74
+#define ES_md5                                                         75
+#define ES_blend                                                       76
+#define ES_eval                                                        77
+#define ES_hashcode                                                    78
+#define ES_isNaN                                                       79
+#define ES_isFinite                                                    80
+#define ES_load                                                        81
+#define ES_print                                                       82
+#define ES_prints                                                      83
+#define ES_printf                                                      84
+#define ES_parse                                                       85
+#define ES_parseFloat                                                  86
+#define ES_parseInt                                                    87
+#define ES_printHash                                                   88
+#define ES_instanceOf                                                  89
+#define ES_base64                                                      90
+#define ES_Http                                                        91
+#define ES_Inflector                                                   92
+#define ES_toOrdinal                                                   93
+#define ES_toPlural                                                    94
+#define ES_toSingular                                                  95
+#define ES_iterator_Iterable                                           96
+#define ES_iterator_Iterator                                           97
+#define ES_iterator_StopIteration                                      98
+#define ES_JSON                                                        99
+#define ES_deserialize                                                 100
+#define ES_serialize                                                   101
+#define ES_require                                                     102
+#define ES_Loader                                                      103
+#define ES_LocalCache                                                  104
+#define ES_Locale                                                      105
+#define ES_Logger                                                      106
+#define ES_Math                                                        107
+#define ES_Memory                                                      108
+#define ES_MprLog                                                      109
+#define ES_Namespace                                                   110
+#define ES_Null                                                        111
+#define ES_Number                                                      112
+#define ES_Object                                                      113
+#define ES_typeOf                                                      114
+#define ES_Path                                                        115
+#define ES_Promise                                                     116
+#define ES_RegExp                                                      117
+#define ES_Socket                                                      118
+#define ES_Stream                                                      119
+#define ES_String                                                      120
+#define ES_System                                                      121
+#define ES_TextStream                                                  122
+#define ES_Timer                                                       123
+#define ES_setInterval                                                 124
+#define ES_clearInterval                                               125
+#define ES_setTimeout                                                  126
+#define ES_clearTimeout                                                127
+#define ES_Type                                                        128
+#define ES_Float64Array                                                129
+#define ES_Int32Array                                                  130
+#define ES_Uint8Array                                                  131
+#define ES_Uri                                                         132
+#define ES_decodeURI                                                   133
+#define ES_decodeURIComponent                                          134
+#define ES_encodeURI                                                   135
+#define ES_encodeURIComponent                                          136
+#define ES_encodeObjects                                               137
+#define ES_Void                                                        138
+#define ES_WebSocket                                                   139
+#define ES_Worker                                                      140
+#define ES_Event                                                       141
+#define ES_ErrorEvent                                                  142
+#define ES_ejs_worker_self                                             143
+#define ES_ejs_worker_exit                                             144
+#define ES_ejs_worker_postMessage                                      145
+#define ES_ejs_worker_onerror                                          146
+#define ES_ejs_worker_onmessage                                        147
+#define ES_XML                                                         148
+#define ES_XMLHttp                                                     149
+#define ES_XMLList                                                     150
+#define ES_global_NUM_CLASS_PROP                                       151
+
+/*
+   Prototype (instance) slots for "global" type 
+ */
+#define ES_global_NUM_INSTANCE_PROP                                    0
+#define ES_global_NUM_INHERITED_PROP                                   0
+
+/*
+    Local slots for global methods 
+ */
+#define ES_readFile_path                                               0
+#define ES_readFile_encoding                                           1
+#define ES_assert_condition                                            0
+#define ES_cloneBase_klass                                             0
+#define ES_dump_args                                                   0
+#define ES_dumpAll_args                                                0
+#define ES_dumpDef_args                                                0
+#define ES_md5_str                                                     0
+#define ES_blend_dest                                                  0
+#define ES_blend_src                                                   1
+#define ES_blend_options                                               2
+#define ES_eval_script                                                 0
+#define ES_eval_cache                                                  1
+#define ES_hashcode_o                                                  0
+#define ES_isNaN_arg                                                   0
+#define ES_isFinite_arg                                                0
+#define ES_load_file                                                   0
+#define ES_load_options                                                1
+#define ES_print_args                                                  0
+#define ES_prints_args                                                 0
+#define ES_printf_fmt                                                  0
+#define ES_printf_args                                                 1
+#define ES_parse_str                                                   0
+#define ES_parse_preferredType                                         1
+#define ES_parseFloat_str                                              0
+#define ES_parseInt_str                                                0
+#define ES_parseInt_radix                                              1
+#define ES_printHash_name                                              0
+#define ES_printHash_o                                                 1
+#define ES_instanceOf_obj                                              0
+#define ES_instanceOf_target                                           1
+#define ES_base64_str                                                  0
+#define ES_toOrdinal_number                                            0
+#define ES_toPlural_word                                               0
+#define ES_toPlural_count                                              1
+#define ES_toSingular_word                                             0
+#define ES_deserialize_str                                             0
+#define ES_serialize_obj                                               0
+#define ES_serialize_options                                           1
+#define ES_require_id                                                  0
+#define ES_typeOf_o                                                    0
+#define ES_setInterval_callback                                        0
+#define ES_setInterval_delay                                           1
+#define ES_setInterval_args                                            2
+#define ES_clearInterval_timer                                         0
+#define ES_setTimeout_callback                                         0
+#define ES_setTimeout_delay                                            1
+#define ES_setTimeout_args                                             2
+#define ES_clearTimeout_timer                                          0
+#define ES_decodeURI_str                                               0
+#define ES_decodeURIComponent_str                                      0
+#define ES_encodeURI_str                                               0
+#define ES_encodeURIComponent_str                                      0
+#define ES_encodeObjects_items                                         0
+#define ES_ejs_worker_postMessage_data                                 0
+#define ES_ejs_worker_postMessage_ports                                1
+
+
+/*
+    Class property slots for the "App" type 
+ */
+#define ES_App__initializer___App_                                     0
+#define ES_App_config                                                  1
+#define ES_App_SearchSeparator                                         2
+#define ES_App__errorStream                                            3
+#define ES_App__inputStream                                            4
+#define ES_App__outputStream                                           5
+#define ES_App_defaultConfig                                           6
+#define ES_App_emitter                                                 7
+#define ES_App_log                                                     8
+#define ES_App_mprLog                                                  9
+#define ES_App_name                                                    10
+#define ES_App_cache                                                   11
+#define ES_App_started                                                 12
+#define ES_App_test                                                    13
+#define ES_App_title                                                   14
+#define ES_App_version                                                 15
+#define ES_App_args                                                    16
+#define ES_App_chdir                                                   17
+#define ES_App_createSearch                                            18
+#define ES_App_dir                                                     19
+#define ES_App_env                                                     20
+#define ES_App_exeDir                                                  21
+#define ES_App_exePath                                                 22
+#define ES_App_errorStream                                             23
+#define ES_App_exit                                                    24
+#define ES_App_getenv                                                  25
+#define ES_App_gid                                                     26
+#define ES_App_home                                                    27
+#define ES_App_inputStream                                             28
+#define ES_App_loadrc                                                  29
+#define ES_App_outputStream                                            30
+#define ES_App_pid                                                     31
+#define ES_App_putenv                                                  32
+#define ES_App_run                                                     33
+#define ES_App_search                                                  34
+#define ES_App_sleep                                                   35
+#define ES_App_uid                                                     36
+#define ES_App_getpass                                                 37
+#define ES_App_updateLog                                               38
+#define ES_App_waitForEvent                                            39
+#define ES_App_NUM_CLASS_PROP                                          40
+
+/*
+   Prototype (instance) slots for "App" type 
+ */
+#define ES_App_NUM_INSTANCE_PROP                                       0
+#define ES_App_NUM_INHERITED_PROP                                      0
+
+/*
+    Local slots for methods in type "App" 
+ */
+#define ES_App_chdir_value                                             0
+#define ES_App_createSearch_searchPath                                 0
+#define ES_App_exit_status                                             0
+#define ES_App_exit_how                                                1
+#define ES_App_exit_timeout                                            2
+#define ES_App_getenv_name                                             0
+#define ES_App_loadrc_path                                             0
+#define ES_App_loadrc_overwrite                                        1
+#define ES_App_putenv_name                                             0
+#define ES_App_putenv_value                                            1
+#define ES_App_run_timeout                                             0
+#define ES_App_run_oneEvent                                            1
+#define ES_App_sleep_delay                                             0
+#define ES_App_getpass_prompt                                          0
+#define ES_App_waitForEvent_obj                                        0
+#define ES_App_waitForEvent_events                                     1
+#define ES_App_waitForEvent_timeout                                    2
+
+
+/*
+    Class property slots for the "Args" type 
+ */
+#define ES_Args_NUM_CLASS_PROP                                         0
+
+/*
+   Prototype (instance) slots for "Args" type 
+ */
+#define ES_Args_program                                                0
+#define ES_Args_rest                                                   1
+#define ES_Args_options                                                2
+#define ES_Args_template                                               3
+#define ES_Args_validate                                               4
+#define ES_Args_validateItem                                           5
+#define ES_Args_NUM_INSTANCE_PROP                                      6
+#define ES_Args_NUM_INHERITED_PROP                                     0
+
+
+/*
+    Class property slots for the "Array" type 
+ */
+#define ES_Array_NUM_CLASS_PROP                                        0
+
+/*
+   Prototype (instance) slots for "Array" type 
+ */
+#define ES_Array_append                                                0
+#define ES_Array_clear                                                 1
+#define ES_Array_clone                                                 2
+#define ES_Array_compact                                               3
+#define ES_Array_concat                                                4
+#define ES_Array_contains                                              5
+#define ES_Array_every                                                 6
+#define ES_Array_filter                                                7
+#define ES_Array_find                                                  8
+#define ES_Array_findAll                                               9
+#define ES_Array_forEach                                               10
+#define ES_Array_iterator_get                                          11
+#define ES_Array_iterator_getValues                                    12
+#define ES_Array_indexOf                                               13
+#define ES_Array_insert                                                14
+#define ES_Array_join                                                  15
+#define ES_Array_lastIndexOf                                           16
+#define ES_Array_length                                                17
+#define ES_Array_map                                                   18
+#define ES_Array_pop                                                   19
+#define ES_Array_push                                                  20
+#define ES_Array_reduce                                                21
+#define ES_Array_reduceRight                                           22
+#define ES_Array_reject                                                23
+#define ES_Array_remove                                                24
+#define ES_Array_removeElements                                        25
+#define ES_Array_reverse                                               26
+#define ES_Array_shift                                                 27
+#define ES_Array_slice                                                 28
+#define ES_Array_some                                                  29
+#define ES_Array_sort                                                  30
+#define ES_Array_splice                                                31
+#define ES_Array_toString                                              32
+#define ES_Array_transform                                             33
+#define ES_Array_unique                                                34
+#define ES_Array_unshift                                               35
+#define ES_Array_NUM_INSTANCE_PROP                                     36
+#define ES_Array_NUM_INHERITED_PROP                                    0
+
+
+/*
+    Class property slots for the "BinaryStream" type 
+ */
+#define ES_BinaryStream__initializer___BinaryStream_                   0
+#define ES_BinaryStream_BigEndian                                      1
+#define ES_BinaryStream_LittleEndian                                   2
+#define ES_BinaryStream_NUM_CLASS_PROP                                 3
+
+/*
+   Prototype (instance) slots for "BinaryStream" type 
+ */
+#define ES_BinaryStream_inbuf                                          0
+#define ES_BinaryStream_outbuf                                         1
+#define ES_BinaryStream_nextStream                                     2
+#define ES_BinaryStream_emitter                                        3
+#define ES_BinaryStream_async                                          4
+#define ES_BinaryStream_close                                          5
+#define ES_BinaryStream_encoding                                       6
+#define ES_BinaryStream_endian                                         7
+#define ES_BinaryStream_flush                                          8
+#define ES_BinaryStream_length                                         9
+#define ES_BinaryStream_on                                             10
+#define ES_BinaryStream_read                                           11
+#define ES_BinaryStream_readBoolean                                    12
+#define ES_BinaryStream_readByte                                       13
+#define ES_BinaryStream_readDate                                       14
+#define ES_BinaryStream_readDouble                                     15
+#define ES_BinaryStream_readInteger                                    16
+#define ES_BinaryStream_readLong                                       17
+#define ES_BinaryStream_readString                                     18
+#define ES_BinaryStream_readXML                                        19
+#define ES_BinaryStream_off                                            20
+#define ES_BinaryStream_room                                           21
+#define ES_BinaryStream_write                                          22
+#define ES_BinaryStream_writeByte                                      23
+#define ES_BinaryStream_writeShort                                     24
+#define ES_BinaryStream_writeDouble                                    25
+#define ES_BinaryStream_writeInteger                                   26
+#define ES_BinaryStream_writeLong                                      27
+#define ES_BinaryStream_NUM_INSTANCE_PROP                              28
+#define ES_BinaryStream_NUM_INHERITED_PROP                             0
+
+
+/*
+    Class property slots for the "Block" type 
+ */
+#define ES_Block_NUM_CLASS_PROP                                        0
+
+/*
+   Prototype (instance) slots for "Block" type 
+ */
+#define ES_Block_NUM_INSTANCE_PROP                                     0
+#define ES_Block_NUM_INHERITED_PROP                                    0
+
+
+/*
+    Class property slots for the "Boolean" type 
+ */
+#define ES_Boolean_NUM_CLASS_PROP                                      0
+
+/*
+   Prototype (instance) slots for "Boolean" type 
+ */
+#define ES_Boolean_NUM_INSTANCE_PROP                                   0
+#define ES_Boolean_NUM_INHERITED_PROP                                  0
+
+
+/*
+    Class property slots for the "ByteArray" type 
+ */
+#define ES_ByteArray__initializer___ByteArray_                         0
+#define ES_ByteArray_LittleEndian                                      1
+#define ES_ByteArray_BigEndian                                         2
+#define ES_ByteArray_NUM_CLASS_PROP                                    3
+
+/*
+   Prototype (instance) slots for "ByteArray" type 
+ */
+#define ES_ByteArray_async                                             0
+#define ES_ByteArray_close                                             1
+#define ES_ByteArray_compact                                           2
+#define ES_ByteArray_copyIn                                            3
+#define ES_ByteArray_copyOut                                           4
+#define ES_ByteArray_encoding                                          5
+#define ES_ByteArray_endian                                            6
+#define ES_ByteArray_flush                                             7
+#define ES_ByteArray_resizable                                         8
+#define ES_ByteArray_iterator_get                                      9
+#define ES_ByteArray_iterator_getValues                                10
+#define ES_ByteArray_length                                            11
+#define ES_ByteArray_MD5                                               12
+#define ES_ByteArray_off                                               13
+#define ES_ByteArray_on                                                14
+#define ES_ByteArray_read                                              15
+#define ES_ByteArray_readBoolean                                       16
+#define ES_ByteArray_readByte                                          17
+#define ES_ByteArray_readDate                                          18
+#define ES_ByteArray_readDouble                                        19
+#define ES_ByteArray_readInteger                                       20
+#define ES_ByteArray_readLong                                          21
+#define ES_ByteArray_readPosition                                      22
+#define ES_ByteArray_readShort                                         23
+#define ES_ByteArray_readString                                        24
+#define ES_ByteArray_readXML                                           25
+#define ES_ByteArray_reset                                             26
+#define ES_ByteArray_room                                              27
+#define ES_ByteArray_size                                              28
+#define ES_ByteArray_toString                                          29
+#define ES_ByteArray_write                                             30
+#define ES_ByteArray_writeByte                                         31
+#define ES_ByteArray_writeShort                                        32
+#define ES_ByteArray_writeDouble                                       33
+#define ES_ByteArray_writeInteger                                      34
+#define ES_ByteArray_writeLong                                         35
+#define ES_ByteArray_writePosition                                     36
+#define ES_ByteArray_NUM_INSTANCE_PROP                                 37
+#define ES_ByteArray_NUM_INHERITED_PROP                                0
+
+
+/*
+    Class property slots for the "Cache" type 
+ */
+#define ES_Cache_NUM_CLASS_PROP                                        0
+
+/*
+   Prototype (instance) slots for "Cache" type 
+ */
+#define ES_Cache_adapter                                               0
+#define ES_Cache_destroy                                               1
+#define ES_Cache_expire                                                2
+#define ES_Cache_inc                                                   3
+#define ES_Cache_limits                                                4
+#define ES_Cache_read                                                  5
+#define ES_Cache_readObj                                               6
+#define ES_Cache_remove                                                7
+#define ES_Cache_setLimits                                             8
+#define ES_Cache_write                                                 9
+#define ES_Cache_writeObj                                              10
+#define ES_Cache_NUM_INSTANCE_PROP                                     11
+#define ES_Cache_NUM_INHERITED_PROP                                    0
+
+
+/*
+    Class property slots for the "Cmd" type 
+ */
+#define ES_Cmd_locate                                                  0
+#define ES_Cmd_daemon                                                  1
+#define ES_Cmd_exec                                                    2
+#define ES_Cmd_kill                                                    3
+#define ES_Cmd_killall                                                 4
+#define ES_Cmd_ps                                                      5
+#define ES_Cmd_run                                                     6
+#define ES_Cmd_sh                                                      7
+#define ES_Cmd_NUM_CLASS_PROP                                          8
+
+/*
+   Prototype (instance) slots for "Cmd" type 
+ */
+#define ES_Cmd__response                                               0
+#define ES_Cmd__errorResponse                                          1
+#define ES_Cmd_close                                                   2
+#define ES_Cmd_env                                                     3
+#define ES_Cmd_error                                                   4
+#define ES_Cmd_errorStream                                             5
+#define ES_Cmd_finalize                                                6
+#define ES_Cmd_flush                                                   7
+#define ES_Cmd_on                                                      8
+#define ES_Cmd_off                                                     9
+#define ES_Cmd_pid                                                     10
+#define ES_Cmd_read                                                    11
+#define ES_Cmd_readString                                              12
+#define ES_Cmd_readLines                                               13
+#define ES_Cmd_readXml                                                 14
+#define ES_Cmd_response                                                15
+#define ES_Cmd_start                                                   16
+#define ES_Cmd_status                                                  17
+#define ES_Cmd_stop                                                    18
+#define ES_Cmd_timeout                                                 19
+#define ES_Cmd_wait                                                    20
+#define ES_Cmd_write                                                   21
+#define ES_Cmd_NUM_INSTANCE_PROP                                       22
+#define ES_Cmd_NUM_INHERITED_PROP                                      0
+
+/*
+    Local slots for methods in type "Cmd" 
+ */
+#define ES_Cmd_locate_program                                          0
+#define ES_Cmd_locate_search                                           1
+#define ES_Cmd_daemon_cmdline                                          0
+#define ES_Cmd_daemon_options                                          1
+#define ES_Cmd_exec_cmdline                                            0
+#define ES_Cmd_exec_options                                            1
+#define ES_Cmd_kill_pid                                                0
+#define ES_Cmd_kill_signal                                             1
+#define ES_Cmd_killall_pattern                                         0
+#define ES_Cmd_killall_signal                                          1
+#define ES_Cmd_killall_preserve                                        2
+#define ES_Cmd_ps_pattern                                              0
+#define ES_Cmd_run_command                                             0
+#define ES_Cmd_run_options                                             1
+#define ES_Cmd_run_data                                                2
+#define ES_Cmd_sh_command                                              0
+#define ES_Cmd_sh_options                                              1
+#define ES_Cmd_sh_data                                                 2
+
+
+/*
+    Class property slots for the "Config" type 
+ */
+#define ES_Config__initializer___Config_                               0
+#define ES_Config_Debug                                                1
+#define ES_Config_CPU                                                  2
+#define ES_Config_OS                                                   3
+#define ES_Config_Product                                              4
+#define ES_Config_Title                                                5
+#define ES_Config_Version                                              6
+#define ES_Config_Bin                                                  7
+#define ES_Config_Inc                                                  8
+#define ES_Config_Legacy                                               9
+#define ES_Config_SSL                                                  10
+#define ES_Config_SQLITE                                               11
+#define ES_Config_DB                                                   12
+#define ES_Config_MAPPER                                               13
+#define ES_Config_WEB                                                  14
+#define ES_Config_MAIL                                                 15
+#define ES_Config_TEMPLATE                                             16
+#define ES_Config_TAR                                                  17
+#define ES_Config_NUM_CLASS_PROP                                       18
+
+/*
+   Prototype (instance) slots for "Config" type 
+ */
+#define ES_Config_NUM_INSTANCE_PROP                                    0
+#define ES_Config_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "Date" type 
+ */
+#define ES_Date_now                                                    0
+#define ES_Date_ticks                                                  1
+#define ES_Date_parseDate                                              2
+#define ES_Date_parseUTCDate                                           3
+#define ES_Date_parse                                                  4
+#define ES_Date_UTC                                                    5
+#define ES_Date_NUM_CLASS_PROP                                         6
+
+/*
+   Prototype (instance) slots for "Date" type 
+ */
+#define ES_Date_day                                                    0
+#define ES_Date_dayOfYear                                              1
+#define ES_Date_date                                                   2
+#define ES_Date_elapsed                                                3
+#define ES_Date_format                                                 4
+#define ES_Date_formatUTC                                              5
+#define ES_Date_future                                                 6
+#define ES_Date_getDate                                                7
+#define ES_Date_getDay                                                 8
+#define ES_Date_getFullYear                                            9
+#define ES_Date_getHours                                               10
+#define ES_Date_getMilliseconds                                        11
+#define ES_Date_getMinutes                                             12
+#define ES_Date_getMonth                                               13
+#define ES_Date_getSeconds                                             14
+#define ES_Date_getTime                                                15
+#define ES_Date_getTimezoneOffset                                      16
+#define ES_Date_getUTCDate                                             17
+#define ES_Date_getUTCDay                                              18
+#define ES_Date_getUTCFullYear                                         19
+#define ES_Date_getUTCHours                                            20
+#define ES_Date_getUTCMilliseconds                                     21
+#define ES_Date_getUTCMinutes                                          22
+#define ES_Date_getUTCMonth                                            23
+#define ES_Date_getUTCSeconds                                          24
+#define ES_Date_hours                                                  25
+#define ES_Date_milliseconds                                           26
+#define ES_Date_minutes                                                27
+#define ES_Date_month                                                  28
+#define ES_Date_nanoAge                                                29
+#define ES_Date_nextDay                                                30
+#define ES_Date_seconds                                                31
+#define ES_Date_setDate                                                32
+#define ES_Date_setFullYear                                            33
+#define ES_Date_setHours                                               34
+#define ES_Date_setMilliseconds                                        35
+#define ES_Date_setMinutes                                             36
+#define ES_Date_setMonth                                               37
+#define ES_Date_setSeconds                                             38
+#define ES_Date_setTime                                                39
+#define ES_Date_setUTCDate                                             40
+#define ES_Date_setUTCFullYear                                         41
+#define ES_Date_setUTCHours                                            42
+#define ES_Date_setUTCMilliseconds                                     43
+#define ES_Date_setUTCMinutes                                          44
+#define ES_Date_setUTCMonth                                            45
+#define ES_Date_setUTCSeconds                                          46
+#define ES_Date_time                                                   47
+#define ES_Date_toDateString                                           48
+#define ES_Date_toJSON                                                 49
+#define ES_Date_toISOString                                            50
+#define ES_Date_toLocaleDateString                                     51
+#define ES_Date_toLocaleString                                         52
+#define ES_Date_toLocaleTimeString                                     53
+#define ES_Date_toString                                               54
+#define ES_Date_toTimeString                                           55
+#define ES_Date_toUTCString                                            56
+#define ES_Date_valueOf                                                57
+#define ES_Date_year                                                   58
+#define ES_Date_NUM_INSTANCE_PROP                                      59
+#define ES_Date_NUM_INHERITED_PROP                                     0
+
+/*
+    Local slots for methods in type "Date" 
+ */
+#define ES_Date_parseDate_dateString                                   0
+#define ES_Date_parseDate_defaultDate                                  1
+#define ES_Date_parseUTCDate_dateString                                0
+#define ES_Date_parseUTCDate_defaultDate                               1
+#define ES_Date_parse_dateString                                       0
+#define ES_Date_UTC_year                                               0
+#define ES_Date_UTC_month                                              1
+#define ES_Date_UTC_day                                                2
+#define ES_Date_UTC_hours                                              3
+#define ES_Date_UTC_minutes                                            4
+#define ES_Date_UTC_seconds                                            5
+#define ES_Date_UTC_milliseconds                                       6
+
+
+/*
+    Class property slots for the "Debug" type 
+ */
+#define ES_Debug_breakpoint                                            0
+#define ES_Debug_mode                                                  1
+#define ES_Debug_NUM_CLASS_PROP                                        2
+
+/*
+   Prototype (instance) slots for "Debug" type 
+ */
+#define ES_Debug_NUM_INSTANCE_PROP                                     0
+#define ES_Debug_NUM_INHERITED_PROP                                    0
+
+
+/*
+    Class property slots for the "Emitter" type 
+ */
+#define ES_Emitter_NUM_CLASS_PROP                                      0
+
+/*
+   Prototype (instance) slots for "Emitter" type 
+ */
+#define ES_Emitter_endpoints                                           0
+#define ES_Emitter_addOneObserver                                      1
+#define ES_Emitter_clearObservers                                      2
+#define ES_Emitter_delayedFire                                         3
+#define ES_Emitter_hasObservers                                        4
+#define ES_Emitter_getObservers                                        5
+#define ES_Emitter_fire                                                6
+#define ES_Emitter_fireThis                                            7
+#define ES_Emitter_on                                                  8
+#define ES_Emitter_removeOneObserver                                   9
+#define ES_Emitter_off                                                 10
+#define ES_Emitter_NUM_INSTANCE_PROP                                   11
+#define ES_Emitter_NUM_INHERITED_PROP                                  0
+
+
+/*
+    Class property slots for the "Endpoint" type 
+ */
+#define ES_Endpoint_NUM_CLASS_PROP                                     0
+
+/*
+   Prototype (instance) slots for "Endpoint" type 
+ */
+#define ES_Endpoint_callback                                           0
+#define ES_Endpoint_name                                               1
+#define ES_Endpoint_active                                             2
+#define ES_Endpoint_pending                                            3
+#define ES_Endpoint_NUM_INSTANCE_PROP                                  4
+#define ES_Endpoint_NUM_INHERITED_PROP                                 0
+
+
+/*
+    Class property slots for the "Error" type 
+ */
+#define ES_Error_capture                                               0
+#define ES_Error_NUM_CLASS_PROP                                        1
+
+/*
+   Prototype (instance) slots for "Error" type 
+ */
+#define ES_Error_filename                                              0
+#define ES_Error_lineno                                                1
+#define ES_Error_data                                                  2
+#define ES_Error_message                                               3
+#define ES_Error_stack                                                 4
+#define ES_Error_timestamp                                             5
+#define ES_Error_code                                                  6
+#define ES_Error_formatStack                                           7
+#define ES_Error_NUM_INSTANCE_PROP                                     8
+#define ES_Error_NUM_INHERITED_PROP                                    0
+
+/*
+    Local slots for methods in type "Error" 
+ */
+#define ES_Error_capture_uplevels                                      0
+
+
+/*
+    Class property slots for the "ArgError" type 
+ */
+#define ES_ArgError_NUM_CLASS_PROP                                     0
+
+/*
+   Prototype (instance) slots for "ArgError" type 
+ */
+#define ES_ArgError_filename                                           0
+#define ES_ArgError_lineno                                             1
+#define ES_ArgError_data                                               2
+#define ES_ArgError_message                                            3
+#define ES_ArgError_stack                                              4
+#define ES_ArgError_timestamp                                          5
+#define ES_ArgError_code                                               6
+#define ES_ArgError_formatStack                                        7
+#define ES_ArgError_NUM_INSTANCE_PROP                                  8
+#define ES_ArgError_NUM_INHERITED_PROP                                 8
+
+
+/*
+    Class property slots for the "ArithmeticError" type 
+ */
+#define ES_ArithmeticError_NUM_CLASS_PROP                              0
+
+/*
+   Prototype (instance) slots for "ArithmeticError" type 
+ */
+#define ES_ArithmeticError_filename                                    0
+#define ES_ArithmeticError_lineno                                      1
+#define ES_ArithmeticError_data                                        2
+#define ES_ArithmeticError_message                                     3
+#define ES_ArithmeticError_stack                                       4
+#define ES_ArithmeticError_timestamp                                   5
+#define ES_ArithmeticError_code                                        6
+#define ES_ArithmeticError_formatStack                                 7
+#define ES_ArithmeticError_NUM_INSTANCE_PROP                           8
+#define ES_ArithmeticError_NUM_INHERITED_PROP                          8
+
+
+/*
+    Class property slots for the "AssertError" type 
+ */
+#define ES_AssertError_NUM_CLASS_PROP                                  0
+
+/*
+   Prototype (instance) slots for "AssertError" type 
+ */
+#define ES_AssertError_filename                                        0
+#define ES_AssertError_lineno                                          1
+#define ES_AssertError_data                                            2
+#define ES_AssertError_message                                         3
+#define ES_AssertError_stack                                           4
+#define ES_AssertError_timestamp                                       5
+#define ES_AssertError_code                                            6
+#define ES_AssertError_formatStack                                     7
+#define ES_AssertError_NUM_INSTANCE_PROP                               8
+#define ES_AssertError_NUM_INHERITED_PROP                              8
+
+
+/*
+    Class property slots for the "InstructionError" type 
+ */
+#define ES_InstructionError_NUM_CLASS_PROP                             0
+
+/*
+   Prototype (instance) slots for "InstructionError" type 
+ */
+#define ES_InstructionError_filename                                   0
+#define ES_InstructionError_lineno                                     1
+#define ES_InstructionError_data                                       2
+#define ES_InstructionError_message                                    3
+#define ES_InstructionError_stack                                      4
+#define ES_InstructionError_timestamp                                  5
+#define ES_InstructionError_code                                       6
+#define ES_InstructionError_formatStack                                7
+#define ES_InstructionError_NUM_INSTANCE_PROP                          8
+#define ES_InstructionError_NUM_INHERITED_PROP                         8
+
+
+/*
+    Class property slots for the "IOError" type 
+ */
+#define ES_IOError_NUM_CLASS_PROP                                      0
+
+/*
+   Prototype (instance) slots for "IOError" type 
+ */
+#define ES_IOError_filename                                            0
+#define ES_IOError_lineno                                              1
+#define ES_IOError_data                                                2
+#define ES_IOError_message                                             3
+#define ES_IOError_stack                                               4
+#define ES_IOError_timestamp                                           5
+#define ES_IOError_code                                                6
+#define ES_IOError_formatStack                                         7
+#define ES_IOError_NUM_INSTANCE_PROP                                   8
+#define ES_IOError_NUM_INHERITED_PROP                                  8
+
+
+/*
+    Class property slots for the "InternalError" type 
+ */
+#define ES_InternalError_NUM_CLASS_PROP                                0
+
+/*
+   Prototype (instance) slots for "InternalError" type 
+ */
+#define ES_InternalError_filename                                      0
+#define ES_InternalError_lineno                                        1
+#define ES_InternalError_data                                          2
+#define ES_InternalError_message                                       3
+#define ES_InternalError_stack                                         4
+#define ES_InternalError_timestamp                                     5
+#define ES_InternalError_code                                          6
+#define ES_InternalError_formatStack                                   7
+#define ES_InternalError_NUM_INSTANCE_PROP                             8
+#define ES_InternalError_NUM_INHERITED_PROP                            8
+
+
+/*
+    Class property slots for the "MemoryError" type 
+ */
+#define ES_MemoryError_NUM_CLASS_PROP                                  0
+
+/*
+   Prototype (instance) slots for "MemoryError" type 
+ */
+#define ES_MemoryError_filename                                        0
+#define ES_MemoryError_lineno                                          1
+#define ES_MemoryError_data                                            2
+#define ES_MemoryError_message                                         3
+#define ES_MemoryError_stack                                           4
+#define ES_MemoryError_timestamp                                       5
+#define ES_MemoryError_code                                            6
+#define ES_MemoryError_formatStack                                     7
+#define ES_MemoryError_NUM_INSTANCE_PROP                               8
+#define ES_MemoryError_NUM_INHERITED_PROP                              8
+
+
+/*
+    Class property slots for the "OutOfBoundsError" type 
+ */
+#define ES_OutOfBoundsError_NUM_CLASS_PROP                             0
+
+/*
+   Prototype (instance) slots for "OutOfBoundsError" type 
+ */
+#define ES_OutOfBoundsError_filename                                   0
+#define ES_OutOfBoundsError_lineno                                     1
+#define ES_OutOfBoundsError_data                                       2
+#define ES_OutOfBoundsError_message                                    3
+#define ES_OutOfBoundsError_stack                                      4
+#define ES_OutOfBoundsError_timestamp                                  5
+#define ES_OutOfBoundsError_code                                       6
+#define ES_OutOfBoundsError_formatStack                                7
+#define ES_OutOfBoundsError_NUM_INSTANCE_PROP                          8
+#define ES_OutOfBoundsError_NUM_INHERITED_PROP                         8
+
+
+/*
+    Class property slots for the "ReferenceError" type 
+ */
+#define ES_ReferenceError_NUM_CLASS_PROP                               0
+
+/*
+   Prototype (instance) slots for "ReferenceError" type 
+ */
+#define ES_ReferenceError_filename                                     0
+#define ES_ReferenceError_lineno                                       1
+#define ES_ReferenceError_data                                         2
+#define ES_ReferenceError_message                                      3
+#define ES_ReferenceError_stack                                        4
+#define ES_ReferenceError_timestamp                                    5
+#define ES_ReferenceError_code                                         6
+#define ES_ReferenceError_formatStack                                  7
+#define ES_ReferenceError_NUM_INSTANCE_PROP                            8
+#define ES_ReferenceError_NUM_INHERITED_PROP                           8
+
+
+/*
+    Class property slots for the "ResourceError" type 
+ */
+#define ES_ResourceError_NUM_CLASS_PROP                                0
+
+/*
+   Prototype (instance) slots for "ResourceError" type 
+ */
+#define ES_ResourceError_filename                                      0
+#define ES_ResourceError_lineno                                        1
+#define ES_ResourceError_data                                          2
+#define ES_ResourceError_message                                       3
+#define ES_ResourceError_stack                                         4
+#define ES_ResourceError_timestamp                                     5
+#define ES_ResourceError_code                                          6
+#define ES_ResourceError_formatStack                                   7
+#define ES_ResourceError_NUM_INSTANCE_PROP                             8
+#define ES_ResourceError_NUM_INHERITED_PROP                            8
+
+
+/*
+    Class property slots for the "SecurityError" type 
+ */
+#define ES_SecurityError_NUM_CLASS_PROP                                0
+
+/*
+   Prototype (instance) slots for "SecurityError" type 
+ */
+#define ES_SecurityError_filename                                      0
+#define ES_SecurityError_lineno                                        1
+#define ES_SecurityError_data                                          2
+#define ES_SecurityError_message                                       3
+#define ES_SecurityError_stack                                         4
+#define ES_SecurityError_timestamp                                     5
+#define ES_SecurityError_code                                          6
+#define ES_SecurityError_formatStack                                   7
+#define ES_SecurityError_NUM_INSTANCE_PROP                             8
+#define ES_SecurityError_NUM_INHERITED_PROP                            8
+
+
+/*
+    Class property slots for the "StateError" type 
+ */
+#define ES_StateError_NUM_CLASS_PROP                                   0
+
+/*
+   Prototype (instance) slots for "StateError" type 
+ */
+#define ES_StateError_filename                                         0
+#define ES_StateError_lineno                                           1
+#define ES_StateError_data                                             2
+#define ES_StateError_message                                          3
+#define ES_StateError_stack                                            4
+#define ES_StateError_timestamp                                        5
+#define ES_StateError_code                                             6
+#define ES_StateError_formatStack                                      7
+#define ES_StateError_NUM_INSTANCE_PROP                                8
+#define ES_StateError_NUM_INHERITED_PROP                               8
+
+
+/*
+    Class property slots for the "SyntaxError" type 
+ */
+#define ES_SyntaxError_NUM_CLASS_PROP                                  0
+
+/*
+   Prototype (instance) slots for "SyntaxError" type 
+ */
+#define ES_SyntaxError_filename                                        0
+#define ES_SyntaxError_lineno                                          1
+#define ES_SyntaxError_data                                            2
+#define ES_SyntaxError_message                                         3
+#define ES_SyntaxError_stack                                           4
+#define ES_SyntaxError_timestamp                                       5
+#define ES_SyntaxError_code                                            6
+#define ES_SyntaxError_formatStack                                     7
+#define ES_SyntaxError_NUM_INSTANCE_PROP                               8
+#define ES_SyntaxError_NUM_INHERITED_PROP                              8
+
+
+/*
+    Class property slots for the "TypeError" type 
+ */
+#define ES_TypeError_NUM_CLASS_PROP                                    0
+
+/*
+   Prototype (instance) slots for "TypeError" type 
+ */
+#define ES_TypeError_filename                                          0
+#define ES_TypeError_lineno                                            1
+#define ES_TypeError_data                                              2
+#define ES_TypeError_message                                           3
+#define ES_TypeError_stack                                             4
+#define ES_TypeError_timestamp                                         5
+#define ES_TypeError_code                                              6
+#define ES_TypeError_formatStack                                       7
+#define ES_TypeError_NUM_INSTANCE_PROP                                 8
+#define ES_TypeError_NUM_INHERITED_PROP                                8
+
+
+/*
+    Class property slots for the "URIError" type 
+ */
+#define ES_URIError_NUM_CLASS_PROP                                     0
+
+/*
+   Prototype (instance) slots for "URIError" type 
+ */
+#define ES_URIError_filename                                           0
+#define ES_URIError_lineno                                             1
+#define ES_URIError_data                                               2
+#define ES_URIError_message                                            3
+#define ES_URIError_stack                                              4
+#define ES_URIError_timestamp                                          5
+#define ES_URIError_code                                               6
+#define ES_URIError_formatStack                                        7
+#define ES_URIError_NUM_INSTANCE_PROP                                  8
+#define ES_URIError_NUM_INHERITED_PROP                                 8
+
+
+/*
+    Class property slots for the "File" type 
+ */
+#define ES_File_NUM_CLASS_PROP                                         0
+
+/*
+   Prototype (instance) slots for "File" type 
+ */
+#define ES_File_async                                                  0
+#define ES_File_canRead                                                1
+#define ES_File_canWrite                                               2
+#define ES_File_close                                                  3
+#define ES_File_encoding                                               4
+#define ES_File_flush                                                  5
+#define ES_File_iterator_get                                           6
+#define ES_File_iterator_getValues                                     7
+#define ES_File_isOpen                                                 8
+#define ES_File_off                                                    9
+#define ES_File_on                                                     10
+#define ES_File_open                                                   11
+#define ES_File_options                                                12
+#define ES_File_path                                                   13
+#define ES_File_position                                               14
+#define ES_File_read                                                   15
+#define ES_File_readBytes                                              16
+#define ES_File_readString                                             17
+#define ES_File_remove                                                 18
+#define ES_File_size                                                   19
+#define ES_File_truncate                                               20
+#define ES_File_write                                                  21
+#define ES_File_NUM_INSTANCE_PROP                                      22
+#define ES_File_NUM_INHERITED_PROP                                     0
+
+
+/*
+    Class property slots for the "FileSystem" type 
+ */
+#define ES_FileSystem_drives                                           0
+#define ES_FileSystem_NUM_CLASS_PROP                                   1
+
+/*
+   Prototype (instance) slots for "FileSystem" type 
+ */
+#define ES_FileSystem_hasDrives                                        0
+#define ES_FileSystem_newline                                          1
+#define ES_FileSystem_root                                             2
+#define ES_FileSystem_separators                                       3
+#define ES_FileSystem_NUM_INSTANCE_PROP                                4
+#define ES_FileSystem_NUM_INHERITED_PROP                               0
+
+
+/*
+    Class property slots for the "Frame" type 
+ */
+#define ES_Frame_NUM_CLASS_PROP                                        0
+
+/*
+   Prototype (instance) slots for "Frame" type 
+ */
+#define ES_Frame_NUM_INSTANCE_PROP                                     0
+#define ES_Frame_NUM_INHERITED_PROP                                    0
+
+
+/*
+    Class property slots for the "Function" type 
+ */
+#define ES_Function_NUM_CLASS_PROP                                     0
+
+/*
+   Prototype (instance) slots for "Function" type 
+ */
+#define ES_Function_apply                                              0
+#define ES_Function_call                                               1
+#define ES_Function_bind                                               2
+#define ES_Function_bound                                              3
+#define ES_Function_name                                               4
+#define ES_Function_length                                             5
+#define ES_Function_setScope                                           6
+#define ES_Function_NUM_INSTANCE_PROP                                  7
+#define ES_Function_NUM_INHERITED_PROP                                 0
+
+
+/*
+    Class property slots for the "GC" type 
+ */
+#define ES_GC_enabled                                                  0
+#define ES_GC_newQuota                                                 1
+#define ES_GC_run                                                      2
+#define ES_GC_verify                                                   3
+#define ES_GC_NUM_CLASS_PROP                                           4
+
+/*
+   Prototype (instance) slots for "GC" type 
+ */
+#define ES_GC_NUM_INSTANCE_PROP                                        0
+#define ES_GC_NUM_INHERITED_PROP                                       0
+
+
+/*
+    Class property slots for the "Http" type 
+ */
+#define ES_Http__initializer___Http_                                   0
+#define ES_Http_Continue                                               1
+#define ES_Http_Ok                                                     2
+#define ES_Http_Created                                                3
+#define ES_Http_Accepted                                               4
+#define ES_Http_NotAuthoritative                                       5
+#define ES_Http_NoContent                                              6
+#define ES_Http_Reset                                                  7
+#define ES_Http_PartialContent                                         8
+#define ES_Http_MultipleChoice                                         9
+#define ES_Http_MovedPermanently                                       10
+#define ES_Http_MovedTemporarily                                       11
+#define ES_Http_SeeOther                                               12
+#define ES_Http_NotModified                                            13
+#define ES_Http_UseProxy                                               14
+#define ES_Http_BadRequest                                             15
+#define ES_Http_Unauthorized                                           16
+#define ES_Http_PaymentRequired                                        17
+#define ES_Http_Forbidden                                              18
+#define ES_Http_NotFound                                               19
+#define ES_Http_BadMethod                                              20
+#define ES_Http_NotAcceptable                                          21
+#define ES_Http_ProxyAuthRequired                                      22
+#define ES_Http_RequestTimeout                                         23
+#define ES_Http_Conflict                                               24
+#define ES_Http_Gone                                                   25
+#define ES_Http_LengthRequired                                         26
+#define ES_Http_PrecondFailed                                          27
+#define ES_Http_EntityTooLarge                                         28
+#define ES_Http_UriTooLong                                             29
+#define ES_Http_UnsupportedMedia                                       30
+#define ES_Http_BadRange                                               31
+#define ES_Http_ServerError                                            32
+#define ES_Http_NotImplemented                                         33
+#define ES_Http_BadGateway                                             34
+#define ES_Http_ServiceUnavailable                                     35
+#define ES_Http_GatewayTimeout                                         36
+#define ES_Http_VersionNotSupported                                    37
+#define ES_Http_fetch                                                  38
+#define ES_Http_providers                                              39
+#define ES_Http_NUM_CLASS_PROP                                         40
+
+/*
+   Prototype (instance) slots for "Http" type 
+ */
+#define ES_Http_async                                                  0
+#define ES_Http_ca                                                     1
+#define ES_Http_close                                                  2
+#define ES_Http_connect                                                3
+#define ES_Http_certificate                                            4
+#define ES_Http_contentLength                                          5
+#define ES_Http_contentType                                            6
+#define ES_Http_date                                                   7
+#define ES_Http_encoding                                               8
+#define ES_Http_finalize                                               9
+#define ES_Http_finalized                                              10
+#define ES_Http_flush                                                  11
+#define ES_Http_followRedirects                                        12
+#define ES_Http_form                                                   13
+#define ES_Http_jsonForm                                               14
+#define ES_Http_get                                                    15
+#define ES_Http_getRequestHeaders                                      16
+#define ES_Http_head                                                   17
+#define ES_Http_header                                                 18
+#define ES_Http_headers                                                19
+#define ES_Http_info                                                   20
+#define ES_Http_isSecure                                               21
+#define ES_Http_key                                                    22
+#define ES_Http_lastModified                                           23
+#define ES_Http_limits                                                 24
+#define ES_Http_method                                                 25
+#define ES_Http_off                                                    26
+#define ES_Http_on                                                     27
+#define ES_Http_post                                                   28
+#define ES_Http_provider                                               29
+#define ES_Http_put                                                    30
+#define ES_Http_read                                                   31
+#define ES_Http_readString                                             32
+#define ES_Http_readLines                                              33
+#define ES_Http_readXml                                                34
+#define ES_Http_reset                                                  35
+#define ES_Http_response                                               36
+#define ES_Http_retries                                                37
+#define ES_Http_sessionCookie                                          38
+#define ES_Http_setCookie                                              39
+#define ES_Http_setCredentials                                         40
+#define ES_Http_setHeader                                              41
+#define ES_Http_setHeaders                                             42
+#define ES_Http_setLimits                                              43
+#define ES_Http_status                                                 44
+#define ES_Http_statusMessage                                          45
+#define ES_Http_success                                                46
+#define ES_Http_trace                                                  47
+#define ES_Http_upload                                                 48
+#define ES_Http_uri                                                    49
+#define ES_Http_verify                                                 50
+#define ES_Http_verifyIssuer                                           51
+#define ES_Http_wait                                                   52
+#define ES_Http_write                                                  53
+#define ES_Http_afetch                                                 54
+#define ES_Http_NUM_INSTANCE_PROP                                      55
+#define ES_Http_NUM_INHERITED_PROP                                     0
+
+/*
+    Local slots for methods in type "Http" 
+ */
+#define ES_Http_fetch_uri                                              0
+#define ES_Http_fetch_method                                           1
+#define ES_Http_fetch_data                                             2
+
+
+/*
+    Class property slots for the "Inflector" type 
+ */
+#define ES_Inflector__initializer___Inflector_                         0
+#define ES_Inflector_irregularMap                                      1
+#define ES_Inflector_pluralRules                                       2
+#define ES_Inflector_singularRules                                     3
+#define ES_Inflector_uncountable                                       4
+#define ES_Inflector_addIrregular                                      5
+#define ES_Inflector_addPlural                                         6
+#define ES_Inflector_addSingular                                       7
+#define ES_Inflector_addUncountable                                    8
+#define ES_Inflector_toOrdinal                                         9
+#define ES_Inflector_toPlural                                          10
+#define ES_Inflector_toSingular                                        11
+#define ES_Inflector_NUM_CLASS_PROP                                    12
+
+/*
+   Prototype (instance) slots for "Inflector" type 
+ */
+#define ES_Inflector_NUM_INSTANCE_PROP                                 0
+#define ES_Inflector_NUM_INHERITED_PROP                                0
+
+/*
+    Local slots for methods in type "Inflector" 
+ */
+#define ES_Inflector_addIrregular_singular                             0
+#define ES_Inflector_addIrregular_plural                               1
+#define ES_Inflector_addPlural_expr                                    0
+#define ES_Inflector_addPlural_replacement                             1
+#define ES_Inflector_addSingular_expr                                  0
+#define ES_Inflector_addSingular_replacement                           1
+#define ES_Inflector_addUncountable_expr                               0
+#define ES_Inflector_addUncountable_replacement                        1
+#define ES_Inflector_toOrdinal_number                                  0
+#define ES_Inflector_toPlural_word                                     0
+#define ES_Inflector_toSingular_word                                   0
+
+
+/*
+    Class property slots for the "Iterable" type 
+ */
+#define ES_iterator_Iterable_NUM_CLASS_PROP                            0
+
+/*
+   Prototype (instance) slots for "Iterable" type 
+ */
+#define ES_iterator_Iterable_iterator_get                              0
+#define ES_iterator_Iterable_iterator_getValues                        1
+#define ES_iterator_Iterable_NUM_INSTANCE_PROP                         2
+#define ES_iterator_Iterable_NUM_INHERITED_PROP                        0
+
+
+/*
+    Class property slots for the "Iterator" type 
+ */
+#define ES_iterator_Iterator_NUM_CLASS_PROP                            0
+
+/*
+   Prototype (instance) slots for "Iterator" type 
+ */
+#define ES_iterator_Iterator_next                                      0
+#define ES_iterator_Iterator_NUM_INSTANCE_PROP                         1
+#define ES_iterator_Iterator_NUM_INHERITED_PROP                        0
+
+
+/*
+    Class property slots for the "StopIteration" type 
+ */
+#define ES_iterator_StopIteration_NUM_CLASS_PROP                       0
+
+/*
+   Prototype (instance) slots for "StopIteration" type 
+ */
+#define ES_iterator_StopIteration_NUM_INSTANCE_PROP                    0
+#define ES_iterator_StopIteration_NUM_INHERITED_PROP                   0
+
+
+/*
+    Class property slots for the "JSON" type 
+ */
+#define ES_JSON_parse                                                  0
+#define ES_JSON_stringify                                              1
+#define ES_JSON_NUM_CLASS_PROP                                         2
+
+/*
+   Prototype (instance) slots for "JSON" type 
+ */
+#define ES_JSON_NUM_INSTANCE_PROP                                      0
+#define ES_JSON_NUM_INHERITED_PROP                                     0
+
+/*
+    Local slots for methods in type "JSON" 
+ */
+#define ES_JSON_parse_data                                             0
+#define ES_JSON_parse_filter                                           1
+#define ES_JSON_stringify_obj                                          0
+#define ES_JSON_stringify_replacer                                     1
+#define ES_JSON_stringify_indent                                       2
+
+
+/*
+    Class property slots for the "Loader" type 
+ */
+#define ES_Loader__initializer___Loader_                               0
+#define ES_Loader_mainId                                               1
+#define ES_Loader_signatures                                           2
+#define ES_Loader_initializers                                         3
+#define ES_Loader_timestamps                                           4
+#define ES_Loader_defaultExtensions                                    5
+#define ES_Loader_init                                                 6
+#define ES_Loader_register                                             7
+#define ES_Loader_require                                              8
+#define ES_Loader_load                                                 9
+#define ES_Loader_cached                                               10
+#define ES_Loader_wrap                                                 11
+#define ES_Loader_locate                                               12
+#define ES_Loader_setConfig                                            13
+#define ES_Loader_NUM_CLASS_PROP                                       14
+
+/*
+   Prototype (instance) slots for "Loader" type 
+ */
+#define ES_Loader_NUM_INSTANCE_PROP                                    0
+#define ES_Loader_NUM_INHERITED_PROP                                   0
+
+/*
+    Local slots for methods in type "Loader" 
+ */
+#define ES_Loader_init_mainId                                          0
+#define ES_Loader_register_id                                          0
+#define ES_Loader_register_fn                                          1
+#define ES_Loader_require_id                                           0
+#define ES_Loader_require_config                                       1
+#define ES_Loader_load_id                                              0
+#define ES_Loader_load_path                                            1
+#define ES_Loader_load_config                                          2
+#define ES_Loader_load_codeReader                                      3
+#define ES_Loader_cached_id                                            0
+#define ES_Loader_cached_config                                        1
+#define ES_Loader_cached_cachedir                                      2
+#define ES_Loader_wrap_id                                              0
+#define ES_Loader_wrap_code                                            1
+#define ES_Loader_locate_id                                            0
+#define ES_Loader_locate_config                                        1
+#define ES_Loader_setConfig_newConfig                                  0
+
+
+/*
+    Class property slots for the "LocalCache" type 
+ */
+#define ES_LocalCache_NUM_CLASS_PROP                                   0
+
+/*
+   Prototype (instance) slots for "LocalCache" type 
+ */
+#define ES_LocalCache_destroy                                          0
+#define ES_LocalCache_expire                                           1
+#define ES_LocalCache_inc                                              2
+#define ES_LocalCache_limits                                           3
+#define ES_LocalCache_read                                             4
+#define ES_LocalCache_remove                                           5
+#define ES_LocalCache_setLimits                                        6
+#define ES_LocalCache_write                                            7
+#define ES_LocalCache_NUM_INSTANCE_PROP                                8
+#define ES_LocalCache_NUM_INHERITED_PROP                               0
+
+
+/*
+    Class property slots for the "Locale" type 
+ */
+#define ES_Locale__initializer___Locale_                               0
+#define ES_Locale_textEncoding                                         1
+#define ES_Locale_NUM_CLASS_PROP                                       2
+
+/*
+   Prototype (instance) slots for "Locale" type 
+ */
+#define ES_Locale_NUM_INSTANCE_PROP                                    0
+#define ES_Locale_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "Logger" type 
+ */
+#define ES_Logger__initializer___Logger_                               0
+#define ES_Logger_Off                                                  1
+#define ES_Logger_Error                                                2
+#define ES_Logger_Warn                                                 3
+#define ES_Logger_Info                                                 4
+#define ES_Logger_Config                                               5
+#define ES_Logger_All                                                  6
+#define ES_Logger_NUM_CLASS_PROP                                       7
+
+/*
+   Prototype (instance) slots for "Logger" type 
+ */
+#define ES_Logger__filter                                              0
+#define ES_Logger__level                                               1
+#define ES_Logger__location                                            2
+#define ES_Logger__pattern                                             3
+#define ES_Logger__name                                                4
+#define ES_Logger__outStream                                           5
+#define ES_Logger_redirect                                             6
+#define ES_Logger_async                                                7
+#define ES_Logger_close                                                8
+#define ES_Logger_filter                                               9
+#define ES_Logger_flush                                                10
+#define ES_Logger_level                                                11
+#define ES_Logger_location                                             12
+#define ES_Logger_match                                                13
+#define ES_Logger_name                                                 14
+#define ES_Logger_outStream                                            15
+#define ES_Logger_debug                                                16
+#define ES_Logger_config                                               17
+#define ES_Logger_error                                                18
+#define ES_Logger_info                                                 19
+#define ES_Logger_activity                                             20
+#define ES_Logger_off                                                  21
+#define ES_Logger_on                                                   22
+#define ES_Logger_read                                                 23
+#define ES_Logger_write                                                24
+#define ES_Logger_warn                                                 25
+#define ES_Logger_emit                                                 26
+#define ES_Logger_NUM_INSTANCE_PROP                                    27
+#define ES_Logger_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "Math" type 
+ */
+#define ES_Math__initializer___Math_                                   0
+#define ES_Math_E                                                      1
+#define ES_Math_LN2                                                    2
+#define ES_Math_LN10                                                   3
+#define ES_Math_LOG2E                                                  4
+#define ES_Math_LOG10E                                                 5
+#define ES_Math_PI                                                     6
+#define ES_Math_SQRT1_2                                                7
+#define ES_Math_SQRT2                                                  8
+#define ES_Math_abs                                                    9
+#define ES_Math_acos                                                   10
+#define ES_Math_asin                                                   11
+#define ES_Math_atan                                                   12
+#define ES_Math_atan2                                                  13
+#define ES_Math_ceil                                                   14
+#define ES_Math_cos                                                    15
+#define ES_Math_exp                                                    16
+#define ES_Math_floor                                                  17
+#define ES_Math_log10                                                  18
+#define ES_Math_log                                                    19
+#define ES_Math_max                                                    20
+#define ES_Math_min                                                    21
+#define ES_Math_pow                                                    22
+#define ES_Math_random                                                 23
+#define ES_Math_round                                                  24
+#define ES_Math_sin                                                    25
+#define ES_Math_sqrt                                                   26
+#define ES_Math_tan                                                    27
+#define ES_Math_NUM_CLASS_PROP                                         28
+
+/*
+   Prototype (instance) slots for "Math" type 
+ */
+#define ES_Math_NUM_INSTANCE_PROP                                      0
+#define ES_Math_NUM_INHERITED_PROP                                     0
+
+/*
+    Local slots for methods in type "Math" 
+ */
+#define ES_Math_abs_value                                              0
+#define ES_Math_acos_angle                                             0
+#define ES_Math_asin_oper                                              0
+#define ES_Math_atan_oper                                              0
+#define ES_Math_atan2_y                                                0
+#define ES_Math_atan2_x                                                1
+#define ES_Math_ceil_oper                                              0
+#define ES_Math_cos_angle                                              0
+#define ES_Math_exp_power                                              0
+#define ES_Math_floor_oper                                             0
+#define ES_Math_log10_oper                                             0
+#define ES_Math_log_oper                                               0
+#define ES_Math_max_x                                                  0
+#define ES_Math_max_y                                                  1
+#define ES_Math_min_x                                                  0
+#define ES_Math_min_y                                                  1
+#define ES_Math_pow_num                                                0
+#define ES_Math_pow_pow                                                1
+#define ES_Math_round_num                                              0
+#define ES_Math_sin_angle                                              0
+#define ES_Math_sqrt_oper                                              0
+#define ES_Math_tan_angle                                              0
+
+
+/*
+    Class property slots for the "Memory" type 
+ */
+#define ES_Memory_allocated                                            0
+#define ES_Memory_callback                                             1
+#define ES_Memory_maximum                                              2
+#define ES_Memory_redline                                              3
+#define ES_Memory_resident                                             4
+#define ES_Memory_system                                               5
+#define ES_Memory_stats                                                6
+#define ES_Memory_NUM_CLASS_PROP                                       7
+
+/*
+   Prototype (instance) slots for "Memory" type 
+ */
+#define ES_Memory_NUM_INSTANCE_PROP                                    0
+#define ES_Memory_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "MprLog" type 
+ */
+#define ES_MprLog_NUM_CLASS_PROP                                       0
+
+/*
+   Prototype (instance) slots for "MprLog" type 
+ */
+#define ES_MprLog_async                                                0
+#define ES_MprLog_close                                                1
+#define ES_MprLog_emit                                                 2
+#define ES_MprLog_fixed                                                3
+#define ES_MprLog_flush                                                4
+#define ES_MprLog_level                                                5
+#define ES_MprLog_off                                                  6
+#define ES_MprLog_on                                                   7
+#define ES_MprLog_read                                                 8
+#define ES_MprLog_redirect                                             9
+#define ES_MprLog_write                                                10
+#define ES_MprLog_NUM_INSTANCE_PROP                                    11
+#define ES_MprLog_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "Namespace" type 
+ */
+#define ES_Namespace_NUM_CLASS_PROP                                    0
+
+/*
+   Prototype (instance) slots for "Namespace" type 
+ */
+#define ES_Namespace_NUM_INSTANCE_PROP                                 0
+#define ES_Namespace_NUM_INHERITED_PROP                                0
+
+
+/*
+    Class property slots for the "Null" type 
+ */
+#define ES_Null_NUM_CLASS_PROP                                         0
+
+/*
+   Prototype (instance) slots for "Null" type 
+ */
+#define ES_Null_iterator_get                                           0
+#define ES_Null_iterator_getValues                                     1
+#define ES_Null_NUM_INSTANCE_PROP                                      2
+#define ES_Null_NUM_INHERITED_PROP                                     0
+
+
+/*
+    Class property slots for the "Number" type 
+ */
+#define ES_Number__initializer___Number_                               0
+#define ES_Number_MAX_VALUE                                            1
+#define ES_Number_MIN_VALUE                                            2
+#define ES_Number_NaN                                                  3
+#define ES_Number_NEGATIVE_INFINITY                                    4
+#define ES_Number_POSITIVE_INFINITY                                    5
+#define ES_Number_MaxValue                                             6
+#define ES_Number_MaxInt32                                             7
+#define ES_Number_MinValue                                             8
+#define ES_Number_NUM_CLASS_PROP                                       9
+
+/*
+   Prototype (instance) slots for "Number" type 
+ */
+#define ES_Number_abs                                                  0
+#define ES_Number_ceil                                                 1
+#define ES_Number_floor                                                2
+#define ES_Number_isFinite                                             3
+#define ES_Number_isNaN                                                4
+#define ES_Number_round                                                5
+#define ES_Number_toExponential                                        6
+#define ES_Number_toFixed                                              7
+#define ES_Number_toPrecision                                          8
+#define ES_Number_byte                                                 9
+#define ES_Number_integral                                             10
+#define ES_Number_iterator_get                                         11
+#define ES_Number_iterator_getValues                                   12
+#define ES_Number_max                                                  13
+#define ES_Number_min                                                  14
+#define ES_Number_power                                                15
+#define ES_Number_toString                                             16
+#define ES_Number_NUM_INSTANCE_PROP                                    17
+#define ES_Number_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "Object" type 
+ */
+#define ES_Object_create                                               0
+#define ES_Object_defineProperty                                       1
+#define ES_Object_defineProperties                                     2
+#define ES_Object_freeze                                               3
+#define ES_Object_getOwnPropertyDescriptor                             4
+#define ES_Object_getOwnPropertyNames                                  5
+#define ES_Object_getOwnPropertyCount                                  6
+#define ES_Object_getOwnPrototypeOf                                    7
+#define ES_Object_isExtensible                                         8
+#define ES_Object_isFrozen                                             9
+#define ES_Object_isSealed                                             10
+#define ES_Object_keys                                                 11
+#define ES_Object_preventExtensions                                    12
+#define ES_Object_prototype                                            13
+#define ES_Object_seal                                                 14
+#define ES_Object_sortProperties                                       15
+#define ES_Object_getBaseType                                          16
+#define ES_Object_getName                                              17
+#define ES_Object_getType                                              18
+#define ES_Object_getTypeName                                          19
+#define ES_Object_isPrototype                                          20
+#define ES_Object_isType                                               21
+#define ES_Object_NUM_CLASS_PROP                                       22
+
+/*
+   Prototype (instance) slots for "Object" type 
+ */
+#define ES_Object_constructor                                          0
+#define ES_Object_clone                                                1
+#define ES_Object_iterator_get                                         2
+#define ES_Object_iterator_getValues                                   3
+#define ES_Object_hasOwnProperty                                       4
+#define ES_Object_isPrototypeOf                                        5
+#define ES_Object_propertyIsEnumerable                                 6
+#define ES_Object_toJSON                                               7
+#define ES_Object_toLocaleString                                       8
+#define ES_Object_toString                                             9
+#define ES_Object_valueOf                                              10
+#define ES_Object_NUM_INSTANCE_PROP                                    11
+#define ES_Object_NUM_INHERITED_PROP                                   0
+
+/*
+    Local slots for methods in type "Object" 
+ */
+#define ES_Object_create_prototype                                     0
+#define ES_Object_create_properties                                    1
+#define ES_Object_defineProperty_obj                                   0
+#define ES_Object_defineProperty_name                                  1
+#define ES_Object_defineProperty_options                               2
+#define ES_Object_defineProperties_obj                                 0
+#define ES_Object_defineProperties_properties                          1
+#define ES_Object_freeze_obj                                           0
+#define ES_Object_getOwnPropertyDescriptor_obj                         0
+#define ES_Object_getOwnPropertyDescriptor_prop                        1
+#define ES_Object_getOwnPropertyNames_obj                              0
+#define ES_Object_getOwnPropertyNames_options                          1
+#define ES_Object_getOwnPropertyCount_obj                              0
+#define ES_Object_getOwnPrototypeOf_obj                                0
+#define ES_Object_isExtensible_obj                                     0
+#define ES_Object_isFrozen_obj                                         0
+#define ES_Object_isSealed_obj                                         0
+#define ES_Object_keys_obj                                             0
+#define ES_Object_preventExtensions_obj                                0
+#define ES_Object_seal_obj                                             0
+#define ES_Object_sortProperties_obj                                   0
+#define ES_Object_sortProperties_ascending                             1
+#define ES_Object_getBaseType_obj                                      0
+#define ES_Object_getName_obj                                          0
+#define ES_Object_getType_obj                                          0
+#define ES_Object_getTypeName_obj                                      0
+#define ES_Object_isPrototype_obj                                      0
+#define ES_Object_isType_obj                                           0
+
+
+/*
+    Class property slots for the "Path" type 
+ */
+#define ES_Path_NUM_CLASS_PROP                                         0
+
+/*
+   Prototype (instance) slots for "Path" type 
+ */
+#define ES_Path_absolute                                               0
+#define ES_Path_accessed                                               1
+#define ES_Path_append                                                 2
+#define ES_Path_attributes                                             3
+#define ES_Path_setAttributes                                          4
+#define ES_Path_basename                                               5
+#define ES_Path_childOf                                                6
+#define ES_Path_components                                             7
+#define ES_Path_contains                                               8
+#define ES_Path_copy                                                   9
+#define ES_Path_created                                                10
+#define ES_Path_dirname                                                11
+#define ES_Path_endsWith                                               12
+#define ES_Path_exists                                                 13
+#define ES_Path_extension                                              14
+#define ES_Path_findAbove                                              15
+#define ES_Path_files                                                  16
+#define ES_Path_fileSystem                                             17
+#define ES_Path_iterator_get                                           18
+#define ES_Path_iterator_getValues                                     19
+#define ES_Path_glob                                                   20
+#define ES_Path_hasDrive                                               21
+#define ES_Path_isAbsolute                                             22
+#define ES_Path_isDir                                                  23
+#define ES_Path_isLink                                                 24
+#define ES_Path_isRegular                                              25
+#define ES_Path_isRelative                                             26
+#define ES_Path_join                                                   27
+#define ES_Path_joinExt                                                28
+#define ES_Path_length                                                 29
+#define ES_Path_link                                                   30
+#define ES_Path_linkTarget                                             31
+#define ES_Path_makeDir                                                32
+#define ES_Path_makeLink                                               33
+#define ES_Path_temp                                                   34
+#define ES_Path_map                                                    35
+#define ES_Path_match                                                  36
+#define ES_Path_mimeType                                               37
+#define ES_Path_modified                                               38
+#define ES_Path_name                                                   39
+#define ES_Path_natural                                                40
+#define ES_Path_normalize                                              41
+#define ES_Path_open                                                   42
+#define ES_Path_openTextStream                                         43
+#define ES_Path_openBinaryStream                                       44
+#define ES_Path_parent                                                 45
+#define ES_Path_perms                                                  46
+#define ES_Path_portable                                               47
+#define ES_Path_readBytes                                              48
+#define ES_Path_readJSON                                               49
+#define ES_Path_readLines                                              50
+#define ES_Path_readString                                             51
+#define ES_Path_readXML                                                52
+#define ES_Path_relative                                               53
+#define ES_Path_relativeTo                                             54
+#define ES_Path_remove                                                 55
+#define ES_Path_removeAll                                              56
+#define ES_Path_removeDrive                                            57
+#define ES_Path_rename                                                 58
+#define ES_Path_replaceExt                                             59
+#define ES_Path_replace                                                60
+#define ES_Path_resolve                                                61
+#define ES_Path_root                                                   62
+#define ES_Path_same                                                   63
+#define ES_Path_separator                                              64
+#define ES_Path_size                                                   65
+#define ES_Path_startsWith                                             66
+#define ES_Path_symlink                                                67
+#define ES_Path_toJSON                                                 68
+#define ES_Path_toLowerCase                                            69
+#define ES_Path_toString                                               70
+#define ES_Path_operate                                                71
+#define ES_Path_trimComponents                                         72
+#define ES_Path_trimEnd                                                73
+#define ES_Path_trimExt                                                74
+#define ES_Path_trimStart                                              75
+#define ES_Path_truncate                                               76
+#define ES_Path_windows                                                77
+#define ES_Path_write                                                  78
+#define ES_Path_makeTemp                                               79
+#define ES_Path_compact                                                80
+#define ES_Path_NUM_INSTANCE_PROP                                      81
+#define ES_Path_NUM_INHERITED_PROP                                     0
+
+
+/*
+    Class property slots for the "Promise" type 
+ */
+#define ES_Promise_NUM_CLASS_PROP                                      0
+
+/*
+   Prototype (instance) slots for "Promise" type 
+ */
+#define ES_Promise_endpoints                                           0
+#define ES_Promise_addOneObserver                                      1
+#define ES_Promise_clearObservers                                      2
+#define ES_Promise_delayedFire                                         3
+#define ES_Promise_hasObservers                                        4
+#define ES_Promise_getObservers                                        5
+#define ES_Promise_fire                                                6
+#define ES_Promise_fireThis                                            7
+#define ES_Promise_on                                                  8
+#define ES_Promise_removeOneObserver                                   9
+#define ES_Promise_off                                                 10
+#define ES_Promise_timer                                               11
+#define ES_Promise_complete                                            12
+#define ES_Promise_onSuccess                                           13
+#define ES_Promise_onCancel                                            14
+#define ES_Promise_onError                                             15
+#define ES_Promise_onProgress                                          16
+#define ES_Promise_onTimeout                                           17
+#define ES_Promise_emitSuccess                                         18
+#define ES_Promise_emitError                                           19
+#define ES_Promise_emitCancel                                          20
+#define ES_Promise_cancel                                              21
+#define ES_Promise_then                                                22
+#define ES_Promise_timeout                                             23
+#define ES_Promise_wait                                                24
+#define ES_Promise_issue                                               25
+#define ES_Promise_NUM_INSTANCE_PROP                                   26
+#define ES_Promise_NUM_INHERITED_PROP                                  11
+
+
+/*
+    Class property slots for the "RegExp" type 
+ */
+#define ES_RegExp_NUM_CLASS_PROP                                       0
+
+/*
+   Prototype (instance) slots for "RegExp" type 
+ */
+#define ES_RegExp_lastIndex                                            0
+#define ES_RegExp_exec                                                 1
+#define ES_RegExp_global                                               2
+#define ES_RegExp_ignoreCase                                           3
+#define ES_RegExp_multiline                                            4
+#define ES_RegExp_source                                               5
+#define ES_RegExp_matched                                              6
+#define ES_RegExp_replace                                              7
+#define ES_RegExp_split                                                8
+#define ES_RegExp_start                                                9
+#define ES_RegExp_sticky                                               10
+#define ES_RegExp_test                                                 11
+#define ES_RegExp_toString                                             12
+#define ES_RegExp_NUM_INSTANCE_PROP                                    13
+#define ES_RegExp_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "Socket" type 
+ */
+#define ES_Socket_NUM_CLASS_PROP                                       0
+
+/*
+   Prototype (instance) slots for "Socket" type 
+ */
+#define ES_Socket_accept                                               0
+#define ES_Socket_address                                              1
+#define ES_Socket_async                                                2
+#define ES_Socket_close                                                3
+#define ES_Socket_connect                                              4
+#define ES_Socket_encoding                                             5
+#define ES_Socket_flush                                                6
+#define ES_Socket_isEof                                                7
+#define ES_Socket_listen                                               8
+#define ES_Socket_off                                                  9
+#define ES_Socket_on                                                   10
+#define ES_Socket_port                                                 11
+#define ES_Socket_read                                                 12
+#define ES_Socket_remoteAddress                                        13
+#define ES_Socket_write                                                14
+#define ES_Socket_NUM_INSTANCE_PROP                                    15
+#define ES_Socket_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "Stream" type 
+ */
+#define ES_Stream_READ                                                 0
+#define ES_Stream_WRITE                                                1
+#define ES_Stream_BOTH                                                 2
+#define ES_Stream_NUM_CLASS_PROP                                       3
+
+/*
+   Prototype (instance) slots for "Stream" type 
+ */
+#define ES_Stream_async                                                0
+#define ES_Stream_close                                                1
+#define ES_Stream_flush                                                2
+#define ES_Stream_off                                                  3
+#define ES_Stream_on                                                   4
+#define ES_Stream_read                                                 5
+#define ES_Stream_write                                                6
+#define ES_Stream_NUM_INSTANCE_PROP                                    7
+#define ES_Stream_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "String" type 
+ */
+#define ES_String_fromCharCode                                         0
+#define ES_String_NUM_CLASS_PROP                                       1
+
+/*
+   Prototype (instance) slots for "String" type 
+ */
+#define ES_String_caseCompare                                          0
+#define ES_String_caselessCompare                                      1
+#define ES_String_charAt                                               2
+#define ES_String_charCodeAt                                           3
+#define ES_String_concat                                               4
+#define ES_String_contains                                             5
+#define ES_String_endsWith                                             6
+#define ES_String_expand                                               7
+#define ES_String_format                                               8
+#define ES_String_iterator_get                                         9
+#define ES_String_iterator_getValues                                   10
+#define ES_String_indexOf                                              11
+#define ES_String_isDigit                                              12
+#define ES_String_isAlpha                                              13
+#define ES_String_isAlphaNum                                           14
+#define ES_String_isLower                                              15
+#define ES_String_isSpace                                              16
+#define ES_String_isUpper                                              17
+#define ES_String_lastIndexOf                                          18
+#define ES_String_length                                               19
+#define ES_String_match                                                20
+#define ES_String_parseJSON                                            21
+#define ES_String_toCamel                                              22
+#define ES_String_toPascal                                             23
+#define ES_String_printable                                            24
+#define ES_String_quote                                                25
+#define ES_String_remove                                               26
+#define ES_String_replace                                              27
+#define ES_String_reverse                                              28
+#define ES_String_search                                               29
+#define ES_String_slice                                                30
+#define ES_String_split                                                31
+#define ES_String_startsWith                                           32
+#define ES_String_substring                                            33
+#define ES_String_times                                                34
+#define ES_String_tokenize                                             35
+#define ES_String_toJSON                                               36
+#define ES_String_toLowerCase                                          37
+#define ES_String_toString                                             38
+#define ES_String_toPath                                               39
+#define ES_String_toUpperCase                                          40
+#define ES_String_trim                                                 41
+#define ES_String_trimStart                                            42
+#define ES_String_trimEnd                                              43
+#define ES_String_MINUS                                                44
+#define ES_String_MOD                                                  45
+#define ES_String_toLower                                              46
+#define ES_String_toUpper                                              47
+#define ES_String_NUM_INSTANCE_PROP                                    48
+#define ES_String_NUM_INHERITED_PROP                                   0
+
+/*
+    Local slots for methods in type "String" 
+ */
+#define ES_String_fromCharCode_codes                                   0
+
+
+/*
+    Class property slots for the "System" type 
+ */
+#define ES_System__initializer___System_                               0
+#define ES_System_Bufsize                                              1
+#define ES_System_hostname                                             2
+#define ES_System_ipaddr                                               3
+#define ES_System_tmpdir                                               4
+#define ES_System_NUM_CLASS_PROP                                       5
+
+/*
+   Prototype (instance) slots for "System" type 
+ */
+#define ES_System_NUM_INSTANCE_PROP                                    0
+#define ES_System_NUM_INHERITED_PROP                                   0
+
+
+/*
+    Class property slots for the "TextStream" type 
+ */
+#define ES_TextStream_NUM_CLASS_PROP                                   0
+
+/*
+   Prototype (instance) slots for "TextStream" type 
+ */
+#define ES_TextStream_newline                                          0
+#define ES_TextStream_inbuf                                            1
+#define ES_TextStream_format                                           2
+#define ES_TextStream_nextStream                                       3
+#define ES_TextStream_async                                            4
+#define ES_TextStream_close                                            5
+#define ES_TextStream_encoding                                         6
+#define ES_TextStream_fill                                             7
+#define ES_TextStream_flush                                            8
+#define ES_TextStream_length                                           9
+#define ES_TextStream_off                                              10
+#define ES_TextStream_on                                               11
+#define ES_TextStream_read                                             12
+#define ES_TextStream_readLine                                         13
+#define ES_TextStream_readLines                                        14
+#define ES_TextStream_readString                                       15
+#define ES_TextStream_write                                            16
+#define ES_TextStream_writeLine                                        17
+#define ES_TextStream_NUM_INSTANCE_PROP                                18
+#define ES_TextStream_NUM_INHERITED_PROP                               0
+
+
+/*
+    Class property slots for the "Timer" type 
+ */
+#define ES_Timer_NUM_CLASS_PROP                                        0
+
+/*
+   Prototype (instance) slots for "Timer" type 
+ */
+#define ES_Timer_drift                                                 0
+#define ES_Timer_period                                                1
+#define ES_Timer_onerror                                               2
+#define ES_Timer_repeat                                                3
+#define ES_Timer_restart                                               4
+#define ES_Timer_start                                                 5
+#define ES_Timer_stop                                                  6
+#define ES_Timer_NUM_INSTANCE_PROP                                     7
+#define ES_Timer_NUM_INHERITED_PROP                                    0
+
+
+/*
+    Class property slots for the "Type" type 
+ */
+#define ES_Type_NUM_CLASS_PROP                                         0
+
+/*
+   Prototype (instance) slots for "Type" type 
+ */
+#define ES_Type_NUM_INSTANCE_PROP                                      0
+#define ES_Type_NUM_INHERITED_PROP                                     0
+
+
+/*
+    Class property slots for the "Float64Array" type 
+ */
+#define ES_Float64Array__initializer___Float64Array_                   0
+#define ES_Float64Array_BYTES_PER_ELEMENT                              1
+#define ES_Float64Array_NUM_CLASS_PROP                                 2
+
+/*
+   Prototype (instance) slots for "Float64Array" type 
+ */
+#define ES_Float64Array_buffer                                         0
+#define ES_Float64Array_byteLength                                     1
+#define ES_Float64Array_byteOffset                                     2
+#define ES_Float64Array_copyWithin                                     3
+#define ES_Float64Array_fill                                           4
+#define ES_Float64Array_iterator_get                                   5
+#define ES_Float64Array_iterator_getValues                             6
+#define ES_Float64Array_length                                         7
+#define ES_Float64Array_map                                            8
+#define ES_Float64Array_max                                            9
+#define ES_Float64Array_min                                            10
+#define ES_Float64Array_sum                                            11
+#define ES_Float64Array_toArray                                        12
+#define ES_Float64Array_toString                                       13
+#define ES_Float64Array_NUM_INSTANCE_PROP                              14
+#define ES_Float64Array_NUM_INHERITED_PROP                             0
+
+
+/*
+    Class property slots for the "Int32Array" type 
+ */
+#define ES_Int32Array__initializer___Int32Array_                       0
+#define ES_Int32Array_BYTES_PER_ELEMENT                                1
+#define ES_Int32Array_NUM_CLASS_PROP                                   2
+
+/*
+   Prototype (instance) slots for "Int32Array" type 
+ */
+#define ES_Int32Array_buffer                                           0
+#define ES_Int32Array_byteLength                                       1
+#define ES_Int32Array_byteOffset                                       2
+#define ES_Int32Array_copyWithin                                       3
+#define ES_Int32Array_fill                                             4
+#define ES_Int32Array_iterator_get                                     5
+#define ES_Int32Array_iterator_getValues                               6
+#define ES_Int32Array_length                                           7
+#define ES_Int32Array_map                                              8
+#define ES_Int32Array_max                                              9
+#define ES_Int32Array_min                                              10
+#define ES_Int32Array_sum                                              11
+#define ES_Int32Array_toArray                                          12
+#define ES_Int32Array_toString                                         13
+#define ES_Int32Array_NUM_INSTANCE_PROP                                14
+#define ES_Int32Array_NUM_INHERITED_PROP                               0
+
+
+/*
+    Class property slots for the "Uint8Array" type 
+ */
+#define ES_Uint8Array__initializer___Uint8Array_                       0
+#define ES_Uint8Array_BYTES_PER_ELEMENT                                1
+#define ES_Uint8Array_NUM_CLASS_PROP                                   2
+
+/*
+   Prototype (instance) slots for "Uint8Array" type 
+ */
+#define ES_Uint8Array_buffer                                           0
+#define ES_Uint8Array_byteLength                                       1
+#define ES_Uint8Array_byteOffset                                       2
+#define ES_Uint8Array_copyWithin                                       3
+#define ES_Uint8Array_fill                                             4
+#define ES_Uint8Array_iterator_get                                     5
+#define ES_Uint8Array_iterator_getValues                               6
+#define ES_Uint8Array_length                                           7
+#define ES_Uint8Array_map                                              8
+#define ES_Uint8Array_max                                              9
+#define ES_Uint8Array_min                                              10
+#define ES_Uint8Array_sum                                              11
+#define ES_Uint8Array_toArray                                          12
+#define ES_Uint8Array_toString                                         13
+#define ES_Uint8Array_NUM_INSTANCE_PROP                                14
+#define ES_Uint8Array_NUM_INHERITED_PROP                               0
+
+
+/*
+    Class property slots for the "Uri" type 
+ */
+#define ES_Uri_decode                                                  0
+#define ES_Uri_decodeComponent                                         1
+#define ES_Uri_encode                                                  2
+#define ES_Uri_encodeComponent                                         3
+#define ES_Uri_template                                                4
+#define ES_Uri_NUM_CLASS_PROP                                          5
+
+/*
+   Prototype (instance) slots for "Uri" type 
+ */
+#define ES_Uri_absolute                                                0
+#define ES_Uri_address                                                 1
+#define ES_Uri_basename                                                2
+#define ES_Uri_complete                                                3
+#define ES_Uri_components                                              4
+#define ES_Uri_dirname                                                 5
+#define ES_Uri_endsWith                                                6
+#define ES_Uri_extension                                               7
+#define ES_Uri_filename                                                8
+#define ES_Uri_hasExtension                                            9
+#define ES_Uri_hasHost                                                 10
+#define ES_Uri_hasPort                                                 11
+#define ES_Uri_hasQuery                                                12
+#define ES_Uri_hasReference                                            13
+#define ES_Uri_hasScheme                                               14
+#define ES_Uri_host                                                    15
+#define ES_Uri_isAbsolute                                              16
+#define ES_Uri_isDir                                                   17
+#define ES_Uri_isRegular                                               18
+#define ES_Uri_isRelative                                              19
+#define ES_Uri_join                                                    20
+#define ES_Uri_joinExt                                                 21
+#define ES_Uri_local                                                   22
+#define ES_Uri_mimeType                                                23
+#define ES_Uri_normalize                                               24
+#define ES_Uri_path                                                    25
+#define ES_Uri_port                                                    26
+#define ES_Uri_query                                                   27
+#define ES_Uri_reference                                               28
+#define ES_Uri_relative                                                29
+#define ES_Uri_replaceExt                                              30
+#define ES_Uri_resolve                                                 31
+#define ES_Uri_same                                                    32
+#define ES_Uri_scheme                                                  33
+#define ES_Uri_startsWith                                              34
+#define ES_Uri_toJSON                                                  35
+#define ES_Uri_toString                                                36
+#define ES_Uri_toLocalString                                           37
+#define ES_Uri_trimEnd                                                 38
+#define ES_Uri_trimExt                                                 39
+#define ES_Uri_trimStart                                               40
+#define ES_Uri_uri                                                     41
+#define ES_Uri_NUM_INSTANCE_PROP                                       42
+#define ES_Uri_NUM_INHERITED_PROP                                      0
+
+/*
+    Local slots for methods in type "Uri" 
+ */
+#define ES_Uri_decode_str                                              0
+#define ES_Uri_decodeComponent_str                                     0
+#define ES_Uri_encode_str                                              0
+#define ES_Uri_encodeComponent_str                                     0
+#define ES_Uri_template_pattern                                        0
+#define ES_Uri_template_options                                        1
+
+
+/*
+    Class property slots for the "Void" type 
+ */
+#define ES_Void_NUM_CLASS_PROP                                         0
+
+/*
+   Prototype (instance) slots for "Void" type 
+ */
+#define ES_Void_iterator_get                                           0
+#define ES_Void_iterator_getValues                                     1
+#define ES_Void_NUM_INSTANCE_PROP                                      2
+#define ES_Void_NUM_INHERITED_PROP                                     0
+
+
+/*
+    Class property slots for the "WebSocket" type 
+ */
+#define ES_WebSocket__initializer___WebSocket_                         0
+#define ES_WebSocket_CONNECTING                                        1
+#define ES_WebSocket_OPEN                                              2
+#define ES_WebSocket_CLOSING                                           3
+#define ES_WebSocket_CLOSED                                            4
+#define ES_WebSocket_MSG_CONT                                          5
+#define ES_WebSocket_MSG_TEXT                                          6
+#define ES_WebSocket_MSG_BINARY                                        7
+#define ES_WebSocket_MSG_CLOSE                                         8
+#define ES_WebSocket_MSG_PING                                          9
+#define ES_WebSocket_MSG_PONG                                          10
+#define ES_WebSocket_NON_BLOCK                                         11
+#define ES_WebSocket_BUFFER                                            12
+#define ES_WebSocket_BLOCK                                             13
+#define ES_WebSocket_NUM_CLASS_PROP                                    14
+
+/*
+   Prototype (instance) slots for "WebSocket" type 
+ */
+#define ES_WebSocket_onopen                                            0
+#define ES_WebSocket_onmessage                                         1
+#define ES_WebSocket_onerror                                           2
+#define ES_WebSocket_onclose                                           3
+#define ES_WebSocket_binaryType                                        4
+#define ES_WebSocket_bufferedAmount                                    5
+#define ES_WebSocket_close                                             6
+#define ES_WebSocket_extensions                                        7
+#define ES_WebSocket_off                                               8
+#define ES_WebSocket_on                                                9
+#define ES_WebSocket_protocol                                          10
+#define ES_WebSocket_readyState                                        11
+#define ES_WebSocket_send                                              12
+#define ES_WebSocket_sendBlock                                         13
+#define ES_WebSocket_url                                               14
+#define ES_WebSocket_wait                                              15
+#define ES_WebSocket_NUM_INSTANCE_PROP                                 16
+#define ES_WebSocket_NUM_INHERITED_PROP                                0
+
+
+/*
+    Class property slots for the "Worker" type 
+ */
+#define ES_Worker_fork                                                 0
+#define ES_Worker_exit                                                 1
+#define ES_Worker_join                                                 2
+#define ES_Worker_lookup                                               3
+#define ES_Worker_NUM_CLASS_PROP                                       4
+
+/*
+   Prototype (instance) slots for "Worker" type 
+ */
+#define ES_Worker_onclose                                              0
+#define ES_Worker_onmessage                                            1
+#define ES_Worker_onerror                                              2
+#define ES_Worker_name                                                 3
+#define ES_Worker_clone                                                4
+#define ES_Worker_eval                                                 5
+#define ES_Worker_load                                                 6
+#define ES_Worker_preload                                              7
+#define ES_Worker_preeval                                              8
+#define ES_Worker_postMessage                                          9
+#define ES_Worker_terminate                                            10
+#define ES_Worker_waitForMessage                                       11
+#define ES_Worker_NUM_INSTANCE_PROP                                    12
+#define ES_Worker_NUM_INHERITED_PROP                                   0
+
+/*
+    Local slots for methods in type "Worker" 
+ */
+#define ES_Worker_join_workers                                         0
+#define ES_Worker_join_timeout                                         1
+#define ES_Worker_lookup_name                                          0
+
+
+/*
+    Class property slots for the "Event" type 
+ */
+#define ES_Event_NUM_CLASS_PROP                                        0
+
+/*
+   Prototype (instance) slots for "Event" type 
+ */
+#define ES_Event_filename                                              0
+#define ES_Event_lineno                                                1
+#define ES_Event_data                                                  2
+#define ES_Event_message                                               3
+#define ES_Event_stack                                                 4
+#define ES_Event_timestamp                                             5
+#define ES_Event_code                                                  6
+#define ES_Event_formatStack                                           7
+#define ES_Event_NUM_INSTANCE_PROP                                     8
+#define ES_Event_NUM_INHERITED_PROP                                    8
+
+
+/*
+    Class property slots for the "ErrorEvent" type 
+ */
+#define ES_ErrorEvent_NUM_CLASS_PROP                                   0
+
+/*
+   Prototype (instance) slots for "ErrorEvent" type 
+ */
+#define ES_ErrorEvent_filename                                         0
+#define ES_ErrorEvent_lineno                                           1
+#define ES_ErrorEvent_data                                             2
+#define ES_ErrorEvent_message                                          3
+#define ES_ErrorEvent_stack                                            4
+#define ES_ErrorEvent_timestamp                                        5
+#define ES_ErrorEvent_code                                             6
+#define ES_ErrorEvent_formatStack                                      7
+#define ES_ErrorEvent_NUM_INSTANCE_PROP                                8
+#define ES_ErrorEvent_NUM_INHERITED_PROP                               8
+
+
+/*
+    Class property slots for the "XML" type 
+ */
+#define ES_XML__initializer___XML_                                     0
+#define ES_XML_NUM_CLASS_PROP                                          1
+
+/*
+   Prototype (instance) slots for "XML" type 
+ */
+#define ES_XML_load                                                    0
+#define ES_XML_save                                                    1
+#define ES_XML_appendChild                                             2
+#define ES_XML_attribute                                               3
+#define ES_XML_attributes                                              4
+#define ES_XML_child                                                   5
+#define ES_XML_childIndex                                              6
+#define ES_XML_children                                                7
+#define ES_XML_contains                                                8
+#define ES_XML_copy                                                    9
+#define ES_XML_descendants                                             10
+#define ES_XML_elements                                                11
+#define ES_XML_iterator_get                                            12
+#define ES_XML_iterator_getValues                                      13
+#define ES_XML_hasComplexContent                                       14
+#define ES_XML_hasOwnProperty                                          15
+#define ES_XML_hasSimpleContent                                        16
+#define ES_XML_length                                                  17
+#define ES_XML_name                                                    18
+#define ES_XML_parent                                                  19
+#define ES_XML_toJSON                                                  20
+#define ES_XML_toString                                                21
+#define ES_XML_valueOf                                                 22
+#define ES_XML_NUM_INSTANCE_PROP                                       23
+#define ES_XML_NUM_INHERITED_PROP                                      0
+
+
+/*
+    Class property slots for the "XMLHttp" type 
+ */
+#define ES_XMLHttp__initializer___XMLHttp_                             0
+#define ES_XMLHttp_Uninitialized                                       1
+#define ES_XMLHttp_Open                                                2
+#define ES_XMLHttp_Sent                                                3
+#define ES_XMLHttp_Receiving                                           4
+#define ES_XMLHttp_Loaded                                              5
+#define ES_XMLHttp_NUM_CLASS_PROP                                      6
+
+/*
+   Prototype (instance) slots for "XMLHttp" type 
+ */
+#define ES_XMLHttp_hp                                                  0
+#define ES_XMLHttp_state                                               1
+#define ES_XMLHttp_responseBuf                                         2
+#define ES_XMLHttp_onreadystatechange                                  3
+#define ES_XMLHttp_abort                                               4
+#define ES_XMLHttp_http                                                5
+#define ES_XMLHttp_readyState                                          6
+#define ES_XMLHttp_responseText                                        7
+#define ES_XMLHttp_responseXML                                         8
+#define ES_XMLHttp_responseBody                                        9
+#define ES_XMLHttp_status                                              10
+#define ES_XMLHttp_statusText                                          11
+#define ES_XMLHttp_getAllResponseHeaders                               12
+#define ES_XMLHttp_getResponseHeader                                   13
+#define ES_XMLHttp_open                                                14
+#define ES_XMLHttp_send                                                15
+#define ES_XMLHttp_setRequestHeader                                    16
+#define ES_XMLHttp_notify                                              17
+#define ES_XMLHttp_NUM_INSTANCE_PROP                                   18
+#define ES_XMLHttp_NUM_INHERITED_PROP                                  0
+
+
+/*
+    Class property slots for the "XMLList" type 
+ */
+#define ES_XMLList_NUM_CLASS_PROP                                      0
+
+/*
+   Prototype (instance) slots for "XMLList" type 
+ */
+#define ES_XMLList_appendChild                                         0
+#define ES_XMLList_attribute                                           1
+#define ES_XMLList_attributes                                          2
+#define ES_XMLList_child                                               3
+#define ES_XMLList_childIndex                                          4
+#define ES_XMLList_children                                            5
+#define ES_XMLList_copy                                                6
+#define ES_XMLList_descendants                                         7
+#define ES_XMLList_elements                                            8
+#define ES_XMLList_iterator_get                                        9
+#define ES_XMLList_iterator_getValues                                  10
+#define ES_XMLList_hasComplexContent                                   11
+#define ES_XMLList_hasOwnProperty                                      12
+#define ES_XMLList_inScopeNamespaces                                   13
+#define ES_XMLList_length                                              14
+#define ES_XMLList_name                                                15
+#define ES_XMLList_parent                                              16
+#define ES_XMLList_toJSON                                              17
+#define ES_XMLList_toString                                            18
+#define ES_XMLList_valueOf                                             19
+#define ES_XMLList_NUM_INSTANCE_PROP                                   20
+#define ES_XMLList_NUM_INHERITED_PROP                                  0
+
+#define _ES_CHECKSUM_ejs   1607333
+
+#endif
@@ -0,0 +1,288 @@
+/**
+    ejsByteCodeTable.h - Master Byte Code Table
+  
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+#ifndef _h_EJS_BYTECODETABLE_H
+#define _h_EJS_BYTECODETABLE_H 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    Stack effect special values
+ */
+#define EBC_POPN            101             /* Operand 1 specifies the stack change (pop) */
+
+/*
+    Operands
+ */
+#define EBC_NONE            0x0             /* No operands */
+#define EBC_BYTE            0x1             /* 8 bit integer */
+#define EBC_DOUBLE          0x10            /* 64 bit floating */
+#define EBC_NUM             0x40            /* Encoded integer */
+#define EBC_STRING          0x80            /* Interned string as an encoded integer*/
+#define EBC_GLOBAL          0x100           /* Encode global */
+#define EBC_SLOT            0x200           /* Slot number as an encoded integer */
+#define EBC_JMP             0x1000          /* 32 bit jump offset */
+#define EBC_JMP8            0x2000          /* 8 bit jump offset */
+#define EBC_INIT_DEFAULT    0x8000          /* Computed goto table, 32 bit jumps  */
+#define EBC_INIT_DEFAULT8   0x10000         /* Computed goto table, 8 bit jumps */
+#define EBC_ARGC            0x20000         /* Argument count */
+#define EBC_ARGC2           0x40000         /* Argument count * 2 */
+#define EBC_ARGC3           0x80000         /* Argument count * 3 */
+#define EBC_NEW_ARRAY       0x100000        /* New Array: Argument count * 2, byte code */
+#define EBC_NEW_OBJECT      0x200000        /* New Object: Argument count * 3, byte code: attributes * 3 */
+
+typedef struct EjsOptable {
+    char    *name;
+    int     stackEffect;
+    int     args[8];
+} EjsOptable;
+
+#if EJS_DEFINE_OPTABLE
+/*  
+        Opcode string         Stack Effect      Operands, ...                                   
+ */      
+EjsOptable ejsOptable[] = {
+    {   "ADD",                      -1,         { EBC_NONE,                               },},
+    {   "ADD_NAMESPACE",             0,         { EBC_STRING,                             },},
+    {   "ADD_NAMESPACE_REF",        -1,         { EBC_NONE,                               },},
+    {   "AND",                      -1,         { EBC_NONE,                               },},
+    {   "ATTENTION",                -1,         { EBC_NONE,                               },},
+    {   "BRANCH_EQ",                -1,         { EBC_JMP,                                },},
+    {   "BRANCH_STRICTLY_EQ",       -1,         { EBC_JMP,                                },},
+    {   "BRANCH_FALSE",             -1,         { EBC_JMP,                                },},
+    {   "BRANCH_GE",                -1,         { EBC_JMP,                                },},
+    {   "BRANCH_GT",                -1,         { EBC_JMP,                                },},
+    {   "BRANCH_LE",                -1,         { EBC_JMP,                                },},
+    {   "BRANCH_LT",                -1,         { EBC_JMP,                                },},
+    {   "BRANCH_NE",                -1,         { EBC_JMP,                                },},
+    {   "BRANCH_STRICTLY_NE",       -1,         { EBC_JMP,                                },},
+    {   "BRANCH_NULL",              -1,         { EBC_JMP,                                },},
+    {   "BRANCH_NOT_ZERO",          -1,         { EBC_JMP,                                },},
+    {   "BRANCH_TRUE",              -1,         { EBC_JMP,                                },},
+    {   "BRANCH_UNDEFINED",         -1,         { EBC_JMP,                                },},
+    {   "BRANCH_ZERO",              -1,         { EBC_JMP,                                },},
+    {   "BRANCH_FALSE_8",           -1,         { EBC_JMP8,                               },},
+    {   "BRANCH_TRUE_8",            -1,         { EBC_JMP8,                               },},
+    {   "BREAKPOINT",                0,         { EBC_NUM, EBC_STRING,                    },},
+    {   "CALL",                     -2,         { EBC_ARGC,                               },},
+    {   "CALL_GLOBAL_SLOT",          0,         { EBC_SLOT, EBC_ARGC,                     },},
+    {   "CALL_OBJ_SLOT",            -1,         { EBC_SLOT, EBC_ARGC,                     },},
+    {   "CALL_THIS_SLOT",            0,         { EBC_SLOT, EBC_ARGC,                     },},
+    {   "CALL_BLOCK_SLOT",           0,         { EBC_SLOT, EBC_NUM, EBC_ARGC,            },},
+    {   "CALL_OBJ_INSTANCE_SLOT",   -1,         { EBC_SLOT, EBC_ARGC,                     },},
+    {   "CALL_OBJ_STATIC_SLOT",     -1,         { EBC_SLOT, EBC_NUM, EBC_ARGC,            },},
+    {   "CALL_THIS_STATIC_SLOT",     0,         { EBC_SLOT, EBC_NUM, EBC_ARGC,            },},
+    {   "CALL_OBJ_NAME",            -1,         { EBC_STRING, EBC_STRING, EBC_ARGC,       },},
+    {   "CALL_SCOPED_NAME",          0,         { EBC_STRING, EBC_STRING, EBC_ARGC,       },},
+    {   "CALL_CONSTRUCTOR",          0,         { EBC_ARGC,                               },},
+    {   "CALL_NEXT_CONSTRUCTOR",     0,         { EBC_STRING, EBC_STRING, EBC_ARGC,       },},
+    {   "CAST",                     -1,         { EBC_NONE,                               },},
+    {   "CAST_BOOLEAN",              0,         { EBC_NONE,                               },},
+    {   "CLOSE_BLOCK",               0,         { EBC_NONE,                               },},
+    {   "COMPARE_EQ",               -1,         { EBC_NONE,                               },},
+    {   "COMPARE_STRICTLY_EQ",      -1,         { EBC_NONE,                               },},
+    {   "COMPARE_FALSE",            -1,         { EBC_NONE,                               },},
+    {   "COMPARE_GE",               -1,         { EBC_NONE,                               },},
+    {   "COMPARE_GT",               -1,         { EBC_NONE,                               },},
+    {   "COMPARE_LE",               -1,         { EBC_NONE,                               },},
+    {   "COMPARE_LT",               -1,         { EBC_NONE,                               },},
+    {   "COMPARE_NE",               -1,         { EBC_NONE,                               },},
+    {   "COMPARE_STRICTLY_NE",      -1,         { EBC_NONE,                               },},
+    {   "COMPARE_NULL",             -1,         { EBC_NONE,                               },},
+    {   "COMPARE_NOT_ZERO",         -1,         { EBC_NONE,                               },},
+    {   "COMPARE_TRUE",             -1,         { EBC_NONE,                               },},
+    {   "COMPARE_UNDEFINED",        -1,         { EBC_NONE,                               },},
+    {   "COMPARE_ZERO",             -1,         { EBC_NONE,                               },},
+    {   "DEFINE_CLASS",              0,         { EBC_GLOBAL,                             },},
+    {   "DEFINE_FUNCTION",           0,         { EBC_STRING, EBC_STRING,                 },},
+    {   "DELETE_NAME_EXPR",         -2,         { EBC_NONE,                               },},
+    {   "DELETE_SCOPED_NAME_EXPR",  -1,         { EBC_NONE,                               },},
+    {   "DIV",                      -1,         { EBC_NONE,                               },},
+    {   "DUP",                       1,         { EBC_NONE,                               },},
+    {   "DUP2",                      2,         { EBC_NONE,                               },},
+    {   "DUP_STACK",                 1,         { EBC_BYTE,                               },},
+    {   "END_CODE",                  0,         { EBC_NONE,                               },},
+    {   "END_EXCEPTION",             0,         { EBC_NONE,                               },},
+    {   "GOTO",                      0,         { EBC_JMP,                                },},
+    {   "GOTO_8",                    0,         { EBC_JMP8,                               },},
+    {   "INC",                       0,         { EBC_BYTE,                               },},
+    {   "INIT_DEFAULT_ARGS",         0,         { EBC_INIT_DEFAULT,                       },},
+    {   "INIT_DEFAULT_ARGS_8",       0,         { EBC_INIT_DEFAULT8,                      },},
+    {   "INST_OF",                  -1,         { EBC_NONE,                               },},
+    {   "IS_A",                     -1,         { EBC_NONE,                               },},
+    {   "LOAD_0",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_1",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_2",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_3",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_4",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_5",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_6",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_7",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_8",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_9",                    1,         { EBC_NONE,                               },},
+    {   "LOAD_DOUBLE",               1,         { EBC_DOUBLE,                             },},
+    {   "LOAD_FALSE",                1,         { EBC_NONE,                               },},
+    {   "LOAD_GLOBAL",               1,         { EBC_NONE,                               },},
+    {   "LOAD_INT",                  1,         { EBC_NUM,                                },},
+    {   "LOAD_M1",                   1,         { EBC_NONE,                               },},
+    {   "LOAD_NAMESPACE",            1,         { EBC_STRING,                             },},
+    {   "LOAD_NULL",                 1,         { EBC_NONE,                               },},
+    {   "LOAD_REGEXP",               1,         { EBC_STRING,                             },},
+    {   "LOAD_STRING",               1,         { EBC_STRING,                             },},
+    {   "LOAD_THIS",                 1,         { EBC_NONE,                               },},
+    {   "LOAD_THIS_LOOKUP",          1,         { EBC_NONE,                               },},
+    {   "LOAD_THIS_BASE",            1,         { EBC_NUM,                                },},
+    {   "LOAD_TRUE",                 1,         { EBC_NONE,                               },},
+    {   "LOAD_UNDEFINED",            1,         { EBC_NONE,                               },},
+    {   "LOAD_XML",                  1,         { EBC_STRING,                             },},
+    {   "GET_LOCAL_SLOT_0",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_1",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_2",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_3",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_4",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_5",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_6",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_7",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_8",          1,         { EBC_NONE,                               },},
+    {   "GET_LOCAL_SLOT_9",          1,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_0",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_1",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_2",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_3",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_4",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_5",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_6",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_7",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_8",            0,         { EBC_NONE,                               },},
+    {   "GET_OBJ_SLOT_9",            0,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_0",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_1",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_2",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_3",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_4",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_5",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_6",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_7",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_8",           1,         { EBC_NONE,                               },},
+    {   "GET_THIS_SLOT_9",           1,         { EBC_NONE,                               },},
+    {   "GET_SCOPED_NAME",           1,         { EBC_STRING, EBC_STRING,                 },},
+    {   "GET_SCOPED_NAME_EXPR",      -1,        { EBC_NONE,                               },},
+    {   "GET_OBJ_NAME",              0,         { EBC_STRING, EBC_STRING,                 },},
+    {   "GET_OBJ_NAME_EXPR",        -2,         { EBC_NONE,                               },},
+    {   "GET_BLOCK_SLOT",            1,         { EBC_SLOT, EBC_NUM,                      },},
+    {   "GET_GLOBAL_SLOT",           1,         { EBC_SLOT,                               },},
+    {   "GET_LOCAL_SLOT",            1,         { EBC_SLOT,                               },},
+    {   "GET_OBJ_SLOT",              0,         { EBC_SLOT,                               },},
+    {   "GET_THIS_SLOT",             1,         { EBC_SLOT,                               },},
+    {   "GET_TYPE_SLOT",             0,         { EBC_SLOT, EBC_NUM,                      },},
+    {   "GET_THIS_TYPE_SLOT",        1,         { EBC_SLOT, EBC_NUM,                      },},
+    {   "IN",                       -1,         { EBC_NONE,                               },},
+    {   "LIKE",                     -1,         { EBC_NONE,                               },},
+    {   "LOGICAL_NOT",               0,         { EBC_NONE,                               },},
+    {   "MUL",                      -1,         { EBC_NONE,                               },},
+    {   "NEG",                       0,         { EBC_NONE,                               },},
+    {   "NEW",                       0,         { EBC_NONE,                               },},
+    {   "NEW_ARRAY",                 1,         { EBC_GLOBAL, EBC_NEW_ARRAY,              },},
+    {   "NEW_OBJECT",                1,         { EBC_GLOBAL, EBC_NEW_OBJECT,             },},
+    {   "NOP",                       0,         { EBC_NONE,                               },},
+    {   "NOT",                       0,         { EBC_NONE,                               },},
+    {   "OPEN_BLOCK",                0,         { EBC_SLOT, EBC_NUM,                      },},
+    {   "OPEN_WITH",                 1,         { EBC_NONE,                               },},
+    {   "OR",                       -1,         { EBC_NONE,                               },},
+    {   "POP",                      -1,         { EBC_NONE,                               },},
+    {   "POP_ITEMS",          EBC_POPN,         { EBC_BYTE,                               },},
+    {   "PUSH_CATCH_ARG",            1,         { EBC_NONE,                               },},
+    {   "PUSH_RESULT",               1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_0",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_1",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_2",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_3",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_4",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_5",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_6",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_7",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_8",         -1,         { EBC_NONE,                               },},
+    {   "PUT_LOCAL_SLOT_9",         -1,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_0",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_1",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_2",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_3",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_4",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_5",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_6",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_7",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_8",           -2,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_SLOT_9",           -2,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_0",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_1",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_2",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_3",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_4",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_5",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_6",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_7",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_8",          -1,         { EBC_NONE,                               },},
+    {   "PUT_THIS_SLOT_9",          -1,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_NAME_EXPR",        -4,         { EBC_NONE,                               },},
+    {   "PUT_OBJ_NAME",             -2,         { EBC_STRING, EBC_STRING,                 },},
+    {   "PUT_SCOPED_NAME",          -1,         { EBC_STRING, EBC_STRING,                 },},
+    {   "PUT_SCOPED_NAME_EXPR",     -3,         { EBC_NONE,                               },},
+    {   "PUT_BLOCK_SLOT",           -1,         { EBC_SLOT, EBC_NUM,                      },},
+    {   "PUT_GLOBAL_SLOT",          -1,         { EBC_SLOT,                               },},
+    {   "PUT_LOCAL_SLOT",           -1,         { EBC_SLOT,                               },},
+    {   "PUT_OBJ_SLOT",             -2,         { EBC_SLOT,                               },},
+    {   "PUT_THIS_SLOT",            -1,         { EBC_SLOT,                               },},
+    {   "PUT_TYPE_SLOT",            -2,         { EBC_SLOT, EBC_NUM,                      },},
+    {   "PUT_THIS_TYPE_SLOT",       -1,         { EBC_SLOT, EBC_NUM,                      },},
+    {   "REM",                      -1,         { EBC_NONE,                               },},
+    {   "RETURN",                    0,         { EBC_NONE,                               },},
+    {   "RETURN_VALUE",             -1,         { EBC_NONE,                               },},
+    {   "SAVE_RESULT",              -1,         { EBC_NONE,                               },},
+    {   "SHL",                      -1,         { EBC_NONE,                               },},
+    {   "SHR",                      -1,         { EBC_NONE,                               },},
+    {   "SPREAD",                    0,         { EBC_NONE,                               },},
+    {   "SUB",                      -1,         { EBC_NONE,                               },},
+    {   "SUPER",                     0,         { EBC_NONE,                               },},
+    {   "SWAP",                      0,         { EBC_NONE,                               },},
+    {   "THROW",                     0,         { EBC_NONE,                               },},
+    {   "TYPE_OF",                  -1,         { EBC_NONE,                               },},
+    {   "USHR",                     -1,         { EBC_NONE,                               },},
+    {   "XOR",                      -1,         { EBC_NONE,                               },},
+    {   "CALL_FINALLY",              0,         { EBC_NONE,                               },},
+    {   "GOTO_FINALLY",              0,         { EBC_NONE,                               },},
+    {   0,                           0,         { EBC_NONE,                               },},
+};
+#endif /* EJS_DEFINE_OPTABLE */
+
+PUBLIC EjsOptable *ejsGetOptable();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _h_EJS_BYTECODETABLE_H */
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a 
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -3489,6 +3489,7 @@ static MprFile *openModuleFile(EcCompiler *cp, cchar *filename)
         genError(cp, 0, "Cannot create module file \"%s\"", filename);
         return 0;
     }
+    ejsRemoveModuleImage(filename);
 
     /*
         Create a module header once per file instead of per-module in the file
@@ -425,6 +425,7 @@ FUTURE & KEEP
             Chunked encoding will be used if the total body content length is unknown at the time the request headers 
             must be emitted. The Http class will typically buffer output until $flush is called and will often be able 
             to determine the content length even if a Content-Length header has not been explicitly defined. 
+            @option form Maximum size of form data, including multipart form fields. Limited to the receive size.
             @option headers Maximum number of headers in a response.
             @option header Maximum size of response headers.
             @option inactivityTimeout Maximum time in seconds to keep a connection open if idle. Set to zero for no timeout.
@@ -84,6 +84,13 @@ module ejs {
          */
         public static function load(id: String, path: Path, config = App.config, codeReader: Function? = null): Object {
             let initializer, code
+            if (path && initializers[path] && timestamps[path] &&
+                    (!config.cache.app.reload || path.modified <= timestamps[path])) {
+                /* Loaded and unmodified since. Skip the module cache file checks */
+                signatures[path] = exports = {}
+                initializers[path](require, exports, {id: id, path: path}, null)
+                return exports
+            }
             let cache: Path? = cached(id, config)
             if (path) {
                 if (cache && cache.exists && (!config.cache.app.reload || cache.modified > path.modified)) {
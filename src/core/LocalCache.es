@@ -56,6 +56,9 @@ module ejs {
             @option keys Maximum number of keys in the cache.
             @option lifespan Default time to preserve key data in seconds. Set to zero for an unlimited default timeout.
             @option memory Maximum memory to use for keys and data.
+            @option hits Number of reads that returned data. This is a read-only statistic.
+            @option misses Number of reads for missing or expired keys. This is a read-only statistic.
+            @option evictions Number of keys removed to honor the keys and memory limits. This is a read-only statistic.
             @see setLimits
           */
         native function get limits(): Object
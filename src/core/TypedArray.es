@@ -0,0 +1,277 @@
+/*
+    TypedArray.es - Float64Array, Int32Array and Uint8Array classes
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+module ejs {
+
+    /**
+        Float64Array provides a fixed length, integer indexed array of 64-bit IEEE floating point numbers.
+
+        Typed arrays store their elements as contiguous native numbers in the storage of a ByteArray.
+        The byte array may be supplied to the constructor in which case the typed array is a view over the byte array
+        and modifications made via either object are visible via the other. Elements are stored in the native byte
+        order of the system and the ByteArray endian setting is ignored. Several typed arrays may share one ByteArray.
+
+        The index operator [] can be used to access individual elements. Native bulk methods such as $fill,
+        $copyWithin, $sum, $min, $max and $map operate on the element storage directly without creating
+        intermediate Number objects per element.
+        @spec ejs
+        @stability prototype
+     */
+    final class Float64Array {
+
+        use default namespace public
+
+        /**
+            Size of each element in bytes
+         */
+        static const BYTES_PER_ELEMENT: Number = 8
+
+        /**
+            Create a new typed array.
+            @param data Initial data. If data is a Number, a new zeroed array of that many elements is created.
+                If data is a ByteArray, the typed array is created as a view over the byte array storage. If data is
+                an Array or another typed array, a new array is created and the elements are converted and copied.
+            @param byteOffset Offset in bytes into the byte array at which the view starts. Must be a multiple of
+                $BYTES_PER_ELEMENT. Only used if data is a ByteArray.
+            @param length Number of elements in the view. Set to -1 to use the rest of the byte array.
+                Only used if data is a ByteArray.
+            @throws ArgError if the byteOffset is not aligned or if the view does not fit in the byte array.
+         */
+        native function Float64Array(data: Object = 0, byteOffset: Number = 0, length: Number = -1)
+
+        /**
+            ByteArray providing the element storage for this array
+         */
+        native function get buffer(): ByteArray
+
+        /**
+            Length of the array view in bytes
+         */
+        native function get byteLength(): Number
+
+        /**
+            Offset in bytes from the start of the buffer to the first element
+         */
+        native function get byteOffset(): Number
+
+        /**
+            Copy a range of elements within the array. Overlapping ranges are handled correctly.
+            @param target Index at which to copy the elements
+            @param start Index of the first element to copy
+            @param end Index one past the last element to copy. Set to -1 for the end of the array.
+            @return This array
+         */
+        native function copyWithin(target: Number, start: Number = 0, end: Number = -1): Float64Array
+
+        /**
+            Set a range of elements to a value
+            @param value Value to assign
+            @param start Index of the first element to set
+            @param end Index one past the last element to set. Set to -1 for the end of the array.
+            @return This array
+         */
+        native function fill(value: Number, start: Number = 0, end: Number = -1): Float64Array
+
+        /**
+            Iterator for this array to be used by "for (v in array)"
+            @return An iterator object.
+         */
+        override iterator native function get(): Iterator
+
+        /**
+            Iterator for this array to be used by "for each (v in array)"
+            @return An iterator object.
+         */
+        override iterator native function getValues(): Iterator
+
+        /**
+            Number of elements in the array
+         */
+        native function get length(): Number
+
+        /**
+            Transform the elements of the array in place.
+            @param kernel Either a Function or the name of a native numeric kernel. Native kernels are applied
+                without calling into script and are: "abs", "add", "ceil", "div", "floor", "max", "min", "mul", "neg",
+                "round", "sqrt" and "sub". The binary kernels use operand as their right hand side.
+                If a function is supplied, it is invoked for each element with the signature:
+                    function kernel(value: Number, index: Number, array: Float64Array): Number
+            @param operand Right hand operand for binary native kernels
+            @return This array
+            @throws ArgError if the kernel name is unknown
+         */
+        native function map(kernel: Object, operand: Number = 0): Float64Array
+
+        /**
+            Return the largest element in the array. Returns -Infinity if the array is empty.
+         */
+        native function max(): Number
+
+        /**
+            Return the smallest element in the array. Returns Infinity if the array is empty.
+         */
+        native function min(): Number
+
+        /**
+            Return the sum of all elements in the array
+         */
+        native function sum(): Number
+
+        /**
+            Convert the elements to a regular Array of Numbers
+            @return A new Array
+         */
+        native function toArray(): Array
+
+        /**
+            Convert the array to a string of comma separated elements
+            @return A string
+         */
+        override native function toString(): String
+    }
+
+
+    /**
+        Int32Array provides a fixed length, integer indexed array of signed 32-bit integers. Values assigned to
+        elements are truncated to integers and wrap modulo 2^32.
+        @see Float64Array
+        @spec ejs
+        @stability prototype
+     */
+    final class Int32Array {
+
+        use default namespace public
+
+        /** @duplicate Float64Array.BYTES_PER_ELEMENT */
+        static const BYTES_PER_ELEMENT: Number = 4
+
+        /** @duplicate Float64Array.Float64Array */
+        native function Int32Array(data: Object = 0, byteOffset: Number = 0, length: Number = -1)
+
+        /** @duplicate Float64Array.buffer */
+        native function get buffer(): ByteArray
+
+        /** @duplicate Float64Array.byteLength */
+        native function get byteLength(): Number
+
+        /** @duplicate Float64Array.byteOffset */
+        native function get byteOffset(): Number
+
+        /** @duplicate Float64Array.copyWithin */
+        native function copyWithin(target: Number, start: Number = 0, end: Number = -1): Int32Array
+
+        /** @duplicate Float64Array.fill */
+        native function fill(value: Number, start: Number = 0, end: Number = -1): Int32Array
+
+        /** @duplicate Float64Array.get */
+        override iterator native function get(): Iterator
+
+        /** @duplicate Float64Array.getValues */
+        override iterator native function getValues(): Iterator
+
+        /** @duplicate Float64Array.length */
+        native function get length(): Number
+
+        /** @duplicate Float64Array.map */
+        native function map(kernel: Object, operand: Number = 0): Int32Array
+
+        /** @duplicate Float64Array.max */
+        native function max(): Number
+
+        /** @duplicate Float64Array.min */
+        native function min(): Number
+
+        /** @duplicate Float64Array.sum */
+        native function sum(): Number
+
+        /** @duplicate Float64Array.toArray */
+        native function toArray(): Array
+
+        /** @duplicate Float64Array.toString */
+        override native function toString(): String
+    }
+
+
+    /**
+        Uint8Array provides a fixed length, integer indexed array of unsigned 8-bit integers. Values assigned to
+        elements are truncated to integers and wrap modulo 256.
+        @see Float64Array
+        @spec ejs
+        @stability prototype
+     */
+    final class Uint8Array {
+
+        use default namespace public
+
+        /** @duplicate Float64Array.BYTES_PER_ELEMENT */
+        static const BYTES_PER_ELEMENT: Number = 1
+
+        /** @duplicate Float64Array.Float64Array */
+        native function Uint8Array(data: Object = 0, byteOffset: Number = 0, length: Number = -1)
+
+        /** @duplicate Float64Array.buffer */
+        native function get buffer(): ByteArray
+
+        /** @duplicate Float64Array.byteLength */
+        native function get byteLength(): Number
+
+        /** @duplicate Float64Array.byteOffset */
+        native function get byteOffset(): Number
+
+        /** @duplicate Float64Array.copyWithin */
+        native function copyWithin(target: Number, start: Number = 0, end: Number = -1): Uint8Array
+
+        /** @duplicate Float64Array.fill */
+        native function fill(value: Number, start: Number = 0, end: Number = -1): Uint8Array
+
+        /** @duplicate Float64Array.get */
+        override iterator native function get(): Iterator
+
+        /** @duplicate Float64Array.getValues */
+        override iterator native function getValues(): Iterator
+
+        /** @duplicate Float64Array.length */
+        native function get length(): Number
+
+        /** @duplicate Float64Array.map */
+        native function map(kernel: Object, operand: Number = 0): Uint8Array
+
+        /** @duplicate Float64Array.max */
+        native function max(): Number
+
+        /** @duplicate Float64Array.min */
+        native function min(): Number
+
+        /** @duplicate Float64Array.sum */
+        native function sum(): Number
+
+        /** @duplicate Float64Array.toArray */
+        native function toArray(): Array
+
+        /** @duplicate Float64Array.toString */
+        override native function toString(): String
+    }
+}
+
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -198,6 +198,16 @@
     #define MULTIPLE_THREADS 1
     PUBLIC void ejsLockDtoa(int n);
     PUBLIC void ejsUnlockDtoa(int n);
+    /*
+        Keep the Bigint free lists per-thread where the compiler supports thread local storage. Conversions then
+        only take a lock when allocating new Bigints from the shared private memory pool or growing the shared 
+        powers of 5 cache. Bigints cached by a thread are not reclaimed if the thread exits.
+     */
+    #if ME_WIN_LIKE
+        #define DTOA_THREAD_LOCAL __declspec(thread)
+    #elif (__GNUC__ || __clang__) && !VXWORKS
+        #define DTOA_THREAD_LOCAL __thread
+    #endif
     #if WINDOWS || WINCE
         typedef int int32_t;
         typedef unsigned int uint32_t;
@@ -562,6 +572,22 @@ BCinfo { int dp0, dp1, dplen, dsign, e0, inexact, nd, nd0, rounding, scale, uflc
 #define FREE_DTOA_LOCK(n) ejsUnlockDtoa(n);
 #endif
 
+#if defined(MULTIPLE_THREADS) && defined(DTOA_THREAD_LOCAL)
+/* Free lists are per-thread and only the shared private memory pool needs locking */
+#define ACQUIRE_FREELIST_LOCK()     /*nothing*/
+#define FREE_FREELIST_LOCK()        /*nothing*/
+#define ACQUIRE_POOL_LOCK()         ACQUIRE_DTOA_LOCK(0)
+#define FREE_POOL_LOCK()            FREE_DTOA_LOCK(0)
+#else
+#ifndef DTOA_THREAD_LOCAL
+#define DTOA_THREAD_LOCAL
+#endif
+#define ACQUIRE_FREELIST_LOCK()     ACQUIRE_DTOA_LOCK(0)
+#define FREE_FREELIST_LOCK()        FREE_DTOA_LOCK(0)
+#define ACQUIRE_POOL_LOCK()         /*nothing*/
+#define FREE_POOL_LOCK()            /*nothing*/
+#endif
+
 #define Kmax 7
 
 #ifdef __cplusplus
@@ -579,7 +605,7 @@ Bigint {
 
  typedef struct Bigint Bigint;
 
- static Bigint *freelist[Kmax+1];
+ static DTOA_THREAD_LOCAL Bigint *freelist[Kmax+1];
 
  static Bigint *
 Balloc
@@ -595,7 +621,7 @@ Balloc
     unsigned int len;
 #endif
 
-    ACQUIRE_DTOA_LOCK(0);
+    ACQUIRE_FREELIST_LOCK();
     /* The k > Kmax case does not need ACQUIRE_DTOA_LOCK(0), */
     /* but this case seems very unlikely. */
     if (k <= Kmax && (rv = freelist[k]))
@@ -606,16 +632,18 @@ Balloc
         rv = (Bigint *)MALLOC(sizeof(Bigint) + (x-1)*sizeof(ULong));
 #else
         len = (unsigned int) ((sizeof(Bigint) + (x-1)*sizeof(ULong) + sizeof(double) - 1) / sizeof(double));
+        ACQUIRE_POOL_LOCK();
         if (k <= Kmax && pmem_next - private_mem + len <= PRIVATE_mem) {
             rv = (Bigint*)pmem_next;
             pmem_next += len;
         } else
             rv = (Bigint*)MALLOC(len*sizeof(double));
+        FREE_POOL_LOCK();
 #endif
         rv->k = k;
         rv->maxwds = x;
         }
-    FREE_DTOA_LOCK(0);
+    FREE_FREELIST_LOCK();
     rv->sign = rv->wds = 0;
     return rv;
     }
@@ -636,10 +664,10 @@ Bfree
             free((void*)v);
 #endif
         else {
-            ACQUIRE_DTOA_LOCK(0);
+            ACQUIRE_FREELIST_LOCK();
             v->next = freelist[v->k];
             freelist[v->k] = v;
-            FREE_DTOA_LOCK(0);
+            FREE_FREELIST_LOCK();
             }
         }
     }
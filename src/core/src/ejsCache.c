@@ -47,6 +47,7 @@ PUBLIC EjsAny *ejsCacheReadObj(Ejs *ejs, EjsObj *cache, EjsString *key, EjsObj *
     argv[0] = key;
     argv[1] = (options) ? options : ESV(null);
     if ((value = ejsRunFunctionBySlot(ejs, cache, ES_Cache_read, 2, argv)) == 0 || value == ESV(null)) {
+        ejsUnblockGC(ejs, prior);
         return 0;
     }
     result = ejsDeserialize(ejs, value);
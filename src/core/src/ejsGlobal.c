@@ -170,7 +170,7 @@ static EjsString *g_md5(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
     char        *hash;
 
     str = (EjsString*) argv[0];
-    hash = mprGetMD5WithPrefix(ejsToMulti(ejs, str), str->length, NULL);
+    hash = mprGetMD5WithPrefix(ejsGetMulti(ejs, str), str->length, NULL);
     return ejsCreateStringFromAsc(ejs, hash);
 }
 
@@ -448,7 +448,7 @@ static EjsObj *g_printLine(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
             if (ejs->exception) {
                 return 0;
             }
-            data = ejsToMulti(ejs, s);
+            data = ejsGetMulti(ejs, s);
             if (write(1, (char*) data, (int) strlen(data)) < 0) {}
             if ((i+1) < count) {
                 if (write(1, " ", 1) < 0) {}
@@ -463,10 +463,10 @@ static EjsObj *g_printLine(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
 static EjsString *g_base64(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
 {
     EjsString   *bstring;
-    char        *str;
+    cchar       *str;
 
     bstring = ejsToString(ejs, argv[0]);
-    str = ejsToMulti(ejs, bstring);
+    str = ejsGetMulti(ejs, bstring);
     return ejsCreateStringFromAsc(ejs, mprEncode64Block(str, bstring->length));
 }
 
@@ -263,7 +263,7 @@ static EjsHttp *http_form(Ejs *ejs, EjsHttp *hp, int argc, EjsObj **argv)
         if (ejsGetLength(ejs, data) > 0) {
             prepForm(ejs, hp, NULL, data);
         } else {
-            mprPutStringToBuf(hp->requestContent, ejsToMulti(ejs, data));
+            mprPutStringToBuf(hp->requestContent, ejsGetMulti(ejs, data));
         }
         mprAddNullToBuf(hp->requestContent);
         httpSetHeader(hp->conn, "Content-Type", "application/x-www-form-urlencoded");
@@ -797,6 +797,7 @@ static EjsObj *http_setLimits(Ejs *ejs, EjsHttp *hp, int argc, EjsObj **argv)
     }
     ejsBlendObject(ejs, hp->limits, argv[0], EJS_BLEND_OVERWRITE);
     ejsSetHttpLimits(ejs, hp->conn->limits, hp->limits, 0);
+    httpSetConnTimer(hp->conn);
     return 0;
 }
 
@@ -1299,7 +1300,7 @@ static void prepForm(Ejs *ejs, EjsHttp *hp, cchar *prefix, EjsObj *data)
             } else {
                 encodedKey = mprUriEncode(key, MPR_ENCODE_URI_COMPONENT);
             }
-            vstr = ejsToMulti(ejs, value);
+            vstr = ejsGetMulti(ejs, value);
             encodedValue = mprUriEncode(vstr, MPR_ENCODE_URI_COMPONENT);
             mprPutToBuf(hp->requestContent, "%s%s=%s", sep, encodedKey, encodedValue);
         }
@@ -1496,6 +1497,7 @@ PUBLIC void ejsGetHttpLimits(Ejs *ejs, EjsObj *obj, HttpLimits *limits, bool ser
 {
     ejsSetPropertyByName(ejs, obj, EN("chunk"), ejsCreateNumber(ejs, (MprNumber) limits->chunkSize));
     ejsSetPropertyByName(ejs, obj, EN("connReuse"), ejsCreateNumber(ejs, limits->keepAliveMax));
+    ejsSetPropertyByName(ejs, obj, EN("form"), ejsCreateNumber(ejs, (MprNumber) limits->receiveFormSize));
     ejsSetPropertyByName(ejs, obj, EN("receive"), ejsCreateNumber(ejs, (MprNumber) limits->receiveBodySize));
     ejsSetPropertyByName(ejs, obj, EN("transmission"), ejsCreateNumber(ejs, (MprNumber) limits->transmissionBodySize));
     ejsSetPropertyByName(ejs, obj, EN("upload"), ejsCreateNumber(ejs, (MprNumber) limits->uploadSize));
@@ -1538,8 +1540,10 @@ PUBLIC void ejsSetHttpLimits(Ejs *ejs, HttpLimits *limits, EjsObj *obj, bool ser
     limits->chunkSize = (ssize) setLimit(ejs, obj, "chunk", 1);
     limits->inactivityTimeout = (int) setLimit(ejs, obj, "inactivityTimeout", MPR_TICKS_PER_SEC);
     limits->receiveBodySize = (MprOff) setLimit(ejs, obj, "receive", 1);
-    //  TODO - need dedicated "form" limit
-    limits->receiveFormSize = (MprOff) setLimit(ejs, obj, "receive", 1);
+    limits->receiveFormSize = (MprOff) setLimit(ejs, obj, "form", 1);
+    if (limits->receiveFormSize <= 0 || limits->receiveFormSize > limits->receiveBodySize) {
+        limits->receiveFormSize = limits->receiveBodySize;
+    }
     limits->keepAliveMax = (int) setLimit(ejs, obj, "connReuse", 1);
     limits->requestTimeout = (int) setLimit(ejs, obj, "requestTimeout", MPR_TICKS_PER_SEC);
     limits->sessionTimeout = (int) setLimit(ejs, obj, "sessionTimeout", MPR_TICKS_PER_SEC);
@@ -536,7 +536,6 @@ static EjsString *serialize(Ejs *ejs, EjsAny *vp, Json *json)
     EjsTrait    *trait;
     EjsObj      *pp, *obj, *replacerArgs[2];
     wchar       *cp;
-    cchar       *key;
     int         c, isArray, i, count, slotNum, quotes, sameline, items;
 
     /*
@@ -586,8 +585,7 @@ static EjsString *serialize(Ejs *ejs, EjsAny *vp, Json *json)
                 continue;
             }
             if (isArray) {
-                key = itos(slotNum);
-                qname.name = ejsCreateStringFromAsc(ejs, key);
+                qname.name = ejsCreateStringFromInt(ejs, slotNum);
                 qname.space = ESV(empty);
             } else {
                 qname = ejsGetPropertyName(ejs, vp, slotNum);
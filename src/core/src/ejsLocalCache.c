@@ -8,23 +8,63 @@
 
 #include    "ejs.h"
 
+
 /************************************ Locals **********************************/
 
 //  TODO - should this be refactored to use MprCache?
 
 #define CACHE_TIMER_PERIOD  (60 * MPR_TICKS_PER_SEC)
-#define CACHE_HASH_SIZE     257
+#define CACHE_HASH_SIZE     31
 #define CACHE_LIFESPAN      (86400 * MPR_TICKS_PER_SEC)
 
+/*
+    The store is split into independently locked shards selected by key hash. Each shard keeps an intrusive LRU list
+    for eviction and a hierarchical timing wheel for expiry. Wheel slots at level N span 64^N seconds.
+ */
+#define CACHE_SHARDS        16                          /* Number of shards (power of 2) */
+#define CACHE_WHEEL_BITS    6
+#define CACHE_WHEEL_SIZE    (1 << CACHE_WHEEL_BITS)     /* Slots per wheel level */
+#define CACHE_WHEEL_MASK    (CACHE_WHEEL_SIZE - 1)
+#define CACHE_WHEEL_LEVELS  4                           /* Levels before items are parked on the overflow list */
+#define CACHE_WHEEL_TICK    MPR_TICKS_PER_SEC           /* Wheel granularity */
+
+typedef struct CacheItem
+{
+    EjsString   *key;                   /* Original key */
+    EjsString   *data;                  /* Cache data */
+    MprTime     expires;                /* Fixed expiry date. If zero, key is imortal. */
+    MprTicks    lifespan;               /* Lifespan after each access to key (msec) */
+    int64       version;
+    struct CacheItem *prev;             /* LRU list. Most recently used items are at the head */
+    struct CacheItem *next;
+    struct CacheItem *wnext;            /* Expiry wheel slot list */
+    struct CacheItem **wprev;           /* Reference to this item in the slot list */
+} CacheItem;
+
+typedef struct CacheShard
+{
+    MprHash     *store;                 /* Key/value store */
+    MprMutex    *mutex;                 /* Shard lock */
+    CacheItem   *head;                  /* Most recently used item */
+    CacheItem   *tail;                  /* Least recently used item */
+    CacheItem   *wheel[CACHE_WHEEL_LEVELS][CACHE_WHEEL_SIZE];
+    CacheItem   *overflow;              /* Items expiring beyond the wheel span */
+    MprTime     wheelTick;              /* Next wheel tick to expire */
+    int64       hits;                   /* Reads returning data */
+    int64       misses;                 /* Reads of missing or expired keys */
+    int64       evictions;              /* Items removed to honor the key and memory limits */
+} CacheShard;
+
 typedef struct EjsLocalCache
 {
     EjsObj          obj;                /* Object base */
-    MprHash         *store;             /* Key/value store */
-    MprMutex        *mutex;             /* Cache lock */
+    CacheShard      *shards[CACHE_SHARDS];
+    MprMutex        *mutex;             /* Lock for the pruning timer */
     MprEvent        *timer;             /* Pruning timer */
     MprTicks        lifespan;           /* Default lifespan (msec) */
     int             resolution;         /* Frequence for pruner */
-    ssize           usedMem;            /* Memory in use for keys and data */
+    volatile int64  keyCount;           /* Number of keys over all shards */
+    volatile int64  usedMem;            /* Memory in use for keys and data */
     ssize           maxKeys;            /* Max number of keys */
     ssize           maxMem;             /* Max memory for session data */
     struct EjsLocalCache *shared;       /* Shared common cache */
@@ -32,22 +72,20 @@ typedef struct EjsLocalCache
 
 static EjsLocalCache *shared;           /* Singleton shared cache */
 
-typedef struct CacheItem
-{
-    EjsString   *key;                   /* Original key */
-    EjsString   *data;                  /* Cache data */
-    MprTime     expires;                /* Fixed expiry date. If zero, key is imortal. */
-    MprTicks    lifespan;               /* Lifespan after each access to key (msec) */
-    int64       version;
-} CacheItem;
-
 /*********************************** Forwards *********************************/
 
+static void addItem(EjsLocalCache *cache, CacheShard *shard, CacheItem *item);
+static void createShards(EjsLocalCache *cache);
+static void evictItems(EjsLocalCache *cache, CacheShard *shard, CacheItem *keep);
 static void localPruner(EjsLocalCache *cache, MprEvent *event);
-static void manageLocalCache(EjsLocalCache *cache, int flags);
 static void manageCacheItem(CacheItem *item, int flags);
-static void removeItem(EjsLocalCache *cache, CacheItem *item);
+static void manageCacheShard(CacheShard *shard, int flags);
+static void manageLocalCache(EjsLocalCache *cache, int flags);
+static void removeItem(EjsLocalCache *cache, CacheShard *shard, CacheItem *item);
+static void scheduleItem(CacheShard *shard, CacheItem *item);
 static void setLocalLimits(Ejs *ejs, EjsLocalCache *cache, EjsPot *options);
+static void startPruner(EjsLocalCache *cache);
+static void touchItem(CacheShard *shard, CacheItem *item);
 
 /************************************* Code ***********************************/
 /*
@@ -65,7 +103,7 @@ static EjsLocalCache *localConstructor(Ejs *ejs, EjsLocalCache *cache, int argc,
         cache->shared = shared;
     } else {
         cache->mutex = mprCreateLock();
-        cache->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+        createShards(cache);
         cache->maxMem = MAXSSIZE;
         cache->maxKeys = MAXSSIZE;
         cache->resolution = CACHE_TIMER_PERIOD;
@@ -79,6 +117,52 @@ static EjsLocalCache *localConstructor(Ejs *ejs, EjsLocalCache *cache, int argc,
 }
 
 
+static void createShards(EjsLocalCache *cache)
+{
+    CacheShard  *shard;
+    int         i;
+
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        if ((shard = mprAllocObj(CacheShard, manageCacheShard)) == 0) {
+            return;
+        }
+        shard->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+        shard->mutex = mprCreateLock();
+        shard->wheelTick = mprGetTime() / CACHE_WHEEL_TICK;
+        cache->shards[i] = shard;
+    }
+}
+
+
+/*
+    Add a new item to a shard. Caller must hold the shard lock.
+ */
+static void addItem(EjsLocalCache *cache, CacheShard *shard, CacheItem *item)
+{
+    if (shard->head == 0) {
+        /* The wheel is empty, so skip any idle wheel ticks */
+        shard->wheelTick = mprGetTime() / CACHE_WHEEL_TICK;
+    }
+    //  UNICODE
+    mprAddKey(shard->store, item->key->value, item);
+    mprAtomicAdd64(&cache->keyCount, 1);
+    touchItem(shard, item);
+}
+
+
+static CacheShard *getShard(EjsLocalCache *cache, EjsString *key)
+{
+    //  UNICODE
+    return cache->shards[shash(key->value, key->length) & (CACHE_SHARDS - 1)];
+}
+
+
+static int overLimits(EjsLocalCache *cache)
+{
+    return cache->keyCount > cache->maxKeys || cache->usedMem > cache->maxMem;
+}
+
+
 static EjsVoid *sl_destroy(Ejs *ejs, EjsLocalCache *cache, int argc, EjsObj **argv)
 {
     if (cache->timer && cache != shared) {
@@ -99,6 +183,7 @@ static EjsAny *sl_expire(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv
 {
     EjsString   *key;
     EjsDate     *expires;
+    CacheShard  *shard;
     CacheItem   *item;
 
     if (cache->shared) {
@@ -107,20 +192,22 @@ static EjsAny *sl_expire(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv
     }
     key = argv[0];
     expires = argv[1];
+    shard = getShard(cache, key);
 
-    lock(cache);
+    lock(shard);
     //  UNICODE
-    if ((item = mprLookupKey(cache->store, key->value)) == 0) {
-        unlock(cache);
+    if ((item = mprLookupKey(shard->store, key->value)) == 0) {
+        unlock(shard);
         return ESV(false);
     }
     item->lifespan = 0;
     if (expires == ESV(null)) {
-        removeItem(cache, item);
+        removeItem(cache, shard, item);
     } else {
         item->expires = ejsGetDate(ejs, expires);
+        scheduleItem(shard, item);
     }
-    unlock(cache);
+    unlock(shard);
     return ESV(true);
 }
 
@@ -130,7 +217,8 @@ static EjsAny *sl_expire(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv
  */
 static EjsAny *sl_inc(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
 {
-    EjsString   *key;
+    EjsString   *key, *data;
+    CacheShard  *shard;
     CacheItem   *item;
     int64       amount;
 
@@ -140,27 +228,36 @@ static EjsAny *sl_inc(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
     }
     key = argv[0];
     amount = (argc >= 2) ? ejsGetInt(ejs, argv[1]) : 1;
+    shard = getShard(cache, key);
 
-    lock(cache);
+    lock(shard);
     //  UNICODE
-    if ((item = mprLookupKey(cache->store, key->value)) == 0) {
+    if ((item = mprLookupKey(shard->store, key->value)) == 0) {
         if ((item = mprAllocObj(CacheItem, manageCacheItem)) == 0) {
-            unlock(cache);
+            unlock(shard);
             ejsThrowMemoryError(ejs);
             return 0;
         }
+        item->key = key;
+        item->lifespan = cache->lifespan;
+        addItem(cache, shard, item);
+        mprAtomicAdd64(&cache->usedMem, key->length);
     } else {
         amount += stoi(item->data->value);
+        mprAtomicAdd64(&cache->usedMem, -item->data->length);
     }
-    if (item->data) {
-        cache->usedMem -= item->data->length;
+    item->data = data = ejsCreateStringFromInt(ejs, amount);
+    mprAtomicAdd64(&cache->usedMem, item->data->length);
+    if (item->lifespan) {
+        item->expires = mprGetTime() + item->lifespan;
+        scheduleItem(shard, item);
     }
-    item->data = ejsCreateStringFromAsc(ejs, itos(amount));
-    cache->usedMem += item->data->length;
-    item->expires = mprGetTime() + item->lifespan;
     item->version++;
-    unlock(cache);
-    return item->data;
+    touchItem(shard, item);
+    evictItems(cache, shard, item);
+    unlock(shard);
+    startPruner(cache);
+    return data;
 }
 
 
@@ -170,11 +267,21 @@ static EjsAny *sl_inc(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
 static EjsPot *sl_limits(Ejs *ejs, EjsLocalCache *cache, int argc, EjsObj **argv)
 {
     EjsPot      *result;
+    CacheShard  *shard;
+    int64       hits, misses, evictions;
+    int         i;
 
     if (cache->shared) {
         cache = cache->shared;
         assert(cache == shared);
     }
+    hits = misses = evictions = 0;
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        shard = cache->shards[i];
+        hits += shard->hits;
+        misses += shard->misses;
+        evictions += shard->evictions;
+    }
     result = ejsCreateEmptyPot(ejs);
     ejsSetPropertyByName(ejs, result, EN("keys"), 
         ejsCreateNumber(ejs, (MprNumber) (cache->maxKeys == MAXSSIZE ? 0 : cache->maxKeys)));
@@ -182,6 +289,9 @@ static EjsPot *sl_limits(Ejs *ejs, EjsLocalCache *cache, int argc, EjsObj **argv
         ejsCreateNumber(ejs, (MprNumber) (cache->lifespan / MPR_TICKS_PER_SEC)));
     ejsSetPropertyByName(ejs, result, EN("memory"), 
         ejsCreateNumber(ejs, (MprNumber) (cache->maxMem == MAXSSIZE ? 0 : cache->maxMem)));
+    ejsSetPropertyByName(ejs, result, EN("hits"), ejsCreateNumber(ejs, (MprNumber) hits));
+    ejsSetPropertyByName(ejs, result, EN("misses"), ejsCreateNumber(ejs, (MprNumber) misses));
+    ejsSetPropertyByName(ejs, result, EN("evictions"), ejsCreateNumber(ejs, (MprNumber) evictions));
     return result;
 }
 
@@ -194,6 +304,7 @@ static EjsAny *sl_read(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
     EjsString   *key;
     EjsAny      *result;
     EjsPot      *options;
+    CacheShard  *shard;
     CacheItem   *item;
     int         getVersion;
 
@@ -208,14 +319,18 @@ static EjsAny *sl_read(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
         options = argv[1];
         getVersion = ejsGetPropertyByName(ejs, options, EN("version")) == ESV(true);
     }
-    lock(cache);
+    shard = getShard(cache, key);
+    lock(shard);
     //  UNICODE
-    if ((item = mprLookupKey(cache->store, key->value)) == 0) {
-        unlock(cache);
+    if ((item = mprLookupKey(shard->store, key->value)) == 0) {
+        shard->misses++;
+        unlock(shard);
         return ESV(null);
     }
     if (item->expires && item->expires <= mprGetTime()) {
-        unlock(cache);
+        removeItem(cache, shard, item);
+        shard->misses++;
+        unlock(shard);
         return ESV(null);
     }
 #if UNUSED && FUTURE
@@ -225,6 +340,8 @@ static EjsAny *sl_read(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
         item->expires = mprGetTime() + item->lifespan;
     }
 #endif
+    shard->hits++;
+    touchItem(shard, item);
     if (getVersion) {
         result = ejsCreatePot(ejs, ESV(Object), 2);
         ejsSetPropertyByName(ejs, result, EN("version"), ejsCreateNumber(ejs, (MprNumber) item->version));
@@ -232,11 +349,33 @@ static EjsAny *sl_read(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
     } else {
         result = item->data;
     }
-    unlock(cache);
+    unlock(shard);
     return result;
 }
 
 
+/*
+    Discard all items in a shard. Caller must hold the shard lock.
+ */
+static int clearShard(EjsLocalCache *cache, CacheShard *shard)
+{
+    CacheItem   *item;
+    int64       count, mem;
+
+    count = mem = 0;
+    for (item = shard->head; item; item = item->next) {
+        count++;
+        mem += item->key->length + item->data->length;
+    }
+    shard->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+    shard->head = shard->tail = shard->overflow = 0;
+    memset(shard->wheel, 0, sizeof(shard->wheel));
+    mprAtomicAdd64(&cache->keyCount, -count);
+    mprAtomicAdd64(&cache->usedMem, -mem);
+    return count > 0;
+}
+
+
 /*
     native function remove(key: String): Boolean
  */
@@ -244,31 +383,39 @@ static EjsBoolean *sl_remove(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **
 {
     EjsString   *key;
     EjsAny      *result;
+    CacheShard  *shard;
     CacheItem   *item;
+    int         i;
 
     if (cache->shared) {
         cache = cache->shared;
         assert(cache == shared);
     }
     key = argv[0];
-    lock(cache);
     if (ejsIsDefined(ejs, key)) {
+        shard = getShard(cache, key);
+        lock(shard);
         //  UNICODE
-        if ((item = mprLookupKey(cache->store, key->value)) != 0) {
-            cache->usedMem -= (key->length + item->data->length);
-            mprRemoveKey(cache->store, key->value);
+        if ((item = mprLookupKey(shard->store, key->value)) != 0) {
+            removeItem(cache, shard, item);
             result = ESV(true);
         } else {
             result = ESV(false);
         }
+        unlock(shard);
 
     } else {
         /* Remove all keys */
-        result = mprGetHashLength(cache->store) ? ESV(true) : ESV(false);
-        cache->store = mprCreateHash(CACHE_HASH_SIZE, 0);
-        cache->usedMem = 0;
+        result = ESV(false);
+        for (i = 0; i < CACHE_SHARDS; i++) {
+            shard = cache->shards[i];
+            lock(shard);
+            if (clearShard(cache, shard)) {
+                result = ESV(true);
+            }
+            unlock(shard);
+        }
     }
-    unlock(cache);
     return result;
 }
 
@@ -322,11 +469,26 @@ static EjsVoid *sl_setLimits(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **
 }
 
 
+/*
+    Evict least recently used items until the cache is within its limits. Only the given shard is searched so the
+    cost is O(1) per evicted item. The item just written is never evicted. Caller must hold the shard lock.
+ */
+static void evictItems(EjsLocalCache *cache, CacheShard *shard, CacheItem *keep)
+{
+    while (overLimits(cache) && shard->tail && shard->tail != keep) {
+        mprDebug("ejs cache", 5, "LocalCache too big, evict key %s", shard->tail->key->value);
+        removeItem(cache, shard, shard->tail);
+        shard->evictions++;
+    }
+}
+
+
 /*
     function write(key: String~, value: String~, options: Object = null): Number
  */
 static EjsNumber *sl_write(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **argv)
 {
+    CacheShard  *shard;
     CacheItem   *item;
     EjsString   *key, *value, *sp;
     EjsPot      *options;
@@ -376,37 +538,36 @@ static EjsNumber *sl_write(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **ar
             checkVersion = 1;
         }
     }
-    lock(cache);
-    if ((kp = mprLookupKeyEntry(cache->store, key->value)) != 0) {
+    shard = getShard(cache, key);
+    lock(shard);
+    if ((kp = mprLookupKeyEntry(shard->store, key->value)) != 0) {
         exists++;
         item = (CacheItem*) kp->data;
         if (checkVersion) {
             if (item->version != version) {
-                unlock(cache);
+                unlock(shard);
                 if (throw) {
                     ejsThrowStateError(ejs, "Key version does not match");
                 }
                 return ESV(null);
             }
         }
+        if (add) {
+            unlock(shard);
+            return ESV(null);
+        }
     } else {
         if ((item = mprAllocObj(CacheItem, manageCacheItem)) == 0) {
-            unlock(cache);
+            unlock(shard);
             ejsThrowMemoryError(ejs);
             return 0;
         }
-        //  UNICODE
-        mprAddKey(cache->store, key->value, item);
         set = 1;
         item->key = key;
+        addItem(cache, shard, item);
     }
     oldLen = (item->data) ? (item->key->length + item->data->length) : 0;
-    if (set) {
-        item->data = value;
-    } else if (add) {
-        if (exists) {
-            return ESV(null);
-        }
+    if (set || add) {
         item->data = value;
     } else if (append) {
         item->data = ejsJoinString(ejs, item->data, value);
@@ -418,106 +579,256 @@ static EjsNumber *sl_write(Ejs *ejs, EjsLocalCache *cache, int argc, EjsAny **ar
         item->expires = expires;
         item->lifespan = 0;
     } else if (lifespan == 0) {
-        /* Never expires */
+        /* Never expires. Clear any prior lifespan so later updates do not reinstate it */
         item->expires = 0;
+        item->lifespan = 0;
     } else {
         item->lifespan = lifespan;
         item->expires = mprGetTime() + item->lifespan;
     }
     item->version++;
     len = item->key->length + item->data->length;
+    mprAtomicAdd64(&cache->usedMem, len - oldLen);
 
-    cache->usedMem += (len - oldLen);
+    touchItem(shard, item);
+    scheduleItem(shard, item);
+    evictItems(cache, shard, item);
+    unlock(shard);
+    startPruner(cache);
 
-    if (cache->timer == 0) {
-        mprDebug("ejs cache", 5, "Start LocalCache pruner with resolution %d", cache->resolution);
-        /* 
-            Use the MPR dispatcher incase this VM is destroyed 
-         */
-        cache->timer = mprCreateTimerEvent(MPR->dispatcher, "localCacheTimer", cache->resolution, localPruner, cache, 
-            MPR_EVENT_STATIC_DATA); 
-    }
-    unlock(cache);
     //  UNICODE
     return ejsCreateNumber(ejs, (MprNumber) len);
 }
 
 
-static void removeItem(EjsLocalCache *cache, CacheItem *item)
+static void startPruner(EjsLocalCache *cache)
 {
-    lock(cache);
-    //UNICODE
-    mprRemoveKey(cache->store, item->key->value);
-    cache->usedMem -= (item->key->length + item->data->length);
-    unlock(cache);
+    if (cache->timer == 0) {
+        lock(cache);
+        if (cache->timer == 0) {
+            mprDebug("ejs cache", 5, "Start LocalCache pruner with resolution %d", cache->resolution);
+            /* 
+                Use the MPR dispatcher incase this VM is destroyed 
+             */
+            cache->timer = mprCreateTimerEvent(MPR->dispatcher, "localCacheTimer", cache->resolution, localPruner, 
+                cache, MPR_EVENT_STATIC_DATA); 
+        }
+        unlock(cache);
+    }
 }
 
 
 /*
-    Check for expired keys
+    Move an item to the head of the shard LRU list
  */
-static void localPruner(EjsLocalCache *cache, MprEvent *event)
+static void touchItem(CacheShard *shard, CacheItem *item)
 {
-    MprTime         when, factor;
-    MprKey          *kp;
-    CacheItem       *item;
-    ssize           excessKeys;
-
-    if (mprTryLock(cache->mutex)) {
-        when = mprGetTime();
-        /*
-            Prune keys expiring first.
-         */
-        for (kp = 0; (kp = mprGetNextKey(cache->store, kp)) != 0; ) {
-            item = (CacheItem*) kp->data;
-#if KEEP
-            mprDebug("ejs cache", 6, "LocalCache: \"%@\" lifespan %d, expires in %d secs", item->key, 
-                    item->lifespan / 1000, (item->expires - when) / 1000);
-#endif
-            if (item->expires && item->expires <= when) {
-                mprDebug("ejs cache", 5, "LocalCache prune expired key %s", kp->key);
-                removeItem(cache, item);
+    if (shard->head == item) {
+        return;
+    }
+    if (item->prev) {
+        item->prev->next = item->next;
+    }
+    if (item->next) {
+        item->next->prev = item->prev;
+    }
+    if (shard->tail == item) {
+        shard->tail = item->prev;
+    }
+    item->prev = 0;
+    item->next = shard->head;
+    if (shard->head) {
+        shard->head->prev = item;
+    }
+    shard->head = item;
+    if (shard->tail == 0) {
+        shard->tail = item;
+    }
+}
+
+
+static void unscheduleItem(CacheItem *item)
+{
+    if (item->wprev) {
+        *item->wprev = item->wnext;
+        if (item->wnext) {
+            item->wnext->wprev = item->wprev;
+        }
+        item->wprev = 0;
+        item->wnext = 0;
+    }
+}
+
+
+/*
+    Place an item in the expiry wheel slot for its expiry time. Items expiring within 64 ticks go into the first
+    level, and so on. Items without an expiry are not scheduled. Caller must hold the shard lock.
+ */
+static void scheduleItem(CacheShard *shard, CacheItem *item)
+{
+    CacheItem   **slot;
+    MprTime     tick, delta;
+    int         level;
+
+    unscheduleItem(item);
+    if (item->expires == 0) {
+        return;
+    }
+    tick = max(item->expires / CACHE_WHEEL_TICK, shard->wheelTick);
+    delta = tick - shard->wheelTick;
+    slot = &shard->overflow;
+    for (level = 0; level < CACHE_WHEEL_LEVELS; level++) {
+        if (delta < ((MprTime) 1 << ((level + 1) * CACHE_WHEEL_BITS))) {
+            slot = &shard->wheel[level][(tick >> (level * CACHE_WHEEL_BITS)) & CACHE_WHEEL_MASK];
+            break;
+        }
+    }
+    item->wnext = *slot;
+    if (item->wnext) {
+        item->wnext->wprev = &item->wnext;
+    }
+    item->wprev = slot;
+    *slot = item;
+}
+
+
+/*
+    Redistribute the items of a higher level slot into lower levels
+ */
+static void cascadeItems(CacheShard *shard, CacheItem **slot)
+{
+    CacheItem   *item, *next;
+
+    item = *slot;
+    *slot = 0;
+    for (; item; item = next) {
+        next = item->wnext;
+        item->wprev = 0;
+        item->wnext = 0;
+        scheduleItem(shard, item);
+    }
+}
+
+
+/*
+    Advance the expiry wheel to the current time and remove expired items. Caller must hold the shard lock.
+ */
+static void expireItems(EjsLocalCache *cache, CacheShard *shard, MprTime now)
+{
+    CacheItem   *item, *next;
+    MprTime     tick;
+    int         level;
+
+    for (; shard->wheelTick < now / CACHE_WHEEL_TICK; shard->wheelTick++) {
+        tick = shard->wheelTick;
+        for (level = 1; level <= CACHE_WHEEL_LEVELS; level++) {
+            if ((tick >> ((level - 1) * CACHE_WHEEL_BITS)) & CACHE_WHEEL_MASK) {
+                break;
+            }
+            if (level < CACHE_WHEEL_LEVELS) {
+                cascadeItems(shard, &shard->wheel[level][(tick >> (level * CACHE_WHEEL_BITS)) & CACHE_WHEEL_MASK]);
+            } else {
+                cascadeItems(shard, &shard->overflow);
             }
         }
-        assert(cache->usedMem >= 0);
-
-        /*
-            If too many keys or too much memory used. Prune oldest first.
-         */
-        if (cache->maxKeys < MAXSSIZE || cache->maxMem < MAXSSIZE) {
-            excessKeys = mprGetHashLength(cache->store) - cache->maxKeys;
-            for (factor = 3600; factor < (86400 * 1000); factor *= 4) {
-                if (excessKeys > 0 || cache->usedMem > cache->maxMem) {
-                    for (kp = 0; (kp = mprGetNextKey(cache->store, kp)) != 0; ) {
-                        item = (CacheItem*) kp->data;
-                        if (item->expires && item->expires <= when) {
-                            mprDebug("ejs cache", 5, "LocalCache too big execess keys %Ld, mem %Ld, prune key %s", 
-                                    excessKeys, (cache->maxMem - cache->usedMem), kp->key);
-                            removeItem(cache, item);
-                            excessKeys--;
-                        }
-                    }
-                    when += factor;
-                } else {
-                    break;
-                }
+        item = shard->wheel[0][tick & CACHE_WHEEL_MASK];
+        shard->wheel[0][tick & CACHE_WHEEL_MASK] = 0;
+        for (; item; item = next) {
+            next = item->wnext;
+            item->wprev = 0;
+            item->wnext = 0;
+            if (item->expires <= now) {
+                mprDebug("ejs cache", 5, "LocalCache prune expired key %s", item->key->value);
+                removeItem(cache, shard, item);
+            } else {
+                scheduleItem(shard, item);
             }
         }
-        assert(cache->usedMem >= 0);
+    }
+}
+
+
+/*
+    Caller must hold the shard lock
+ */
+static void removeItem(EjsLocalCache *cache, CacheShard *shard, CacheItem *item)
+{
+    unscheduleItem(item);
+    if (item->prev) {
+        item->prev->next = item->next;
+    } else {
+        shard->head = item->next;
+    }
+    if (item->next) {
+        item->next->prev = item->prev;
+    } else {
+        shard->tail = item->prev;
+    }
+    item->prev = item->next = 0;
+    //  UNICODE
+    mprRemoveKey(shard->store, item->key->value);
+    mprAtomicAdd64(&cache->keyCount, -1);
+    mprAtomicAdd64(&cache->usedMem, -(item->key->length + item->data->length));
+}
 
-        if (mprGetHashLength(cache->store) == 0) {
-            mprRemoveEvent(event);
-            cache->timer = 0;
+
+/*
+    Expire keys and enforce the key and memory limits
+ */
+static void localPruner(EjsLocalCache *cache, MprEvent *event)
+{
+    CacheShard      *shard;
+    MprTime         now;
+    int             i, evicted;
+
+    now = mprGetTime();
+    for (i = 0; i < CACHE_SHARDS; i++) {
+        shard = cache->shards[i];
+        if (mprTryLock(shard->mutex)) {
+            expireItems(cache, shard, now);
+            unlock(shard);
         }
-        unlock(cache);
     }
+    assert(cache->usedMem >= 0);
+
+    /*
+        If too many keys or too much memory used, evict the least recently used item of each shard in turn
+     */
+    do {
+        evicted = 0;
+        for (i = 0; i < CACHE_SHARDS && overLimits(cache); i++) {
+            shard = cache->shards[i];
+            if (shard->tail && mprTryLock(shard->mutex)) {
+                if (shard->tail) {
+                    mprDebug("ejs cache", 5, "LocalCache too big, keys %Ld, mem %Ld, evict key %s", 
+                        cache->keyCount, cache->usedMem, shard->tail->key->value);
+                    removeItem(cache, shard, shard->tail);
+                    shard->evictions++;
+                    evicted++;
+                }
+                unlock(shard);
+            }
+        }
+    } while (evicted && overLimits(cache));
+    assert(cache->usedMem >= 0);
+
+    lock(cache);
+    if (cache->keyCount == 0) {
+        mprRemoveEvent(event);
+        cache->timer = 0;
+    }
+    unlock(cache);
 }
 
 
 static void manageLocalCache(EjsLocalCache *cache, int flags) 
 {
+    int     i;
+
     if (flags & MPR_MANAGE_MARK) {
-        mprMark(cache->store);
+        for (i = 0; i < CACHE_SHARDS; i++) {
+            mprMark(cache->shards[i]);
+        }
         mprMark(cache->mutex);
         mprMark(cache->timer);
         mprMark(cache->shared);
@@ -530,6 +841,15 @@ static void manageLocalCache(EjsLocalCache *cache, int flags)
 }
 
 
+static void manageCacheShard(CacheShard *shard, int flags) 
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(shard->store);
+        mprMark(shard->mutex);
+    }
+}
+
+
 static void manageCacheItem(CacheItem *item, int flags) 
 {
     if (flags & MPR_MANAGE_MARK) {
@@ -551,12 +871,11 @@ static EjsLocalCache *cloneLocalCache(Ejs *ejs, EjsLocalCache *src, bool deep)
     } else if (src == shared) {
         dest->shared = src;
     } else {
-        dest->store = mprCreateHash(CACHE_HASH_SIZE, 0);
+        createShards(dest);
         dest->mutex = mprCreateLock();
         dest->timer = 0;
         dest->lifespan = src->lifespan;
         dest->resolution = src->resolution;
-        dest->usedMem = src->usedMem;
         dest->maxMem = src->maxMem;
         dest->maxKeys = src->maxKeys;
         dest->shared = src->shared;
@@ -43,7 +43,14 @@ extern void freedtoa(char* ptr);
 /**************************** Forward Declarations ****************************/
 
 #define fixed(n) ((int64) (floor(n)))
-static char *ntoa(double value, int ndigits, int mode, int flags);
+
+/*
+    Largest integer that is exactly representable in a double
+ */
+#define EJS_MAX_SAFE_INTEGER 9007199254740991.0
+
+static EjsString *ntoa(Ejs *ejs, double value, int ndigits, int mode, int flags);
+static EjsString *numberToStringCached(Ejs *ejs, double value);
 
 /******************************************************************************/
 /*
@@ -56,8 +63,10 @@ static EjsAny *castNumber(Ejs *ejs, EjsNumber *vp, EjsType *type)
         return ((vp->value && !ejsIsNan(vp->value)) ? ESV(true) : ESV(false));
 
     case S_String:
-        //  OPT. ntoa does a clone
-        return ejsCreateStringFromAsc(ejs, ntoa(vp->value, 0, 0, 0));
+        if (-EJS_MAX_SAFE_INTEGER <= vp->value && vp->value <= EJS_MAX_SAFE_INTEGER && vp->value == fixed(vp->value)) {
+            return ejsCreateStringFromInt(ejs, (int64) vp->value);
+        }
+        return numberToStringCached(ejs, vp->value);
 
     case S_Number:
         return vp;
@@ -335,12 +344,10 @@ static EjsBoolean *isNaN(Ejs *ejs, EjsNumber *np, int argc, EjsObj **argv)
  */
 static EjsString *toExponential(Ejs *ejs, EjsNumber *np, int argc, EjsObj **argv)
 {
-    char    *result;
     int     ndigits;
     
     ndigits = (argc > 0) ? ejsGetInt(ejs, argv[0]): 0;
-    result = ntoa(np->value, ndigits, DTOA_N_DIGITS, DTOA_EXPONENT_FORM);
-    return ejsCreateStringFromAsc(ejs, result);
+    return ntoa(ejs, np->value, ndigits, DTOA_N_DIGITS, DTOA_EXPONENT_FORM);
 }
 
 
@@ -351,12 +358,10 @@ static EjsString *toExponential(Ejs *ejs, EjsNumber *np, int argc, EjsObj **argv
  */
 static EjsString *toFixed(Ejs *ejs, EjsNumber *np, int argc, EjsObj **argv)
 {
-    char    *result;
     int     ndigits;
     
     ndigits = (argc > 0) ? ejsGetInt(ejs, argv[0]) : 0;
-    result = ntoa(np->value, ndigits, DTOA_N_FRACTION_DIGITS, DTOA_FIXED_FORM);
-    return ejsCreateStringFromAsc(ejs, result);
+    return ntoa(ejs, np->value, ndigits, DTOA_N_FRACTION_DIGITS, DTOA_FIXED_FORM);
 }
 
 
@@ -367,12 +372,10 @@ static EjsString *toFixed(Ejs *ejs, EjsNumber *np, int argc, EjsObj **argv)
  */
 static EjsString *toPrecision(Ejs *ejs, EjsNumber *np, int argc, EjsObj **argv)
 {
-    char    *result;
     int     ndigits;
     
     ndigits = (argc > 0) ? ejsGetInt(ejs, argv[0]) : 0;
-    result = ntoa(np->value, ndigits, DTOA_N_DIGITS, 0);
-    return ejsCreateStringFromAsc(ejs, result);
+    return ntoa(ejs, np->value, ndigits, DTOA_N_DIGITS, 0);
 }
 
 
@@ -444,9 +447,32 @@ PUBLIC void ejsUnlockDtoa(int n)
 
 
 /*
-    Convert a double to ascii. Caller must free the result. This uses the JavaScript ECMA-262 spec for formatting rules.
+    Convert a non-integral number to a string using a small per-VM cache of recent conversions. The cache is 
+    direct mapped by the bits of the value. VMs run on one thread at a time so the cache needs no locking.
+ */
+static EjsString *numberToStringCached(Ejs *ejs, double value)
+{
+    EjsString   *sp;
+    uint64      bits;
+    int         index;
+
+    memcpy(&bits, &value, sizeof(bits));
+    index = (int) ((bits ^ (bits >> 29) ^ (bits >> 47)) % EJS_NUMBER_CACHE);
+    if ((sp = ejs->numberStrings[index]) != 0 && memcmp(&ejs->numberKeys[index], &value, sizeof(double)) == 0) {
+        return sp;
+    }
+    if ((sp = ntoa(ejs, value, 0, 0, 0)) != 0) {
+        ejs->numberKeys[index] = value;
+        ejs->numberStrings[index] = sp;
+    }
+    return sp;
+}
+
+
+/*
+    Convert a double to a string. This uses the JavaScript ECMA-262 spec for formatting rules.
  */
-static char *ntoa(double value, int ndigits, int mode, int flags)
+static EjsString *ntoa(Ejs *ejs, double value, int ndigits, int mode, int flags)
 {
     MprBuf  *buf;
     char    *intermediate, *ip;
@@ -573,11 +599,10 @@ static char *ntoa(double value, int ndigits, int mode, int flags)
             }
         }
     }
-    mprAddNullToBuf(buf);
     if (intermediate) {
         freedtoa(intermediate);
     }
-    return sclone(mprGetBufStart(buf));
+    return ejsCreateStringFromBytes(ejs, mprGetBufStart(buf), mprGetBufLength(buf));
 }
 
 
@@ -15,6 +15,12 @@
     #define ME_MAX_REGEX_MATCHES 128
 #endif
 
+/*
+    Patterns at least this long in subjects at least EJS_SKIP_SEARCH_SUBJECT long use a Horspool skip search
+ */
+#define EJS_SKIP_SEARCH_PATTERN     16
+#define EJS_SKIP_SEARCH_SUBJECT     1024
+
 static int internHashSizes[] = {
      389, 769, 1543, 3079, 6151, 12289, 24593, 49157, 98317, 196613, 0
 };
@@ -22,9 +28,13 @@ static int internHashSizes[] = {
 /***************************** Forward Declarations ***************************/
 
 static EjsString *buildString(Ejs *ejs, EjsString *result, wchar *str, ssize len);
+static ssize findFirst(wchar *str, ssize len, wchar *pat, ssize patLen);
+static ssize findLast(wchar *str, ssize len, wchar *pat, ssize patLen);
 static ssize indexof(wchar *str, ssize len, EjsString *pattern, ssize patternLength, int dir);
 static void linkString(EjsString *head, EjsString *sp);
 static void manageIntern(EjsIntern *intern, int flags);
+static bool matchAsc(EjsString *sp, cchar *value, ssize len);
+static bool matchWide(EjsString *sp, wchar *value, ssize len);
 static int rebuildIntern(EjsIntern *intern);
 static void unlinkString(EjsString *sp);
 
@@ -404,7 +414,7 @@ static EjsBoolean *containsString(Ejs *ejs, EjsString *sp, int argc, EjsObj **ar
 
     if (ejsIs(ejs, pat, String)) {
         spat = (EjsString*) pat;
-        return ejsCreateBoolean(ejs, wcontains(sp->value, spat->value) != 0);
+        return ejsCreateBoolean(ejs, spat->length > 0 && findFirst(sp->value, sp->length, spat->value, spat->length) >= 0);
 
     } else if (ejsIs(ejs, pat, RegExp)) {
         EjsRegExp   *rp;
@@ -1263,11 +1273,6 @@ static EjsString *replace(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
         patternLength = pattern->length;
         index = indexof(sp->value, sp->length, pattern, patternLength, 1);
         if (index >= 0) {
-            if ((result = ejsCreateBareString(ejs, ME_MAX_BUFFER)) == NULL) {
-                return 0;
-            }
-            result->length = 0;
-            result = buildString(ejs, result, sp->value, index);
             if (replacementFunction) {
                 matches[0] = matches[2] = (int) index;
                 matches[1] = matches[3] = (int) (index + patternLength);
@@ -1275,13 +1280,18 @@ static EjsString *replace(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
                 replacement = getReplacementText(ejs, replacementFunction, 2, matches, sp);
                 mprEnableGC(enabled);
             }
-            result = buildString(ejs, result, replacement->value, replacement->length);
-            index += patternLength;
-            if (index < sp->length) {
-                result = buildString(ejs, result, &sp->value[index], sp->length - index);
+            /*
+                The result size is known, so build it in one allocation
+             */
+            if ((result = ejsCreateBareString(ejs, sp->length - patternLength + replacement->length)) == NULL) {
+                return 0;
             }
+            memcpy(result->value, sp->value, index * sizeof(wchar));
+            memcpy(&result->value[index], replacement->value, replacement->length * sizeof(wchar));
+            memcpy(&result->value[index + replacement->length], &sp->value[index + patternLength], 
+                (sp->length - index - patternLength) * sizeof(wchar));
         } else {
-            result = ejsClone(ejs, sp, 0);
+            return sp;
         }
     }
     return ejsInternString(result);
@@ -1409,33 +1419,66 @@ static EjsString *sliceString(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
 static EjsArray *split(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
 {
     EjsArray    *results;
-    EjsString   *elt, *delim;
+    EjsString   *delim;
     wchar       *cp, *mark, *end;
-    ssize      limit;
+    ssize       limit, count, index, i;
 
     assert(1 <= argc && argc <= 2);
 
-    limit = (argc == 2) ? ejsGetInt(ejs, argv[1]): MAXSSIZE;
-    results = ejsCreateArray(ejs, 0);
-
+    limit = (argc == 2) ? ejsGetInt(ejs, argv[1]): -1;
+    if (limit < 0) {
+        limit = MAXSSIZE;
+    }
     if (ejsIs(ejs, argv[0], String)) {
         delim = (EjsString*) argv[0];
+        end = &sp->value[sp->length];
         if (delim->length == 0) {
-            for (cp = sp->value; (--limit != -1) && *cp; cp++) {
-                ejsSetProperty(ejs, results, -1, ejsCreateString(ejs, cp, 1));
+            count = min(sp->length, limit);
+            if ((results = ejsCreateArray(ejs, (int) count)) == 0) {
+                return 0;
+            }
+            for (i = 0; i < count; i++) {
+                results->data[i] = (EjsObj*) ejsCreateString(ejs, &sp->value[i], 1);
+            }
+        } else if (limit < MAXSSIZE) {
+            /*
+                An explicit limit bounds the number of characters scanned for delimiters. The remainder of the scanned
+                region is returned as the last element.
+             */
+            if ((results = ejsCreateArray(ejs, 0)) == 0) {
+                return 0;
             }
-        } else {
-            end = &sp->value[sp->length];
             for (mark = cp = sp->value; limit > 0 && mark < end; mark++, limit--) {
                 if (wncmp(mark, delim->value, delim->length) == 0) {
-                    elt = ejsCreateString(ejs, cp, (int) (mark - cp));
-                    ejsSetProperty(ejs, results, -1, elt);
+                    ejsSetProperty(ejs, results, -1, ejsCreateString(ejs, cp, mark - cp));
                     cp = mark + delim->length;
                     mark = cp - 1;
                 }
             }
-            elt = ejsCreateString(ejs, cp, (int) (mark - cp));
-            ejsSetProperty(ejs, results, -1, elt);
+            ejsSetProperty(ejs, results, -1, ejsCreateString(ejs, cp, mark - cp));
+        } else {
+            /*
+                Count the elements first so the result array is allocated once
+             */
+            count = 0;
+            if (limit > 0) {
+                for (count = 1, cp = sp->value; count < limit; count++) {
+                    if ((index = findFirst(cp, end - cp, delim->value, delim->length)) < 0) {
+                        break;
+                    }
+                    cp += index + delim->length;
+                }
+            }
+            if ((results = ejsCreateArray(ejs, (int) count)) == 0) {
+                return 0;
+            }
+            for (i = 0, cp = sp->value; i < count; i++) {
+                if ((index = findFirst(cp, end - cp, delim->value, delim->length)) < 0) {
+                    index = end - cp;
+                }
+                results->data[i] = (EjsObj*) ejsCreateString(ejs, cp, index);
+                cp = min(cp + index + delim->length, end);
+            }
         }
         return results;
 
@@ -1444,6 +1487,7 @@ static EjsArray *split(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
         EjsString   *match;
         int         matches[ME_MAX_REGEX_MATCHES * 3], count, resultCount;
         
+        results = ejsCreateArray(ejs, 0);
         rp = (EjsRegExp*) argv[0];
         rp->endLastMatch = 0;
         resultCount = 0;
@@ -1687,7 +1731,7 @@ static EjsArray *tokenize(Ejs *ejs, EjsString *sp, int argc, EjsObj **argv)
 static EjsString *trim(Ejs *ejs, EjsString *sp, EjsString *pattern, int where)
 {
     wchar       *start, *end, *mark;
-    ssize       index, patternLength;
+    ssize       patternLength;
 
     if (pattern == 0) {
         start = sp->value;
@@ -1715,8 +1759,7 @@ static EjsString *trim(Ejs *ejs, EjsString *sp, EjsString *pattern, int where)
         mark = sp->value;
         if (where & MPR_TRIM_START) {
             for (; &mark[patternLength] <= &sp->value[sp->length]; mark += patternLength) {
-                index = indexof(mark, patternLength, pattern, patternLength, 1);
-                if (index != 0) {
+                if (memcmp(mark, pattern->value, patternLength * sizeof(wchar)) != 0) {
                     break;
                 }
             }
@@ -1725,9 +1768,8 @@ static EjsString *trim(Ejs *ejs, EjsString *sp, EjsString *pattern, int where)
 
         mark = &sp->value[sp->length - patternLength];
         if (where & MPR_TRIM_END) {
-            for (; mark >= sp->value; mark -= patternLength) {
-                index = indexof(mark, patternLength, pattern, patternLength, 1);
-                if (index != 0) {
+            for (; mark >= start; mark -= patternLength) {
+                if (memcmp(mark, pattern->value, patternLength * sizeof(wchar)) != 0) {
                     break;
                 }
             }
@@ -1868,43 +1910,99 @@ static EjsString *buildString(Ejs *ejs, EjsString *result, wchar *str, ssize len
 }
 
 
+#if ME_CHAR_LEN == 1
+/*
+    Horspool skip search for long patterns. The skip table allows the scan to advance by up to the pattern length 
+    for each character examined.
+ */
+static ssize skipSearch(uchar *str, ssize len, uchar *pat, ssize patLen)
+{
+    ssize       skip[256], i, last;
+
+    last = patLen - 1;
+    for (i = 0; i < 256; i++) {
+        skip[i] = patLen;
+    }
+    for (i = 0; i < last; i++) {
+        skip[pat[i]] = last - i;
+    }
+    for (i = 0; i <= len - patLen; i += skip[str[i + last]]) {
+        if (str[i + last] == pat[last] && memcmp(&str[i], pat, last) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+#endif
+
+
+/*
+    Find the first occurrence of a pattern. Return the index or -1 if not found. Compact strings use memchr to locate 
+    candidate first characters and memcmp to verify. The C library implements these with vector instructions 
+    where available.
+ */
+static ssize findFirst(wchar *str, ssize len, wchar *pat, ssize patLen)
+{
+    wchar       *cp, *last;
+
+    if (patLen <= 0 || patLen > len) {
+        return (patLen == 0 && len > 0) ? 0 : -1;
+    }
+    last = &str[len - patLen];
+#if ME_CHAR_LEN == 1
+    if (patLen >= EJS_SKIP_SEARCH_PATTERN && len >= EJS_SKIP_SEARCH_SUBJECT) {
+        return skipSearch((uchar*) str, len, (uchar*) pat, patLen);
+    }
+    for (cp = str; cp <= last; cp++) {
+        if ((cp = memchr(cp, pat[0], last - cp + 1)) == 0) {
+            break;
+        }
+        if (memcmp(&cp[1], &pat[1], patLen - 1) == 0) {
+            return cp - str;
+        }
+    }
+#else
+    for (cp = str; cp <= last; cp++) {
+        if (*cp == pat[0] && memcmp(&cp[1], &pat[1], (patLen - 1) * sizeof(wchar)) == 0) {
+            return cp - str;
+        }
+    }
+#endif
+    return -1;
+}
+
+
+/*
+    Find the last occurrence of a pattern. Return the index or -1 if not found.
+ */
+static ssize findLast(wchar *str, ssize len, wchar *pat, ssize patLen)
+{
+    wchar       *cp;
+
+    if (patLen <= 0 || patLen > len) {
+        return (patLen == 0 && len > 0) ? len - 1 : -1;
+    }
+    for (cp = &str[len - patLen]; cp >= str; cp--) {
+        if (*cp == pat[0] && memcmp(&cp[1], &pat[1], (patLen - 1) * sizeof(wchar)) == 0) {
+            return cp - str;
+        }
+    }
+    return -1;
+}
+
+
 /*
     Find a substring. Search forward or backwards. Return the index in the string where the pattern was found.
     Return -1 if not found.
  */
 static ssize indexof(wchar *str, ssize len, EjsString *pattern, ssize patternLength, int dir)
 {
-    wchar       *s1, *s2;
-    ssize       i, j;
-
     assert(dir == 1 || dir == -1);
 
     if (dir > 0) {
-        for (i = 0; i < len; i++) {
-            s1 = &str[i];
-            for (j = 0, s2 = pattern->value; j < patternLength; s1++, s2++, j++) {
-                if (*s1 != *s2) {
-                    break;
-                }
-            }
-            if (*s2 == '\0') {
-                return i;
-            }
-        }
-    } else {
-        for (i = len - 1; i >= 0; i--) {
-            s1 = &str[i];
-            for (j = 0, s2 = pattern->value; j < patternLength; s1++, s2++, j++) {
-                if (*s1 != *s2) {
-                    break;
-                }
-            }
-            if (*s2 == '\0') {
-                return i;
-            }
-        }
+        return findFirst(str, len, pattern->value, patternLength);
     }
-    return -1;
+    return findLast(str, len, pattern->value, patternLength);
 }
 
 /******************************************** String API *******************************************/
@@ -2049,6 +2147,15 @@ PUBLIC int ejsCompareString(Ejs *ejs, EjsString *sp1, EjsString *sp2)
     } else if (s2 == 0) {
         return 1;
     }
+#if ME_CHAR_LEN == 1
+    /*
+        Compact strings compare as raw bytes. This orders by code unit and handles embedded nulls.
+     */
+    if ((rc = memcmp(s1, s2, min(sp1->length, sp2->length))) != 0) {
+        return rc < 0 ? -1 : 1;
+    }
+    return (sp1->length < sp2->length) ? -1 : ((sp1->length > sp2->length) ? 1 : 0);
+#else
     for (rc = 0; *s1 && *s2 && rc == 0; s1++, s2++) {
         rc = *s1 - *s2;
     }
@@ -2061,6 +2168,7 @@ PUBLIC int ejsCompareString(Ejs *ejs, EjsString *sp1, EjsString *sp2)
     }
     assert(0);
     return 0;
+#endif
 }
 
 
@@ -2116,16 +2224,15 @@ PUBLIC int ejsCompareWide(Ejs *ejs, EjsString *sp1, wchar *sp2, ssize len)
  */
 PUBLIC int ejsContainsChar(Ejs *ejs, EjsString *sp, int charPat)
 {
-    int     i;
+    wchar   c;
 
     assert(sp);
 
-    for (i = 0; i < sp->length; i++) {
-        if (sp->value[i] == charPat) {
-            return i;
-        }
+    c = (wchar) charPat;
+    if (c != charPat) {
+        return -1;
     }
-    return -1;
+    return (int) findFirst(sp->value, sp->length, &c, 1);
 }
 
 
@@ -2160,7 +2267,9 @@ PUBLIC int ejsContainsStringAnyCase(Ejs *ejs, EjsString *sp, EjsString *pat)
 PUBLIC int ejsContainsAsc(Ejs *ejs, EjsString *sp, cchar *pat)
 {
     ssize   len;
+#if ME_CHAR_LEN > 1
     int     i, j, k;
+#endif
 
     assert(sp);
 
@@ -2168,7 +2277,9 @@ PUBLIC int ejsContainsAsc(Ejs *ejs, EjsString *sp, cchar *pat)
         return 0;
     }
     len = strlen(pat);
-    
+#if ME_CHAR_LEN == 1
+    return (int) findFirst(sp->value, sp->length, (wchar*) pat, len);
+#else
     for (i = 0; i < sp->length; i++) {
         for (j = 0, k = i; j < len; j++, k++) {
             if (sp->value[k] != pat[j]) {
@@ -2180,13 +2291,12 @@ PUBLIC int ejsContainsAsc(Ejs *ejs, EjsString *sp, cchar *pat)
         }
     }
     return -1;
+#endif
 }
 
 
 PUBLIC int ejsContainsString(Ejs *ejs, EjsString *sp, EjsString *pat)
 {
-    int     i, j, k;
-
     assert(sp);
     assert(pat);
     assert(pat->value);
@@ -2194,17 +2304,7 @@ PUBLIC int ejsContainsString(Ejs *ejs, EjsString *sp, EjsString *pat)
     if (pat == 0 || pat->value == 0) {
         return 0;
     }
-    for (i = 0; i < sp->length; i++) {
-        for (j = 0, k = i; j < pat->length; j++, k++) {
-            if (sp->value[k] != pat->value[j]) {
-                break;
-            }
-        }
-        if (j == pat->length) {
-            return 1;
-        }
-    }
-    return -1;
+    return (findFirst(sp->value, sp->length, pat->value, pat->length) >= 0) ? 1 : -1;
 }
 
 
@@ -2234,6 +2334,18 @@ PUBLIC char *ejsToMulti(Ejs *ejs, EjsAny *ev)
 }
 
 
+PUBLIC cchar *ejsGetMulti(Ejs *ejs, EjsAny *ev)
+{
+#if ME_CHAR_LEN == 1
+    if (ev && ejsIs(ejs, ev, String)) {
+        /* Compact strings are already UTF-8 and are null terminated */
+        return ((EjsString*) ev)->value;
+    }
+#endif
+    return ejsToMulti(ejs, ev);
+}
+
+
 PUBLIC EjsString *ejsSprintf(Ejs *ejs, cchar *fmt, ...)
 {
     va_list     ap;
@@ -2283,8 +2395,20 @@ PUBLIC EjsString *ejsToLower(Ejs *ejs, EjsString *sp)
     assert(sp);
     assert(sp->value);
 
-    result = (EjsString*) ejsCreateBareString(ejs, sp->length);
+    /*
+        Strings are immutable, so return the original if there are no upper case characters
+     */
     for (i = 0; i < sp->length; i++) {
+        if (isupper((uchar) sp->value[i])) {
+            break;
+        }
+    }
+    if (i == sp->length) {
+        return sp;
+    }
+    result = (EjsString*) ejsCreateBareString(ejs, sp->length);
+    memcpy(result->value, sp->value, i * sizeof(wchar));
+    for (; i < sp->length; i++) {
         result->value[i] = tolower((uchar) sp->value[i]);
     }
     return ejsInternString(result);
@@ -2299,8 +2423,17 @@ PUBLIC EjsString *ejsToUpper(Ejs *ejs, EjsString *sp)
     assert(sp);
     assert(sp->value);
 
-    result = (EjsString*) ejsCreateBareString(ejs, sp->length);
     for (i = 0; i < sp->length; i++) {
+        if (islower((uchar) sp->value[i])) {
+            break;
+        }
+    }
+    if (i == sp->length) {
+        return sp;
+    }
+    result = (EjsString*) ejsCreateBareString(ejs, sp->length);
+    memcpy(result->value, sp->value, i * sizeof(wchar));
+    for (; i < sp->length; i++) {
         result->value[i] = toupper((uchar) sp->value[i]);
     }
     return ejsInternString(result);
@@ -2379,6 +2512,49 @@ static void revive(EjsString *sp)
 }
 
 
+/*
+    Test if a string matches a value of the given length. Compact strings are compared as raw bytes.
+ */
+static bool matchWide(EjsString *sp, wchar *value, ssize len)
+{
+#if ME_CHAR_LEN == 1
+    return sp->length == len && memcmp(sp->value, value, len) == 0;
+#else
+    ssize   i;
+
+    if (sp->length != len) {
+        return 0;
+    }
+    for (i = 0; i < len; i++) {
+        if (sp->value[i] != value[i]) {
+            return 0;
+        }
+    }
+    return 1;
+#endif
+}
+
+
+static bool matchAsc(EjsString *sp, cchar *value, ssize len)
+{
+#if ME_CHAR_LEN == 1
+    return matchWide(sp, (wchar*) value, len);
+#else
+    ssize   i;
+
+    if (sp->length != len) {
+        return 0;
+    }
+    for (i = 0; i < len; i++) {
+        if (sp->value[i] != (uchar) value[i]) {
+            return 0;
+        }
+    }
+    return 1;
+#endif
+}
+
+
 /*
     Intern a unicode string. Lookup a string and return an interned string (this may be an existing interned string)
  */
@@ -2386,7 +2562,6 @@ PUBLIC EjsString *ejsInternString(EjsString *str)
 {
     EjsString   *head, *sp;
     EjsIntern   *ip;
-    ssize       i, len;
     int         index, step;
 
     ip = ((EjsService*) MPR->ejsService)->intern;
@@ -2402,21 +2577,11 @@ PUBLIC EjsString *ejsInternString(EjsString *str)
                 unlock(ip);
                 return sp;
             }
-            if (sp->length == str->length) {
-                //  TODO but they are the same?
-                len = min(sp->length, str->length);
-                //  OPT
-                for (i = 0; i < len; i++) {
-                    if (sp->value[i] != str->value[i]) {
-                        break;
-                    }
-                }
-                if (i == sp->length && i == str->length) {
-                    ip->reuse++;
-                    revive(sp);
-                    unlock(ip);
-                    return sp;
-                }
+            if (matchWide(sp, str->value, str->length)) {
+                ip->reuse++;
+                revive(sp);
+                unlock(ip);
+                return sp;
             }
         }
     }
@@ -2439,7 +2604,6 @@ PUBLIC EjsString *ejsInternWide(Ejs *ejs, wchar *value, ssize len)
 {
     EjsString   *head, *sp;
     EjsIntern   *ip;
-    ssize       i, end;
     int         index, step;
 
     assert(0 <= len && len < MAXINT);
@@ -2453,20 +2617,11 @@ PUBLIC EjsString *ejsInternWide(Ejs *ejs, wchar *value, ssize len)
     index = whash(value, len) % ip->size;
     if ((head = &ip->buckets[index]) != NULL) {
         for (sp = head->next; sp != head; sp = sp->next, step++) {
-            //  TODO - why not compare sp->value with value?
-            if (sp->length == len) {
-                end = min(sp->length, len);
-                for (i = 0; i < end && value[i]; i++) {
-                    if (sp->value[i] != value[i]) {
-                        break;
-                    }
-                }
-                if (i == sp->length) {
-                    ip->reuse++;
-                    revive(sp);
-                    unlock(ip);
-                    return sp;
-                }
+            if (matchWide(sp, value, len)) {
+                ip->reuse++;
+                revive(sp);
+                unlock(ip);
+                return sp;
             }
         }
     }
@@ -2491,7 +2646,6 @@ PUBLIC EjsString *ejsInternAsc(Ejs *ejs, cchar *value, ssize len)
 {
     EjsString   *head, *sp;
     EjsIntern   *ip;
-    ssize       i, end;
     int         index, step;
 
     assert(0 <= len && len < MAXINT);
@@ -2505,24 +2659,17 @@ PUBLIC EjsString *ejsInternAsc(Ejs *ejs, cchar *value, ssize len)
     index = shash(value, len) % ip->size;
     if ((head = &ip->buckets[index]) != NULL) {
         for (sp = head->next; sp != head; sp = sp->next, step++) {
-            if (sp->length == len) {
-                end = min(len, sp->length);
-                for (i = 0; i < end && value[i]; i++) {
-                    if (sp->value[i] != (uchar) value[i]) {
-                        break;
-                    }
-                }
-                if (i == sp->length) {
-                    ip->reuse++;
-                    revive(sp);
-                    unlock(ip);
-                    return sp;
-                }
+            if (matchAsc(sp, value, len)) {
+                ip->reuse++;
+                revive(sp);
+                unlock(ip);
+                return sp;
             }
         }
     }
     if ((sp = ejsAlloc(ejs, ESV(String), (len + 1) * sizeof(wchar))) != NULL) {
 #if ME_CHAR_LEN > 1
+        ssize   i;
         for (i = 0; i < len; i++) {
             sp->value[i] = value[i];
         }
@@ -2731,6 +2878,37 @@ PUBLIC EjsString *ejsCreateStringFromBytes(Ejs *ejs, cchar *value, ssize len)
 }
 
 
+PUBLIC EjsString *ejsCreateStringFromInt(Ejs *ejs, int64 value)
+{
+    EjsIntern   *ip;
+    EjsString   *sp;
+    char        buf[32], *cp;
+    uint64      n;
+    int         cache;
+
+    ip = ejs->service->intern;
+    cache = (0 <= value && value < EJS_INTERN_INTEGERS);
+    if (cache && (sp = ip->integers[value]) != 0) {
+        return sp;
+    }
+    cp = &buf[sizeof(buf)];
+    n = (value < 0) ? -(uint64) value : (uint64) value;
+    do {
+        *--cp = (char) ('0' + (n % 10));
+        n /= 10;
+    } while (n);
+    if (value < 0) {
+        *--cp = '-';
+    }
+    sp = ejsInternAsc(ejs, cp, &buf[sizeof(buf)] - cp);
+    if (cache) {
+        /* Racing threads store the same interned string */
+        ip->integers[value] = sp;
+    }
+    return sp;
+}
+
+
 /*
     Create an empty string object and do not intern. Caller's should call ejsInternString when the string value is defined.
  */
@@ -2827,9 +3005,14 @@ PUBLIC void ejsDestroyIntern(EjsIntern *ip)
 
 static void manageIntern(EjsIntern *intern, int flags)
 {
+    int     i;
+
     if (flags & MPR_MANAGE_MARK) {
         mprMark(intern->buckets);
         mprMark(intern->mutex);
+        for (i = 0; i < EJS_INTERN_INTEGERS; i++) {
+            mprMark(intern->integers[i]);
+        }
 
     } else if (flags & MPR_MANAGE_FREE) {
         ejsDestroyIntern(intern);
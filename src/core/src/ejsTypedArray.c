@@ -0,0 +1,939 @@
+/*
+    ejsTypedArray.c - Float64Array, Int32Array and Uint8Array classes
+
+    Typed arrays are fixed length views of native numeric elements stored in a ByteArray. The view references the
+    ByteArray object (not its data pointer) so the array may be reallocated beneath the view. Bulk methods operate
+    directly on the element storage with simple strided loops the compiler can vectorize.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************** Includes **********************************/
+
+#include    "ejs.h"
+
+/*********************************** Locals ***********************************/
+/*
+    Native map kernels
+ */
+#define KERNEL_ABS      0
+#define KERNEL_ADD      1
+#define KERNEL_CEIL     2
+#define KERNEL_DIV      3
+#define KERNEL_FLOOR    4
+#define KERNEL_MAX      5
+#define KERNEL_MIN      6
+#define KERNEL_MUL      7
+#define KERNEL_NEG      8
+#define KERNEL_ROUND    9
+#define KERNEL_SQRT     10
+#define KERNEL_SUB      11
+
+static cchar *kernels[] = {
+    "abs", "add", "ceil", "div", "floor", "max", "min", "mul", "neg", "round", "sqrt", "sub", 0
+};
+
+static int elementSizes[] = { sizeof(double), sizeof(int), sizeof(uchar) };
+
+#define elements(ta, ctype) ((ctype*) &(ta)->buffer->value[(ta)->offset])
+
+/***************************** Forward Declarations ***************************/
+
+static int initTypedArray(Ejs *ejs, EjsTypedArray *ta, int kind, EjsByteArray *buffer, ssize offset, ssize length);
+static EjsString *ta_toString(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv);
+
+/******************************************************************************/
+
+static int getKind(Ejs *ejs, EjsType *type)
+{
+    if (type == EST(Int32Array)) {
+        return EJS_TYPED_INT32;
+    } else if (type == EST(Uint8Array)) {
+        return EJS_TYPED_UINT8;
+    }
+    return EJS_TYPED_FLOAT64;
+}
+
+
+static EjsType *getKindType(Ejs *ejs, int kind)
+{
+    switch (kind) {
+    case EJS_TYPED_INT32:
+        return EST(Int32Array);
+    case EJS_TYPED_UINT8:
+        return EST(Uint8Array);
+    default:
+        return EST(Float64Array);
+    }
+}
+
+
+/*
+    Convert a number to a 32-bit integer per ECMAScript ToInt32. The value is truncated and wrapped modulo 2^32. 
+    NaN and Infinity map to zero.
+ */
+static ME_INLINE int toInt32(MprNumber value)
+{
+    double  d;
+
+    if (value >= -2147483648.0 && value <= 2147483647.0) {
+        return (int) value;
+    }
+    if (mprIsNan(value) || mprIsInfinite(value)) {
+        return 0;
+    }
+    d = fmod((value < 0) ? ceil(value) : floor(value), 4294967296.0);
+    if (d < 0) {
+        d += 4294967296.0;
+    }
+    return (int) (uint) d;
+}
+
+
+/*
+    Verify the view still fits in the buffer. ByteArrays only grow, but a delete of the last byte can shrink them.
+ */
+static ME_INLINE bool validView(Ejs *ejs, EjsTypedArray *ta)
+{
+    if ((ta->offset + ta->length * ta->elementSize) > ta->buffer->size) {
+        ejsThrowOutOfBoundsError(ejs, "Typed array view exceeds the buffer size");
+        return 0;
+    }
+    return 1;
+}
+
+
+/*
+    Normalize a start/end range. Negative ends select the end of the array.
+ */
+static void getRange(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv, int first, ssize *start, ssize *end)
+{
+    ssize   s, e;
+
+    s = (argc > first) ? ejsGetInt(ejs, argv[first]) : 0;
+    e = (argc > (first + 1)) ? ejsGetInt(ejs, argv[first + 1]) : -1;
+    if (s < 0) {
+        s = 0;
+    }
+    if (e < 0 || e > ta->length) {
+        e = ta->length;
+    }
+    if (s > e) {
+        s = e;
+    }
+    *start = s;
+    *end = e;
+}
+
+/*********************************** Helpers **********************************/
+/*
+    Cast the object operand to a primitive type
+ */
+static EjsAny *castTypedArray(Ejs *ejs, EjsTypedArray *ta, EjsType *type)
+{
+    switch (type->sid) {
+    case S_Boolean:
+        return ESV(true);
+
+    case S_Number:
+        return ESV(zero);
+
+    case S_String:
+        return ta_toString(ejs, ta, 0, 0);
+
+    default:
+        ejsThrowTypeError(ejs, "Cannot cast to this type");
+        return 0;
+    }
+}
+
+
+/*
+    A shallow clone shares the buffer. A deep clone copies the elements into a new buffer.
+ */
+static EjsTypedArray *cloneTypedArray(Ejs *ejs, EjsTypedArray *ta, bool deep)
+{
+    EjsTypedArray   *result;
+    EjsByteArray    *buffer;
+    ssize           len;
+
+    if (!deep) {
+        return ejsCreateTypedArray(ejs, ta->kind, ta->buffer, ta->offset, ta->length);
+    }
+    len = ta->length * ta->elementSize;
+    if ((result = ejsCreateTypedArray(ejs, ta->kind, NULL, 0, ta->length)) == 0) {
+        return 0;
+    }
+    buffer = result->buffer;
+    if (len > 0 && validView(ejs, ta)) {
+        memcpy(buffer->value, &ta->buffer->value[ta->offset], len);
+    }
+    return result;
+}
+
+
+static int deleteTypedArrayProperty(Ejs *ejs, EjsTypedArray *ta, int slot)
+{
+    ejsThrowTypeError(ejs, "Cannot delete typed array elements");
+    return EJS_ERR;
+}
+
+
+static int getTypedArrayPropertyCount(Ejs *ejs, EjsTypedArray *ta)
+{
+    return (int) ta->length;
+}
+
+
+static EjsNumber *getTypedArrayProperty(Ejs *ejs, EjsTypedArray *ta, int slotNum)
+{
+    if (slotNum < 0 || slotNum >= ta->length) {
+        ejsThrowOutOfBoundsError(ejs, "Bad array subscript");
+        return 0;
+    }
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    return ejsCreateNumber(ejs, ejsGetTypedArrayElement(ta, slotNum));
+}
+
+
+static int lookupTypedArrayProperty(Ejs *ejs, EjsTypedArray *ta, EjsName qname)
+{
+    int     index;
+
+    if (qname.name == 0 || !isdigit((uchar) qname.name->value[0])) {
+        return EJS_ERR;
+    }
+    index = ejsAtoi(ejs, qname.name, 10);
+    if (index < ta->length) {
+        return index;
+    }
+    return EJS_ERR;
+}
+
+
+static int setTypedArrayProperty(Ejs *ejs, EjsTypedArray *ta, int slotNum, EjsObj *value)
+{
+    if (slotNum < 0 || slotNum >= ta->length) {
+        ejsThrowOutOfBoundsError(ejs, "Bad array subscript");
+        return EJS_ERR;
+    }
+    if (!validView(ejs, ta)) {
+        return EJS_ERR;
+    }
+    if (!ejsIs(ejs, value, Number)) {
+        value = (EjsObj*) ejsToNumber(ejs, value);
+    }
+    ejsSetTypedArrayElement(ta, slotNum, ejsGetNumber(ejs, value));
+    return slotNum;
+}
+
+/*********************************** Methods **********************************/
+/*
+    function Float64Array(data: Object = 0, byteOffset: Number = 0, length: Number = -1)
+    Also used for Int32Array and Uint8Array.
+ */
+static EjsTypedArray *ta_TypedArray(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    EjsTypedArray   *src;
+    EjsObj          *data;
+    ssize           i, count, offset, length;
+    int             kind;
+
+    kind = getKind(ejs, TYPE(ta));
+    data = (argc >= 1) ? argv[0] : ESV(zero);
+    offset = (argc >= 2) ? ejsGetInt(ejs, argv[1]) : 0;
+    length = (argc >= 3) ? ejsGetInt(ejs, argv[2]) : -1;
+
+    if (ejsIs(ejs, data, ByteArray)) {
+        if (initTypedArray(ejs, ta, kind, (EjsByteArray*) data, offset, length) < 0) {
+            return 0;
+        }
+
+    } else if (ejsIs(ejs, data, Array)) {
+        count = ((EjsArray*) data)->length;
+        if (initTypedArray(ejs, ta, kind, NULL, 0, count) < 0) {
+            return 0;
+        }
+        for (i = 0; i < count; i++) {
+            ejsSetTypedArrayElement(ta, i, ejsGetNumber(ejs, ejsToNumber(ejs, ((EjsArray*) data)->data[i])));
+        }
+
+    } else if (ejsIsTypedArray(ejs, data)) {
+        src = (EjsTypedArray*) data;
+        if (!validView(ejs, src) || initTypedArray(ejs, ta, kind, NULL, 0, src->length) < 0) {
+            return 0;
+        }
+        if (src->kind == kind) {
+            memcpy(ta->buffer->value, &src->buffer->value[src->offset], src->length * src->elementSize);
+        } else {
+            for (i = 0; i < src->length; i++) {
+                ejsSetTypedArrayElement(ta, i, ejsGetTypedArrayElement(src, i));
+            }
+        }
+
+    } else if (ejsIs(ejs, data, Number) || !ejsIsDefined(ejs, data)) {
+        count = ejsIsDefined(ejs, data) ? ejsGetInt(ejs, data) : 0;
+        if (count < 0) {
+            ejsThrowArgError(ejs, "Bad typed array length");
+            return 0;
+        }
+        if (initTypedArray(ejs, ta, kind, NULL, 0, count) < 0) {
+            return 0;
+        }
+
+    } else {
+        ejsThrowArgError(ejs, "Typed array data must be a Number, Array, ByteArray or typed array");
+        return 0;
+    }
+    return ta;
+}
+
+
+/*
+    function get buffer(): ByteArray
+ */
+static EjsByteArray *ta_buffer(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    return ta->buffer;
+}
+
+
+/*
+    function get byteLength(): Number
+ */
+static EjsNumber *ta_byteLength(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    return ejsCreateNumber(ejs, (MprNumber) (ta->length * ta->elementSize));
+}
+
+
+/*
+    function get byteOffset(): Number
+ */
+static EjsNumber *ta_byteOffset(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    return ejsCreateNumber(ejs, (MprNumber) ta->offset);
+}
+
+
+/*
+    function copyWithin(target: Number, start: Number = 0, end: Number = -1): TypedArray
+ */
+static EjsTypedArray *ta_copyWithin(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    uchar   *data;
+    ssize   target, start, end, count;
+
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    target = ejsGetInt(ejs, argv[0]);
+    getRange(ejs, ta, argc, argv, 1, &start, &end);
+    if (target < 0 || target >= ta->length) {
+        return ta;
+    }
+    count = min(end - start, ta->length - target);
+    if (count > 0) {
+        data = &ta->buffer->value[ta->offset];
+        memmove(&data[target * ta->elementSize], &data[start * ta->elementSize], count * ta->elementSize);
+    }
+    return ta;
+}
+
+
+/*
+    function fill(value: Number, start: Number = 0, end: Number = -1): TypedArray
+ */
+static EjsTypedArray *ta_fill(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    MprNumber   value;
+    double      *dp;
+    ssize       i, start, end;
+    int         *ip, iv;
+
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    value = ejsGetNumber(ejs, ejsToNumber(ejs, argv[0]));
+    getRange(ejs, ta, argc, argv, 1, &start, &end);
+
+    switch (ta->kind) {
+    case EJS_TYPED_FLOAT64:
+        dp = elements(ta, double);
+        for (i = start; i < end; i++) {
+            dp[i] = value;
+        }
+        break;
+
+    case EJS_TYPED_INT32:
+        ip = elements(ta, int);
+        iv = toInt32(value);
+        for (i = start; i < end; i++) {
+            ip[i] = iv;
+        }
+        break;
+
+    case EJS_TYPED_UINT8:
+        memset(&elements(ta, uchar)[start], (uchar) toInt32(value), end - start);
+        break;
+    }
+    return ta;
+}
+
+
+/*
+    Function to iterate and return the next element index.
+    NOTE: this is not a method of TypedArray. Rather, it is a callback function for Iterator
+ */
+static EjsNumber *nextTypedArrayKey(Ejs *ejs, EjsIterator *ip, int argc, EjsObj **argv)
+{
+    EjsTypedArray   *ta;
+
+    ta = (EjsTypedArray*) ip->target;
+    if (!ejsIsTypedArray(ejs, ta)) {
+        ejsThrowReferenceError(ejs, "Wrong type");
+        return 0;
+    }
+    if (ip->index < ta->length) {
+        return ejsCreateNumber(ejs, ip->index++);
+    }
+    ejsThrowStopIteration(ejs);
+    return 0;
+}
+
+
+/*
+    Return the default iterator. This returns the array index names.
+    iterator native function get(): Iterator
+ */
+static EjsIterator *ta_get(Ejs *ejs, EjsObj *ta, int argc, EjsObj **argv)
+{
+    return ejsCreateIterator(ejs, ta, -1, nextTypedArrayKey, 0, NULL);
+}
+
+
+/*
+    Function to iterate and return the next element value.
+    NOTE: this is not a method of TypedArray. Rather, it is a callback function for Iterator
+ */
+static EjsNumber *nextTypedArrayValue(Ejs *ejs, EjsIterator *ip, int argc, EjsObj **argv)
+{
+    EjsTypedArray   *ta;
+
+    ta = (EjsTypedArray*) ip->target;
+    if (!ejsIsTypedArray(ejs, ta)) {
+        ejsThrowReferenceError(ejs, "Wrong type");
+        return 0;
+    }
+    if (ip->index < ta->length && validView(ejs, ta)) {
+        return ejsCreateNumber(ejs, ejsGetTypedArrayElement(ta, ip->index++));
+    }
+    ejsThrowStopIteration(ejs);
+    return 0;
+}
+
+
+/*
+    Return an iterator to return the next array element value.
+    iterator native function getValues(): Iterator
+ */
+static EjsIterator *ta_getValues(Ejs *ejs, EjsObj *ta, int argc, EjsObj **argv)
+{
+    return ejsCreateIterator(ejs, ta, -1, nextTypedArrayValue, 0, NULL);
+}
+
+
+/*
+    function get length(): Number
+ */
+static EjsNumber *ta_length(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    return ejsCreateNumber(ejs, (MprNumber) ta->length);
+}
+
+
+static ME_INLINE double applyKernel(int op, double value, double operand)
+{
+    switch (op) {
+    case KERNEL_ABS:    return fabs(value);
+    case KERNEL_ADD:    return value + operand;
+    case KERNEL_CEIL:   return ceil(value);
+    case KERNEL_DIV:    return value / operand;
+    case KERNEL_FLOOR:  return floor(value);
+    case KERNEL_MAX:    return (value > operand) ? value : operand;
+    case KERNEL_MIN:    return (value < operand) ? value : operand;
+    case KERNEL_MUL:    return value * operand;
+    case KERNEL_NEG:    return -value;
+    case KERNEL_ROUND:  return floor(value + 0.5);
+    case KERNEL_SQRT:   return sqrt(value);
+    case KERNEL_SUB:    return value - operand;
+    }
+    return value;
+}
+
+
+/*
+    Apply a kernel to float elements. The common arithmetic kernels get dedicated loops so the compiler can vectorize them.
+ */
+static void mapFloat64(double *dp, ssize count, int op, double operand)
+{
+    ssize   i;
+
+    switch (op) {
+    case KERNEL_ADD:
+        for (i = 0; i < count; i++) {
+            dp[i] += operand;
+        }
+        break;
+    case KERNEL_SUB:
+        for (i = 0; i < count; i++) {
+            dp[i] -= operand;
+        }
+        break;
+    case KERNEL_MUL:
+        for (i = 0; i < count; i++) {
+            dp[i] *= operand;
+        }
+        break;
+    case KERNEL_DIV:
+        for (i = 0; i < count; i++) {
+            dp[i] /= operand;
+        }
+        break;
+    case KERNEL_NEG:
+        for (i = 0; i < count; i++) {
+            dp[i] = -dp[i];
+        }
+        break;
+    default:
+        for (i = 0; i < count; i++) {
+            dp[i] = applyKernel(op, dp[i], operand);
+        }
+        break;
+    }
+}
+
+
+/*
+    function map(kernel: Object, operand: Number = 0): TypedArray
+ */
+static EjsTypedArray *ta_map(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    EjsObj      *funArgs[3], *result;
+    MprNumber   operand;
+    uchar       *bp;
+    ssize       i;
+    int         *ip, op, iop;
+
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    if (ejsIsFunction(ejs, argv[0])) {
+        for (i = 0; i < ta->length; i++) {
+            funArgs[0] = (EjsObj*) ejsCreateNumber(ejs, ejsGetTypedArrayElement(ta, i));
+            funArgs[1] = (EjsObj*) ejsCreateNumber(ejs, (MprNumber) i);
+            funArgs[2] = (EjsObj*) ta;
+            result = ejsRunFunction(ejs, (EjsFunction*) argv[0], 0, 3, funArgs);
+            if (ejs->exception || !validView(ejs, ta)) {
+                return 0;
+            }
+            ejsSetTypedArrayElement(ta, i, ejsGetNumber(ejs, ejsToNumber(ejs, result)));
+        }
+        return ta;
+    }
+    for (op = 0; kernels[op]; op++) {
+        if (ejsCompareAsc(ejs, ejsToString(ejs, argv[0]), kernels[op]) == 0) {
+            break;
+        }
+    }
+    if (kernels[op] == 0) {
+        ejsThrowArgError(ejs, "Unknown map kernel \"%@\"", ejsToString(ejs, argv[0]));
+        return 0;
+    }
+    operand = (argc >= 2) ? ejsGetNumber(ejs, ejsToNumber(ejs, argv[1])) : 0;
+
+    switch (ta->kind) {
+    case EJS_TYPED_FLOAT64:
+        mapFloat64(elements(ta, double), ta->length, op, operand);
+        break;
+
+    case EJS_TYPED_INT32:
+        ip = elements(ta, int);
+        if (op == KERNEL_ADD && operand == (iop = (int) operand)) {
+            for (i = 0; i < ta->length; i++) {
+                ip[i] = (int) ((uint) ip[i] + (uint) iop);
+            }
+        } else {
+            for (i = 0; i < ta->length; i++) {
+                ip[i] = toInt32(applyKernel(op, ip[i], operand));
+            }
+        }
+        break;
+
+    case EJS_TYPED_UINT8:
+        bp = elements(ta, uchar);
+        for (i = 0; i < ta->length; i++) {
+            bp[i] = (uchar) toInt32(applyKernel(op, bp[i], operand));
+        }
+        break;
+    }
+    return ta;
+}
+
+
+/*
+    Compute the min or max of a non-empty array. Uses independent lanes to break the comparison dependency chain.
+ */
+static MprNumber reduceMinMax(EjsTypedArray *ta, bool wantMax)
+{
+    double      v, r0, r1, r2, r3;
+    ssize       i, n;
+
+    n = ta->length;
+    r0 = r1 = r2 = r3 = ejsGetTypedArrayElement(ta, 0);
+    i = 0;
+    if (ta->kind == EJS_TYPED_FLOAT64) {
+        double *dp = elements(ta, double);
+        if (wantMax) {
+            for (; i + 4 <= n; i += 4) {
+                r0 = dp[i] > r0 ? dp[i] : r0;
+                r1 = dp[i + 1] > r1 ? dp[i + 1] : r1;
+                r2 = dp[i + 2] > r2 ? dp[i + 2] : r2;
+                r3 = dp[i + 3] > r3 ? dp[i + 3] : r3;
+            }
+        } else {
+            for (; i + 4 <= n; i += 4) {
+                r0 = dp[i] < r0 ? dp[i] : r0;
+                r1 = dp[i + 1] < r1 ? dp[i + 1] : r1;
+                r2 = dp[i + 2] < r2 ? dp[i + 2] : r2;
+                r3 = dp[i + 3] < r3 ? dp[i + 3] : r3;
+            }
+        }
+    }
+    for (; i < n; i++) {
+        v = ejsGetTypedArrayElement(ta, i);
+        if (wantMax ? (v > r0) : (v < r0)) {
+            r0 = v;
+        }
+    }
+    if (wantMax) {
+        r0 = max(max(r0, r1), max(r2, r3));
+    } else {
+        r0 = min(min(r0, r1), min(r2, r3));
+    }
+    return r0;
+}
+
+
+/*
+    function max(): Number
+ */
+static EjsNumber *ta_max(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    if (ta->length == 0) {
+        return ESV(negativeInfinity);
+    }
+    return ejsCreateNumber(ejs, reduceMinMax(ta, 1));
+}
+
+
+/*
+    function min(): Number
+ */
+static EjsNumber *ta_min(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    if (ta->length == 0) {
+        return ESV(infinity);
+    }
+    return ejsCreateNumber(ejs, reduceMinMax(ta, 0));
+}
+
+
+/*
+    function sum(): Number
+ */
+static EjsNumber *ta_sum(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    double      *dp, s0, s1, s2, s3;
+    int64       isum;
+    uchar       *bp;
+    ssize       i, n;
+    int         *ip;
+
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    n = ta->length;
+    switch (ta->kind) {
+    case EJS_TYPED_FLOAT64:
+        dp = elements(ta, double);
+        s0 = s1 = s2 = s3 = 0;
+        for (i = 0; i + 4 <= n; i += 4) {
+            s0 += dp[i];
+            s1 += dp[i + 1];
+            s2 += dp[i + 2];
+            s3 += dp[i + 3];
+        }
+        for (; i < n; i++) {
+            s0 += dp[i];
+        }
+        return ejsCreateNumber(ejs, (s0 + s1) + (s2 + s3));
+
+    case EJS_TYPED_INT32:
+        ip = elements(ta, int);
+        for (isum = 0, i = 0; i < n; i++) {
+            isum += ip[i];
+        }
+        return ejsCreateNumber(ejs, (MprNumber) isum);
+
+    case EJS_TYPED_UINT8:
+    default:
+        bp = elements(ta, uchar);
+        for (isum = 0, i = 0; i < n; i++) {
+            isum += bp[i];
+        }
+        return ejsCreateNumber(ejs, (MprNumber) isum);
+    }
+}
+
+
+/*
+    function toArray(): Array
+ */
+static EjsArray *ta_toArray(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    EjsArray    *ap;
+    ssize       i;
+
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    if ((ap = ejsCreateArray(ejs, (int) ta->length)) == 0) {
+        return 0;
+    }
+    for (i = 0; i < ta->length; i++) {
+        ap->data[i] = (EjsObj*) ejsCreateNumber(ejs, ejsGetTypedArrayElement(ta, i));
+    }
+    return ap;
+}
+
+
+/*
+    function toString(): String
+ */
+static EjsString *ta_toString(Ejs *ejs, EjsTypedArray *ta, int argc, EjsObj **argv)
+{
+    MprBuf      *buf;
+    MprNumber   value;
+    ssize       i;
+
+    if (!validView(ejs, ta)) {
+        return 0;
+    }
+    buf = mprCreateBuf(ta->length * 4 + 1, -1);
+    for (i = 0; i < ta->length; i++) {
+        if (i > 0) {
+            mprPutCharToBuf(buf, ',');
+        }
+        value = ejsGetTypedArrayElement(ta, i);
+        if (ta->kind != EJS_TYPED_FLOAT64) {
+            mprPutIntToBuf(buf, (int64) value);
+        } else {
+            mprPutStringToBuf(buf, ejsToMulti(ejs, ejsCreateNumber(ejs, value)));
+        }
+    }
+    mprAddNullToBuf(buf);
+    return ejsCreateStringFromAsc(ejs, mprGetBufStart(buf));
+}
+
+/********************************* Public Support API *****************************/
+
+PUBLIC MprNumber ejsGetTypedArrayElement(EjsTypedArray *ta, ssize index)
+{
+    switch (ta->kind) {
+    case EJS_TYPED_INT32:
+        return (MprNumber) elements(ta, int)[index];
+    case EJS_TYPED_UINT8:
+        return (MprNumber) elements(ta, uchar)[index];
+    default:
+        return (MprNumber) elements(ta, double)[index];
+    }
+}
+
+
+PUBLIC void ejsSetTypedArrayElement(EjsTypedArray *ta, ssize index, MprNumber value)
+{
+    switch (ta->kind) {
+    case EJS_TYPED_INT32:
+        elements(ta, int)[index] = toInt32(value);
+        break;
+    case EJS_TYPED_UINT8:
+        elements(ta, uchar)[index] = (uchar) toInt32(value);
+        break;
+    default:
+        elements(ta, double)[index] = (double) value;
+        break;
+    }
+}
+
+/*********************************** Factory **********************************/
+
+static int initTypedArray(Ejs *ejs, EjsTypedArray *ta, int kind, EjsByteArray *buffer, ssize offset, ssize length)
+{
+    ssize   size;
+
+    ta->kind = kind;
+    ta->elementSize = elementSizes[kind];
+
+    if (buffer) {
+        if (offset < 0 || (offset % ta->elementSize) != 0 || offset > buffer->size) {
+            ejsThrowArgError(ejs, "Byte offset must be a multiple of %d and within the buffer", ta->elementSize);
+            return EJS_ERR;
+        }
+        if (length < 0) {
+            if (((buffer->size - offset) % ta->elementSize) != 0) {
+                ejsThrowArgError(ejs, "Buffer size is not a multiple of the element size");
+                return EJS_ERR;
+            }
+            length = (buffer->size - offset) / ta->elementSize;
+        }
+        if ((offset + length * ta->elementSize) > buffer->size) {
+            ejsThrowArgError(ejs, "Typed array view does not fit in the buffer");
+            return EJS_ERR;
+        }
+    } else {
+        if (length < 0) {
+            length = 0;
+        }
+        size = length * ta->elementSize;
+        if ((buffer = ejsCreateByteArray(ejs, max(size, 1))) == 0) {
+            return EJS_ERR;
+        }
+        ejsSetByteArrayPositions(ejs, buffer, 0, size);
+        offset = 0;
+    }
+    ta->buffer = buffer;
+    ta->offset = offset;
+    ta->length = length;
+    return 0;
+}
+
+
+PUBLIC EjsTypedArray *ejsCreateTypedArray(Ejs *ejs, int kind, EjsByteArray *buffer, ssize offset, ssize length)
+{
+    EjsTypedArray   *ta;
+
+    if (kind < EJS_TYPED_FLOAT64 || kind > EJS_TYPED_UINT8) {
+        ejsThrowArgError(ejs, "Bad typed array kind");
+        return 0;
+    }
+    if ((ta = ejsCreateObj(ejs, getKindType(ejs, kind), 0)) == 0) {
+        return 0;
+    }
+    if (initTypedArray(ejs, ta, kind, buffer, offset, length) < 0) {
+        return 0;
+    }
+    return ta;
+}
+
+
+static void manageTypedArray(EjsTypedArray *ta, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(ta->buffer);
+        mprMark(TYPE(ta));
+    }
+}
+
+
+/*
+    The three typed array classes have identical prototype layouts, so the Float64Array slot definitions are used 
+    to bind all of them.
+ */
+static void bindTypedArray(Ejs *ejs, EjsType *type)
+{
+    EjsPot      *prototype;
+
+    prototype = type->prototype;
+    ejsBindConstructor(ejs, type, ta_TypedArray);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_buffer, ta_buffer);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_byteLength, ta_byteLength);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_byteOffset, ta_byteOffset);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_copyWithin, ta_copyWithin);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_fill, ta_fill);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_iterator_get, ta_get);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_iterator_getValues, ta_getValues);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_length, ta_length);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_map, ta_map);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_max, ta_max);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_min, ta_min);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_sum, ta_sum);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_toArray, ta_toArray);
+    ejsBindMethod(ejs, prototype, ES_Float64Array_toString, ta_toString);
+}
+
+
+static EjsType *configureType(Ejs *ejs, cchar *name)
+{
+    EjsType     *type;
+    EjsHelpers  *helpers;
+
+    if ((type = ejsFinalizeScriptType(ejs, N("ejs", name), sizeof(EjsTypedArray), manageTypedArray,
+            EJS_TYPE_OBJ | EJS_TYPE_NUMERIC_INDICIES | EJS_TYPE_VIRTUAL_SLOTS | EJS_TYPE_MUTABLE_INSTANCES)) == 0) {
+        return 0;
+    }
+    helpers = &type->helpers;
+    helpers->cast = (EjsCastHelper) castTypedArray;
+    helpers->clone = (EjsCloneHelper) cloneTypedArray;
+    helpers->deleteProperty = (EjsDeletePropertyHelper) deleteTypedArrayProperty;
+    helpers->getProperty = (EjsGetPropertyHelper) getTypedArrayProperty;
+    helpers->getPropertyCount = (EjsGetPropertyCountHelper) getTypedArrayPropertyCount;
+    helpers->lookupProperty = (EjsLookupPropertyHelper) lookupTypedArrayProperty;
+    helpers->setProperty = (EjsSetPropertyHelper) setTypedArrayProperty;
+    return type;
+}
+
+
+PUBLIC void ejsConfigureTypedArrayTypes(Ejs *ejs)
+{
+    EjsType     *type;
+
+    if ((type = configureType(ejs, "Float64Array")) != 0) {
+        bindTypedArray(ejs, type);
+    }
+    if ((type = configureType(ejs, "Int32Array")) != 0) {
+        bindTypedArray(ejs, type);
+    }
+    if ((type = configureType(ejs, "Uint8Array")) != 0) {
+        bindTypedArray(ejs, type);
+    }
+}
+
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
@@ -8,3 +8,10 @@ cache.write("message", "Hello World", {lifespan: 1})
 assert(cache.read("message") == "Hello World")
 App.sleep(1100)
 assert(cache.read("message") == null)
+
+//  Rewriting with a zero lifespan clears the prior lifespan, including for later updates
+cache.write("counter", "1", {lifespan: 1})
+cache.write("counter", "2", {lifespan: 0})
+cache.inc("counter")
+App.sleep(1100)
+assert(cache.read("counter") == "3")
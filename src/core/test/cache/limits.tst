@@ -0,0 +1,90 @@
+/*
+    Limits, eviction and statistics tests
+ */
+
+//  Hit and miss counters
+cache = new LocalCache
+cache.write("message", "Hello World")
+assert(cache.read("message") == "Hello World")
+assert(cache.read("message") == "Hello World")
+assert(cache.read("missing") == null)
+let limits = cache.limits
+assert(limits.hits == 2)
+assert(limits.misses == 1)
+assert(limits.evictions == 0)
+cache.destroy()
+
+//  Least recently used keys are evicted once the key limit is exceeded
+cache = new LocalCache({keys: 10, resolution: 100})
+for (i = 0; i < 100; i++) {
+    cache.write("key-" + i, "value " + i)
+}
+assert(cache.read("key-99") == "value 99")
+assert(cache.limits.evictions > 0)
+App.sleep(500)
+let count = 0
+for (i = 0; i < 100; i++) {
+    if (cache.read("key-" + i)) {
+        count++
+    }
+}
+assert(count == 10)
+assert(cache.limits.evictions == 90)
+cache.destroy()
+
+//  Keys created by inc count once against the key limit
+cache = new LocalCache({keys: 4, resolution: 200})
+assert(cache.inc("a") == 1)
+assert(cache.inc("b") == 1)
+assert(cache.inc("c") == 1)
+cache.write("d", "4")
+assert(cache.inc("a") == 2)
+App.sleep(600)
+assert(cache.read("a") == "2")
+assert(cache.read("b") == "1")
+assert(cache.read("c") == "1")
+assert(cache.read("d") == "4")
+assert(cache.limits.evictions == 0)
+cache.destroy()
+
+//  The key limit also applies to keys created by inc
+cache = new LocalCache({keys: 4, resolution: 100})
+for (i = 0; i < 10; i++) {
+    cache.inc("key-" + i)
+}
+App.sleep(500)
+count = 0
+for (i = 0; i < 10; i++) {
+    if (cache.read("key-" + i)) {
+        count++
+    }
+}
+assert(count == 4)
+assert(cache.limits.evictions == 6)
+cache.destroy()
+
+//  Memory limit
+cache = new LocalCache({memory: 1000, resolution: 100})
+for (i = 0; i < 100; i++) {
+    cache.write("key-" + i, "x".times(90))
+}
+App.sleep(500)
+count = 0
+for (i = 0; i < 100; i++) {
+    if (cache.read("key-" + i)) {
+        count++
+    }
+}
+assert(count > 0 && count <= 10)
+cache.destroy()
+
+//  Remove all keys
+cache = new LocalCache
+cache.write("a", "1")
+cache.write("b", "2")
+assert(cache.remove(null))
+assert(cache.read("a") == null)
+assert(!cache.remove(null))
+cache.write("a", "3")
+assert(cache.read("a") == "3")
+cache.destroy()
@@ -0,0 +1,46 @@
+/*
+    Test Number to String conversion
+ */
+
+//  Integral values
+assert(String(0) == "0")
+assert(String(-0) == "0")
+assert(String(7) == "7")
+assert(String(-42) == "-42")
+assert(String(1000000) == "1000000")
+assert(String(9007199254740991) == "9007199254740991")
+assert(String(-9007199254740991) == "-9007199254740991")
+assert(String(1e21) == "1e+21")
+assert(String(1e20) == "100000000000000000000")
+
+//  Fractional values use shortest round trip digits
+assert(String(0.1) == "0.1")
+assert(String(-1.5) == "-1.5")
+assert(String(0.1 + 0.2) == "0.30000000000000004")
+assert(String(1/3) == "0.3333333333333333")
+assert(String(5e-324) == "5e-324")
+assert(String(1.7976931348623157e+308) == "1.7976931348623157e+308")
+assert(String(0.000001) == "0.000001")
+assert(String(0.0000001) == "1e-7")
+
+//  Special values
+assert(String(0/0) == "NaN")
+assert(String(1/0) == "Infinity")
+assert(String(-1/0) == "-Infinity")
+
+//  Formatting methods
+assert((3.14159).toFixed(2) == "3.14")
+assert((1234.5678).toPrecision(6) == "1234.57")
+assert((1234.5678).toExponential(2) == "1.23e+3")
+
+//  Repeated conversions return cached strings with the correct values
+for (i = 0; i < 2000; i++) {
+    assert(String(i) == "" + i)
+    assert(String(i + 0.5) == i + ".5")
+    assert(String(-i - 0.5) == "-" + i + ".5")
+}
+assert(String(1023) == "1023")
+assert(String(1024) == "1024")
+assert(String(-1) == "-1")
+assert(serialize([1, 2, 3]) == "[1,2,3]")
+assert(serialize(["a", "b"]) == '["a","b"]')
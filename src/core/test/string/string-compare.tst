@@ -0,0 +1,23 @@
+/*
+    Test String comparison and interning of compact strings
+ */
+
+//  Ordering by code unit
+assert("abc" < "abd")
+assert("abc" < "abcd")
+assert("abcd" > "abc")
+assert(!("abc" < "abc"))
+assert("" < "a")
+assert("Z" < "a")
+
+//  Characters above 0x7F sort after ASCII
+assert("z" < "é")
+assert("é" > "z")
+assert("café" > "cafe")
+
+//  Equal strings built different ways are interned to the same value
+let s = "hello" + " " + "world"
+assert(s == "hello world")
+assert(s === "hello world")
+assert("hello world".slice(0, 5) == "hello")
+assert(["b", "a", "é", "c"].sort().join(",") == "a,b,c,é")
@@ -0,0 +1,72 @@
+/*
+    Test String search, split, replace and case conversion
+ */
+
+//  indexOf / lastIndexOf / contains
+assert("hello world".indexOf("o") == 4)
+assert("hello world".indexOf("o", 5) == 7)
+assert("hello world".indexOf("world") == 6)
+assert("hello world".indexOf("xyz") == -1)
+assert("hello world".indexOf("hello world!") == -1)
+assert("hello world".lastIndexOf("o") == 7)
+assert("hello world".lastIndexOf("hello") == 0)
+assert("hello world".lastIndexOf("xyz") == -1)
+assert("hello world".contains("lo w"))
+assert(!"hello world".contains("low"))
+assert(!"hello world".contains(""))
+
+//  Long patterns in long subjects use a skip search
+let line = "GET /index.html HTTP/1.1 200 "
+let log = ""
+for (i = 0; i < 100; i++) {
+    log += line
+}
+let needle = "Mozilla/5.0 (X11; Linux x86_64)"
+assert(log.indexOf(needle) == -1)
+let big = log + needle + log
+assert(big.indexOf(needle) == log.length)
+assert(big.contains(needle))
+assert(big.indexOf(needle + "x") == -1)
+assert((log + "ab" + needle.slice(0, -1)).indexOf(needle) == -1)
+
+//  split
+assert("a,b,c".split(",").length == 3)
+assert("a,b,c".split(",").join("|") == "a|b|c")
+assert(",a,,b,".split(",").length == 5)
+assert(",a,,b,".split(",").join("|") == "|a||b|")
+assert("abc".split(",").length == 1)
+assert("abc".split(",")[0] == "abc")
+assert("a--b--c".split("--").join("|") == "a|b|c")
+assert("abc".split("").join("|") == "a|b|c")
+assert("a,b,c,d".split(",", -1).length == 4)
+
+//  An explicit split limit bounds the characters scanned, not the elements returned
+assert(serialize("x".split(",", 0)) == '[""]')
+assert(serialize("a,b,c,d".split(",", 0)) == '[""]')
+assert(serialize("a,b,c,d".split(",", 2)) == '["a",""]')
+assert(serialize("a,b,c,d".split(",", 4)) == '["a","b",""]')
+assert(serialize("a--b--c".split("--", 4)) == '["a","b",""]')
+assert(serialize("a,b".split(",", 100)) == '["a","b"]')
+assert(serialize("abc".split("", 0)) == '[]')
+assert("abc".split("", 2).join("|") == "a|b")
+assert("".split(",").length == 1)
+
+//  replace
+assert("hello world".replace("world", "there") == "hello there")
+assert("hello world".replace("hello", "") == " world")
+assert("hello world".replace("xyz", "abc") == "hello world")
+assert("aaa".replace("a", "bb") == "bbaa")
+assert("hello world".replace("o", function(s) s.toUpperCase()) == "hellO world")
+
+//  trim
+assert("  abc  ".trim() == "abc")
+assert("--abc--".trim("-") == "abc")
+assert("abab".trim("ab") == "")
+assert("--abc--".trimStart("-") == "abc--")
+assert("--abc--".trimEnd("-") == "--abc")
+
+//  Case conversion
+assert("hello".toLowerCase() == "hello")
+assert("Hello".toLowerCase() == "hello")
+assert("HELLO".toUpperCase() == "HELLO")
+assert("heLLo".toUpperCase() == "HELLO")
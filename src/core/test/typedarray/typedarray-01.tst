@@ -0,0 +1,136 @@
+/*
+    Typed array tests. Construction, element access, views over ByteArrays and native bulk methods.
+ */
+
+//  Construction
+
+var f = new Float64Array(4)
+assert(f.length == 4)
+assert(f.byteLength == 32)
+assert(f.byteOffset == 0)
+assert(f.buffer is ByteArray)
+assert(f[0] == 0 && f[3] == 0)
+assert(Float64Array.BYTES_PER_ELEMENT == 8)
+assert(Int32Array.BYTES_PER_ELEMENT == 4)
+assert(Uint8Array.BYTES_PER_ELEMENT == 1)
+
+var a = new Int32Array([1, 2, 3])
+assert(a.length == 3)
+assert(a[0] == 1 && a[1] == 2 && a[2] == 3)
+
+//  Element access and conversion
+
+f[1] = 1.5
+assert(f[1] == 1.5)
+a[0] = 7.9
+assert(a[0] == 7)
+a[1] = 4294967297
+assert(a[1] == 1)
+a[2] = -1
+assert(a[2] == -1)
+
+var u = new Uint8Array(2)
+u[0] = 257
+assert(u[0] == 1)
+u[1] = -1
+assert(u[1] == 255)
+
+//  Out of range access throws
+
+let caught
+try { u[5]; } catch (e) { caught = e }
+assert(caught is OutOfBoundsError)
+
+//  Copy from another typed array
+
+var c = new Float64Array(a)
+assert(c.length == 3)
+assert(c[0] == 7 && c[2] == -1)
+
+//  Views over a ByteArray share storage
+
+var b = new ByteArray(16)
+var v8 = new Uint8Array(b)
+assert(v8.length == 16)
+v8[2] = 65
+assert(b[2] == 65)
+b[3] = 66
+assert(v8[3] == 66)
+var v32 = new Int32Array(b, 4, 2)
+assert(v32.byteOffset == 4)
+assert(v32.length == 2)
+v32[0] = 0x01010101
+assert(v8[4] == 1 && v8[7] == 1)
+
+//  Misaligned and oversized views are rejected
+
+caught = null
+try { new Int32Array(b, 3); } catch (e) { caught = e }
+assert(caught is ArgError)
+caught = null
+try { new Float64Array(b, 8, 4); } catch (e) { caught = e }
+assert(caught is ArgError)
+
+//  Bulk methods
+
+var n = new Float64Array([3, -1, 4, 1, 5, 9, 2, 6])
+assert(n.sum() == 29)
+assert(n.min() == -1)
+assert(n.max() == 9)
+assert(new Float64Array(0).max() == -Infinity)
+assert(new Float64Array(0).min() == Infinity)
+
+n.fill(2, 0, 4)
+assert(n.toString() == "2,2,2,2,5,9,2,6")
+n.copyWithin(0, 4)
+assert(n.toString() == "5,9,2,6,5,9,2,6")
+
+n.map("mul", 2)
+assert(n[0] == 10 && n[1] == 18)
+n.map("neg")
+assert(n[0] == -10)
+n.map("abs").map("sqrt")
+assert(n[2] == 2)
+n.map(function (value, index) index)
+assert(n[7] == 7)
+
+let i32 = new Int32Array([1, 2, 3, 4, 5])
+i32.map("add", 10)
+assert(i32.toString() == "11,12,13,14,15")
+assert(i32.sum() == 65)
+
+caught = null
+try { i32.map("unknown"); } catch (e) { caught = e }
+assert(caught is ArgError)
+
+//  Int32 conversion wraps modulo 2^32
+
+let w = new Int32Array(6)
+w[0] = 4294967297
+w[1] = -2147483649
+w[2] = 1e20
+w[3] = NaN
+w[4] = Infinity
+w[5] = -3.7
+assert(w[0] == 1)
+assert(w[1] == 2147483647)
+assert(w[2] == 1661992960)
+assert(w[3] == 0 && w[4] == 0)
+assert(w[5] == -3)
+
+//  Conversion and iteration
+
+let arr = i32.toArray()
+assert(arr is Array)
+assert(arr.length == 5 && arr[4] == 15)
+
+let total = 0
+for each (let e in i32) {
+    total += e
+}
+assert(total == 65)
+let keys = 0
+for (let k in i32) {
+    keys += k
+}
+assert(keys == 10)
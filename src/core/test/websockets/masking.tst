@@ -0,0 +1,66 @@
+/*
+    WebSocket masking and buffered message tests. Payloads longer than eight bytes and not a multiple of eight 
+    exercise the word at a time masking. Several messages are sent per callback so they are flushed together.
+ */
+
+const HTTP = App.config.uris.http
+const TIMEOUT = 30000
+
+function fetch(path: String): String {
+    let http = new Http
+    http.get(HTTP + path)
+    http.wait(TIMEOUT)
+    assert(http.status == Http.Ok)
+    let response = http.response
+    http.close()
+    return response
+}
+
+function payload(length: Number, seed: Number): String {
+    let result = ""
+    for (i in length) {
+        result += String.fromCharCode(48 + (i * 7 + seed) % 43)
+    }
+    return result
+}
+
+fetch("/reset")
+
+let messages = [
+    payload(9, 1), payload(13, 2), payload(15, 3), payload(17, 4), payload(101, 5), payload(1001, 6),
+    payload(16387, 7)
+]
+let expected = messages.join("")
+
+let uri = Uri(HTTP)
+let ws = new WebSocket("ws://" + uri.host + ":" + uri.port + "/echo")
+ws.onopen = function (event) {
+    for each (msg in messages) {
+        ws.send(msg)
+    }
+}
+assert(ws.wait(WebSocket.OPEN, TIMEOUT))
+
+let received
+let deadline = Date.now() + TIMEOUT
+do {
+    App.run(100, true)
+    received = fetch("/received")
+} while (received.length < expected.length && Date.now() < deadline)
+assert(received.length == expected.length)
+assert(received == expected)
+
+//  Messages sent outside a callback
+fetch("/reset")
+ws.send(messages[1])
+ws.send(messages[2])
+ws.send(messages[5])
+expected = messages[1] + messages[2] + messages[5]
+deadline = Date.now() + TIMEOUT
+do {
+    App.run(100, true)
+    received = fetch("/received")
+} while (received.length < expected.length && Date.now() < deadline)
+assert(received == expected)
+
+ws.close()
@@ -0,0 +1,35 @@
+#!/usr/bin/env ejs
+
+/*
+    Start a server that records WebSocket message data. The recorded data is returned by "/received".
+*/
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+var received = ""
+
+let server: HttpServer = new HttpServer
+server.on("readable", function (event, request) {
+    if (request.header("Upgrade") == "websocket") {
+        request.on("readable", function (event, request) {
+            let data = new ByteArray
+            while (request.read(data) > 0) {
+                received += data.toString()
+                data.flush()
+            }
+        })
+    } else if (request.pathInfo == "/received") {
+        request.setHeader("Content-Type", "text/plain")
+        request.write(received)
+        request.finalize()
+    } else if (request.pathInfo == "/reset") {
+        received = ""
+        request.finalize()
+    } else {
+        request.status = Http.NotFound
+        request.finalize()
+    }
+})
+server.listen(HTTP)
+App.run()
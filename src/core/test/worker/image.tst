@@ -0,0 +1,37 @@
+/*
+    Module image cache tests. Workers loading the same module share the cached module image.
+ */
+
+let source = Path("image.tmp.es")
+let mod = Path("image.tmp.mod")
+
+function compile(message: String) {
+    source.write('postMessage("' + message + '")\n')
+    Cmd.run(test.bin.join('ejsc') + ' --out ' + mod + ' ' + source)
+}
+
+function run(): String {
+    let msg = null
+    let w = new Worker(mod)
+    w.onmessage = function (e) {
+        msg = deserialize(e.data)
+    }
+    Worker.join()
+    return msg
+}
+
+//  Repeated loads of an unmodified module
+compile("First")
+for (i in 4) {
+    assert(run() == "First")
+}
+
+//  Modified modules are detected once the cached image is revalidated
+App.sleep(1100)
+compile("Second version")
+App.sleep(1100)
+assert(run() == "Second version")
+assert(run() == "Second version")
+
+source.remove()
+mod.remove()
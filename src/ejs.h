@@ -48,7 +48,11 @@ extern "C" {
 
 #define EJS_HASH_MIN_PROP           8               /**< Min props to hash */
 #define EJS_MAX_COLLISIONS          4               /**< Max intern string collion chain before rehash */
+#define EJS_INTERN_INTEGERS         1024            /**< Cached interned strings for integers 0 to N-1 */
+#define EJS_NUMBER_CACHE            64              /**< Recently converted number strings cached per VM */
 #define EJS_POOL_INACTIVITY_TIMEOUT (60  * 1000)    /**< Prune inactive pooled VMs older than this */
+#define EJS_MODULE_CACHE_MAX        256             /**< Max module file images shared by all interpreters */
+#define EJS_MODULE_CACHE_CHECK      1000            /**< Period to revalidate cached module images (msecs) */
 #define EJS_SESSION_TIMER_PERIOD    (60 * 1000)     /**< Timer checks ever minute */
 #define EJS_FILE_PERMS              0664            /**< Default file perms */
 #define EJS_DIR_PERMS               0775            /**< Default dir perms */
@@ -370,9 +374,11 @@ PUBLIC EjsName ejsEmptyName(struct Ejs *ejs, cchar *name);
 #define S_Event ES_Event
 #define S_File ES_File
 #define S_FileSystem ES_FileSystem
+#define S_Float64Array ES_Float64Array
 #define S_Frame ES_Frame
 #define S_Function ES_Function
 #define S_Http ES_Http
+#define S_Int32Array ES_Int32Array
 #define S_Namespace ES_Namespace
 #define S_Null ES_Null
 #define S_Number ES_Number
@@ -381,6 +387,7 @@ PUBLIC EjsName ejsEmptyName(struct Ejs *ejs, cchar *name);
 #define S_RegExp ES_RegExp
 #define S_String ES_String
 #define S_Type ES_Type
+#define S_Uint8Array ES_Uint8Array
 #define S_Uri ES_Uri
 #define S_Void ES_Void
 #define S_Worker ES_Worker
@@ -500,6 +507,9 @@ typedef struct Ejs {
 
     Http                *http;              /**< Http service object (copy of EjsService.http) */
     MprMutex            *mutex;             /**< Multithread locking */
+
+    double              numberKeys[EJS_NUMBER_CACHE];               /**< Recently converted numbers */
+    struct EjsString    *numberStrings[EJS_NUMBER_CACHE];           /**< String values for numberKeys */
 } Ejs;
 
 
@@ -1395,12 +1405,15 @@ PUBLIC bool ejsMatchName(Ejs *ejs, EjsName *a, EjsName *b);
     searching, conversion, matching, replacement, and, subsetting.
     \n\n
     Strings are currently sequences of Unicode characters. Depending on the configuration, they may be 8, 16 or 32 bit
-    code point values.
+    code point values. With the default ME_CHAR_LEN of 1, strings use a compact one byte per character representation
+    holding ASCII, Latin-1 or UTF-8 content. In this configuration, comparisons and interning operate on the raw bytes
+    and #ejsGetMulti can return the string storage to C code without transcoding or copying.
     @defgroup EjsString EjsString
     @see EjsString ejsAtoi ejsCompareAsc ejsCompareString ejsCompareSubstring ejsCompareWide ejsContainsAsc 
         ejsContainsChar ejsContainsString ejsCreateBareString ejsCreateString ejsCreateStringFromAsc 
-        ejsCreateStringFromBytes ejsCreateStringFromConst ejsCreateStringFromMulti ejsCreateStringWithLength 
-        ejsDestroyIntern ejsInternAsc ejsInternMulti ejsInternString ejsInternWide ejsJoinString 
+        ejsCreateStringFromBytes ejsCreateStringFromConst ejsCreateStringFromInt ejsCreateStringFromMulti 
+        ejsCreateStringWithLength 
+        ejsDestroyIntern ejsGetMulti ejsInternAsc ejsInternMulti ejsInternString ejsInternWide ejsJoinString 
         ejsJoinStrings ejsSerialize ejsSerializeWithOptions ejsSprintf ejsStartsWithAsc ejsStrcat ejsStrdup 
         ejsSubstring ejsToJSON ejsToLiteralString ejsToMulti ejsToString ejsToUpper ejsTruncateString ejsVarToString 
         ejsToLower 
@@ -1455,6 +1468,17 @@ PUBLIC EjsString *ejsCreateStringFromAsc(Ejs *ejs, cchar *value);
  */
 PUBLIC EjsString *ejsCreateStringFromBytes(Ejs *ejs, cchar *value, ssize len);
 
+/**
+    Create a string from an integer
+    @description The decimal strings for small non-negative integers are cached and shared by all interpreters so 
+        repeated conversions of indexes, counts and status codes do not allocate.
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param value Integer value to convert
+    @returns Interned string representation of the value.
+    @ingroup EjsString
+ */
+PUBLIC EjsString *ejsCreateStringFromInt(Ejs *ejs, int64 value);
+
 /**
     Create a string from UTF-8 multibyte string
     @param ejs Ejs reference returned from #ejsCreateVM
@@ -1691,6 +1715,19 @@ PUBLIC int ejsStartsWithAsc(Ejs *ejs, EjsString *sp, cchar *pat);
  */
 PUBLIC char *ejsToMulti(Ejs *ejs, void *obj);
 
+/** 
+    Get a read-only UTF-8 representation of an object
+    @description This is similar to #ejsToMulti but avoids copying where possible. If the object is a string and strings
+        use the compact one byte representation, a reference to the string storage is returned. Otherwise the object
+        is converted as per #ejsToMulti. The result must not be modified, and must not be retained in a managed 
+        structure or passed to mprMark as it may refer to memory inside the string object.
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param obj Object to convert
+    @return A read-only multibyte UTF-8 representation.
+    @ingroup EjsString
+ */
+PUBLIC cchar *ejsGetMulti(Ejs *ejs, void *obj);
+
 //  TODO - rename ejsFormat
 /** 
     Format arguments
@@ -2777,6 +2814,75 @@ PUBLIC bool ejsMakeRoomInByteArray(Ejs *ejs, EjsByteArray *ba, ssize require);
  */
 PUBLIC struct EjsNumber *ejsWriteToByteArray(Ejs *ejs, EjsByteArray *ba, int argc, EjsObj **argv);
 
+/******************************************* TypedArray *******************************************/
+/*
+    Typed array element kinds
+ */
+#define EJS_TYPED_FLOAT64   0           /**< 64-bit IEEE double elements */
+#define EJS_TYPED_INT32     1           /**< Signed 32-bit integer elements */
+#define EJS_TYPED_UINT8     2           /**< Unsigned 8-bit integer elements */
+
+/**
+    TypedArray classes (Float64Array, Int32Array, Uint8Array)
+    @description Typed arrays are fixed length views of native numeric elements stored in the value of a ByteArray.
+        The view references the ByteArray object rather than its data pointer so the ByteArray may grow beneath it.
+    @defgroup EjsTypedArray EjsTypedArray
+    @see EjsTypedArray ejsCreateTypedArray ejsGetTypedArrayElement ejsIsTypedArray ejsSetTypedArrayElement
+    @stability Prototype
+ */
+typedef struct EjsTypedArray {
+    EjsObj          obj;                /**< Base object */
+    EjsByteArray    *buffer;            /**< Byte array providing element storage */
+    ssize           offset;             /**< Byte offset of the first element in buffer */
+    ssize           length;             /**< Number of elements */
+    int             kind;               /**< Element kind (EJS_TYPED_*) */
+    int             elementSize;        /**< Size of an element in bytes */
+} EjsTypedArray;
+
+/**
+    Create a typed array
+    @description Create a new typed array instance. If buffer is null, a new zeroed ByteArray of sufficient size
+        is allocated.
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param kind Element kind. Set to EJS_TYPED_FLOAT64, EJS_TYPED_INT32 or EJS_TYPED_UINT8.
+    @param buffer Optional byte array to provide the element storage
+    @param offset Byte offset into buffer for the first element. Must be a multiple of the element size.
+    @param length Number of elements. Set to -1 to use the remainder of buffer.
+    @return A new typed array instance. Returns null and throws an exception if the arguments are invalid.
+    @ingroup EjsTypedArray
+ */
+PUBLIC EjsTypedArray *ejsCreateTypedArray(Ejs *ejs, int kind, EjsByteArray *buffer, ssize offset, ssize length);
+
+/**
+    Get a typed array element
+    @description The caller must ensure the index is within bounds.
+    @param ta Typed array
+    @param index Element index
+    @return The element value
+    @ingroup EjsTypedArray
+ */
+PUBLIC MprNumber ejsGetTypedArrayElement(EjsTypedArray *ta, ssize index);
+
+/**
+    Set a typed array element
+    @description The value is converted to the element kind. The caller must ensure the index is within bounds.
+    @param ta Typed array
+    @param index Element index
+    @param value Value to store
+    @ingroup EjsTypedArray
+ */
+PUBLIC void ejsSetTypedArrayElement(EjsTypedArray *ta, ssize index, MprNumber value);
+
+/**
+    Test if an object is a typed array
+    @param ejs Ejs reference returned from #ejsCreateVM
+    @param obj Object to test
+    @return True if obj is a Float64Array, Int32Array or Uint8Array
+    @ingroup EjsTypedArray
+ */
+#define ejsIsTypedArray(ejs, obj) (TYPE(obj) == EST(Float64Array) || TYPE(obj) == EST(Int32Array) || \
+    TYPE(obj) == EST(Uint8Array))
+
 /******************************************* Cache ************************************************/
 /**
     EjsCache
@@ -4578,6 +4684,7 @@ PUBLIC void     ejsConfigureStringType(Ejs *ejs);
 PUBLIC void     ejsConfigureSocketType(Ejs *ejs);
 PUBLIC void     ejsConfigureSystemType(Ejs *ejs);
 PUBLIC void     ejsConfigureTimerType(Ejs *ejs);
+PUBLIC void     ejsConfigureTypedArrayTypes(Ejs *ejs);
 PUBLIC void     ejsConfigureTypes(Ejs *ejs);
 PUBLIC void     ejsConfigureUriType(Ejs *ejs);
 PUBLIC void     ejsConfigureVoidType(Ejs *ejs);
@@ -4666,6 +4773,7 @@ typedef struct EjsIntern {
     uint64              reuse;                  /**< Reuse counter */
     uint64              accesses;               /**< NUmber of accesses to string */
     MprMutex            *mutex;
+    struct EjsString    *integers[EJS_INTERN_INTEGERS]; /**< Decimal strings for small integers. Shared by all VMs */
 } EjsIntern;
 
 /**
@@ -5206,7 +5314,7 @@ typedef struct EjsModuleHdr {
 /**
     Module control structure
     @defgroup EjsModule EjsModule
-    @see ejsLoadModule ejsLoadModules ejsSearchForModule ejsCreateSearchPath ejsSetSearchPath
+    @see ejsLoadModule ejsLoadModules ejsRemoveModuleImage ejsSearchForModule ejsCreateSearchPath ejsSetSearchPath
     @stability Internal
  */
 typedef struct EjsModule {
@@ -5372,6 +5480,15 @@ PUBLIC int ejsLoadModules(Ejs *ejs, cchar *search, MprList *require);
  */
 PUBLIC char *ejsSearchForModule(Ejs *ejs, cchar *name, int minVer, int maxVer);
 
+/**
+    Remove a module file image from the module image cache
+    @description Module file images are cached in memory and shared by all interpreters. This routine is called
+        when a module file is rewritten so that subsequent loads will read the new module file.
+    @param path Module file path name
+    @ingroup EjsModule
+ */
+PUBLIC void ejsRemoveModuleImage(cchar *path);
+
 /**
     Set the module search path
     @description Set the ejs module search path. The search path is by default set to the value of the EJSPATH
@@ -0,0 +1,13 @@
+/*
+    BaseController.es - Base class for all controllers
+ */
+require ejs.web
+
+public class BaseController extends Controller {
+
+    public var title: String = "junk"
+    public var style: String
+
+    function BaseController() {
+    }
+}
@@ -76,13 +76,17 @@ module ejs.template  {
                 layoutPage = Path(options.layout)
             }
             this.script = script
+            /*
+                Literal text and expressions are coalesced into a single write() call per run. Literals are emitted 
+                as string constants that are created once when the module is loaded.
+             */
+            let parts: Array = []
             while ((tid = getToken(token)) != Token.Eof) {
                 // print("getToken => " + Token.tokens[tid + 1] + " TOKEN => \"" + token + "\"")
 
                 switch (tid) {
                 case Token.Literal:
-                    //  OPT -- should amalgamate writes
-                    out.write("\n        write(\"" + token + "\");")
+                    parts.push("\"" + token + "\"")
                     break
 
                 case Token.Var:
@@ -91,22 +95,24 @@ module ejs.template  {
                         Catenate with "" to cause toString to run.
                         Write safely by HTML escaping the expression
                      */
-                    out.write("\n        writeSafe(\"\" + ", token, ");\n")
+                    addExpression(out, parts, token.toString(), false)
                     break
 
                 case Token.Equals:
                     /* Write safely by HTML escaping the expression */
-                    out.write("\n        writeSafe(\"\" + (", token, "));\n")
+                    addExpression(out, parts, token.toString(), true)
                     break
 
                 case Token.EjsTag:
                     /*
                         Just copy the Ejscript code straight through
                      */
+                    flushWrites(out, parts)
                     out.write(token.toString())
                     break
 
                 case Token.Control:
+                    flushWrites(out, parts)
                     let args: Array = token.toString().split(/\s/g)
                     let cmd: String = args[0]
 
@@ -161,6 +167,7 @@ module ejs.template  {
 
                 }
             }
+            flushWrites(out, parts)
             if (layoutPage && layoutPage != options.currentLayout) {
                 let layoutOptions = blend(options.clone(), { currentLayout: layoutPage })
                 let layoutText: String = new TemplateParser().parse(layoutPage.readString(), layoutOptions)
@@ -169,6 +176,27 @@ module ejs.template  {
             return out.toString()
         }
 
+        /*
+            Add an HTML escaped expression to the pending writes. Expressions that call functions may write output 
+            themselves, so they must be evaluated after all prior pending output has been written.
+         */
+        private function addExpression(out: ByteArray, parts: Array, expr: String, group: Boolean): Void {
+            if (expr.contains("(") && parts.length > 0) {
+                flushWrites(out, parts)
+            }
+            parts.push("escapeHtml(\"\" + " + (group ? ("(" + expr + ")") : expr) + ")")
+        }
+
+        /*
+            Emit a single write for all pending literals and expressions
+         */
+        private function flushWrites(out: ByteArray, parts: Array): Void {
+            if (parts.length > 0) {
+                out.write("\n        write(" + parts.join(", ") + ");\n")
+                parts.length = 0
+            }
+        }
+
         /*
          *  Get the next input token. Read from script[pos]. Return the next token ID and update the token byte array
          */
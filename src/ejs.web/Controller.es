@@ -66,7 +66,6 @@ module ejs.web {
         var cacheIndex: String
         var cacheOptions: Object
         var cacheName: String
-        var cacheItem: Object
 
         /***************************************** Convenience Getters  ***************************************/
 
@@ -145,14 +144,17 @@ module ejs.web {
             _afterCheckers.append([fn, options])
         }
 
-        private function cacheTag(name: String): String
-            md5(name + Date.now + Date.ticks)
+        /*
+            Cached output may be served directly by the web handler if no checkers or middleware must run first
+         */
+        private function get directCache(): Boolean
+            request.method == "GET" && !_beforeCheckers && !(request.route && request.route.middleware)
 
         /*
-            Fetch cached data from the cache if present.
-            @return a response object
+            Write cached output if present. Otherwise prepare to capture the output of the action.
+            @return True if cached output was written
          */
-        private function fetchCachedResponse(): Object? {
+        private function fetchCachedResponse(): Boolean {
             cacheIndex = getCacheIndex(controllerName, actionName)
             cacheOptions = _allOptions[cacheIndex]
             if (cacheOptions) {
@@ -162,62 +164,20 @@ module ejs.web {
                     let hdr
                     if ((hdr = request.header("Cache-Control")) && (hdr.contains("max-age=0") || hdr.contains("no-cache"))) {
                         App.log.debug(5, "Cache-control header rejects use of cached content")
+                    } else if (request.writeCachedOutput(cacheName, directCache)) {
+                        App.log.debug(5, "Use cached: " + cacheName)
+                        return true
                     } else {
-                        let item = App.cache.readObj(cacheName)
-                        if (item) {
-                            /*
-                                Observe headers
-                                If-None-Match: "ec18d-54-4d706a63"
-                                If-Modified-Since: Fri, 04 Mar 2014 04:28:19 GMT
-                             */
-                            let status = Http.Ok
-                            if ((hdr = request.header("If-None-Match")) && hdr == item.tag) {
-                                /* 
-                                    RFC2616 requires returning PrecondFailed, but chrome doesn't send an If-Modified-Since
-                                    header and so returning PrecondFailed caused Chrome to fail.
-                                 */
-                                // SPEC REQUIRES THIS BUG CHROME FAILS status = Http.PrecondFailed
-                                status = Http.NotModified
-                            }
-                            if ((hdr = request.header("If-Modified-Since"))) {
-                                if (item.modified <= Date.parse(hdr)) {
-                                    status = Http.NotModified
-                                } else {
-                                    status = Http.Ok
-                                }
-                            }
-                            if (cacheOptions.client) {
-                                setHeader("Cache-Control", cacheOptions.client, false)
-                            }
-                            setHeader("Last-Modified", Date(item.modified).toUTCString())
-                            if (status == Http.Ok) {
-                                setHeader("Etag", cacheTag(cacheName))
-                                //  TODO - change this trace to just use "actionName"
-                                App.log.debug(5, "Use cached: " + cacheName)
-                                write(item.data)
-                            } else {
-                                setHeader("Etag", item.tag)
-                                App.log.debug(5, "Use cached content, status: " + status + ", " + cacheName)
-                            }
-                            return {status: status}
-                        }
                         App.log.debug(5, "No cached content for: " + cacheName)
                     }
                     request.writeBuffer = new ByteArray
-                    let when = new Date
-                    cacheItem = { tag: cacheTag(cacheName), modified: Math.floor(when.time / 1000) * 1000}
-                    setHeader("Etag", cacheItem.tag)
-                    setHeader("Last-Modified", when.toUTCString())
                     if (cacheOptions.client) {
                         setHeader("Cache-Control", cacheOptions.client, false)
                     }
-                } else {
-                    setHeader("Last-Modified", Date().toUTCString())
                 }
-            } else {
-                setHeader("Last-Modified", Date().toUTCString())
             }
-            return null
+            setHeader("Last-Modified", Date().toUTCString())
+            return false
         }
 
         /*
@@ -225,9 +185,8 @@ module ejs.web {
          */
         private function saveCachedResponse(): Void {
             if (request.finalized) {
-                let etag = request.responseHeaders["Etag"] || cacheItem.tag
-                cacheItem.data = request.writeBuffer
-                App.cache.writeObj(cacheName, cacheItem, cacheOptions)
+                request.cacheOutput(cacheName, 
+                    {lifespan: cacheOptions.lifespan, client: cacheOptions.client, direct: directCache})
                 App.log.debug(5, "Cache action " + cacheName + ", " + request.writeBuffer.length + " bytes")
             }
             let data = request.writeBuffer
@@ -250,17 +209,9 @@ module ejs.web {
                 return false
             }
             if ((!cacheOptions.uri || cacheOptions.uri == "*" || cacheName == cacheOptions.uri)) {
-                let item
-                if (item = App.cache.readObj(cacheName)) {
+                request.writeBuffer = null
+                if (request.writeCachedOutput(cacheName)) {
                     App.log.debug(5, "Use cached: " + cacheName)
-                    setHeader("Etag", cacheTag(cacheName))
-                    setHeader("Last-Modified", Date(item.modified).toUTCString())
-                    if (cacheOptions.client) {
-                        setHeader("Cache-Control", cacheOptions.client, false)
-                    }
-                    request.writeBuffer = null
-                    write(item.data)
-                    request.finalize()
                     return true
                 }
             }
@@ -288,8 +239,8 @@ module ejs.web {
 
             if (!request.finalized && request.autoFinalizing) {
                 if (App.config.cache.actions.enable) {
-                    if (response = fetchCachedResponse()) {
-                        return response
+                    if (fetchCachedResponse()) {
+                        return null
                     }
                 }
                 if (!(ns)::[actionName]) {
@@ -417,15 +368,12 @@ module ejs.web {
             for each (name in actions) {
                 let cacheIndex = getCacheIndex(cname, name)
                 _allOptions[cacheIndex] = options
-                if (options.lifespan is Number) {
-                    let cacheName = cacheIndex
-                    if (options.uri) {
-                        cacheName += "::" + options.uri
-                    }
-                    /* Invalidate cache data when the app is reloaded */
-                    App.cache.expire(cacheName, null)
-                    App.cache.expire(cacheName, Date().future(options.lifespan * 1000))
+                let cacheName = cacheIndex
+                if (options.uri) {
+                    cacheName += "::" + options.uri
                 }
+                /* Invalidate cached output when the app is reloaded */
+                Request.updateCachedOutput(cacheName, null)
             }
         }
 
@@ -437,8 +385,7 @@ module ejs.web {
                 You can specify "this" in static code or can also use "this" in class instance
                 code and this routine will determine the underlying controller class.
             @param actions Action string or array of actions
-            @param data Object data to cache. Data is serialized using JSON and stored in the cache. Set to null to
-                invalidate/expire cached data.
+            @param data Response data to cache. Set to null to invalidate/expire cached data.
             @param options Cache control options.
             @option uri URI and parameter to further differentiate cached content. If supplied, different cache data
                 can be stored for each URI that applies to the given controller/action. If the URI is set to "*" all 
@@ -470,13 +417,10 @@ module ejs.web {
                 }
                 if (data == null) {
                     App.log.debug(6, "Expire " + cacheName)
-                    App.cache.expire(cacheName, Date())
                 } else {
-                    let etag = cacheTag(cacheName)
-                    App.cache.writeObj(cacheName, 
-                        { tag: etag, modified: Math.floor(Date.now() / 1000) * 1000, data: data}, _allOptions[cacheIndex])
                     App.log.debug(6, "Update cache " + cacheName)
                 }
+                Request.updateCachedOutput(cacheName, data, _allOptions[cacheIndex])
             }
         }
 
@@ -10,6 +10,8 @@ module ejs.web {
         HttpServer objects represents the server-side of Hypertext Transfer Protocol (HTTP) version 1.1 connections. 
         The HttpServer class is used to receive HTTP requests and generate responses. It supports the HTTP/1.1 standard
         including methods for GET, POST, PUT, DELETE, OPTIONS, and TRACE. It also supports Keep-Alive and SSL connections.
+        Dynamic responses are compressed on-the-fly for clients that accept gzip or deflate encoding if the ejsrc 
+        "web.compress" setting is true or is an object of options for Zlib.configureFilter.
         @spec ejs
         @stability evolving
      */
@@ -86,6 +88,14 @@ module ejs.web {
           */
         static var indicies: Array = ["index.ejs", "index.html"]
 
+        /** 
+            Number of listening sockets to open for the endpoint. If greater than one, each socket is opened with 
+            SO_REUSEPORT and the O/S distributes new connections over them. This must be set before calling listen and
+            is initialized from the ejsrc "web.acceptors" setting. Ignored on systems without SO_REUSEPORT.
+         */
+        native function get acceptors(): Number
+        native function set acceptors(count: Number): Void
+
         /** 
             Get the local IP address bound to this socket.
             @returns A string containing the address in dot notation. Returns the empty string if listening on all
@@ -136,6 +146,7 @@ module ejs.web {
             @option clients Maximum number of unique client IP addresses.
             @option connections Maximum number of simultaneous client endpoints.
             @option connReuse Maximum number of times to reuse a connection for requests (KeepAlive count).
+            @option form Maximum size of form data, including multipart form fields. Limited to the receive size.
             @option headers Maximum number of headers in a request.
             @option header Maximum size of headers.
             @option inactivityTimeout Maximum time in seconds to keep a connection open if idle. Set to zero for no timeout.
@@ -271,9 +282,15 @@ server.listen("127.0.0.1:7777")
             }
             web.limits.workers ||= config.cache.workers.limit
             setLimits(web.limits)
+            if (web.acceptors) {
+                acceptors = web.acceptors
+            }
             if (web.session) {
                 openSession()
             }
+            if (web.compress) {
+                openCompression(web.compress)
+            }
             //  TODO - BUG. Need this.fun to bind the function
             setInterval(this.pruneWorkers, PrunePeriod, this)
         }
@@ -290,6 +307,18 @@ server.listen("127.0.0.1:7777")
             }
         }
 
+        /*
+            Add the compression filter to the outgoing pipeline. The filter is provided by the ejs.zlib module.
+         */
+        private function openCompression(options) {
+            let module = "ejs.zlib"
+            if (!global.(module)::["Zlib"]) {
+                global.load(module + ".mod", {reload: false})
+            }
+            (module)::["Zlib"].configureFilter(options is Object ? options : {})
+            setPipeline(null, ["compressFilter", "rangeFilter", "chunkFilter", "webSocketFilter"])
+        }
+
         /** 
             Accept a new incoming for sync servers.  This call creates a request object in response to an 
             incoming client connection on the current HttpServer object.  In async mode, the accept() call is not needed
@@ -598,13 +627,15 @@ server.listen("127.0.0.1:7777")
             Define the stages of the Http processing pipeline. Data flows through the processing pipeline and is
             filtered or transmuted by filter stages. A communications connector is responsible for transmitting to 
             the network.
-            @param incoming Array of stages for the incoming pipeline: default: ["chunk", "range", "upload"]
-            @param outgoing Array of stages for the outgoing pipeline: default: ["auth", "range", "chunk"]
+            @param incoming Array of stages for the incoming pipeline: default: ["chunk", "range", "upload"]. 
+                Set to null to retain the current incoming stages.
+            @param outgoing Array of stages for the outgoing pipeline: default: ["auth", "range", "chunk"].
+                Set to null to retain the current outgoing stages.
             @param connector Network connector to use for I/O. Defaults to the network connector "net". Other values: "send".
                 The "net" connector transparently upgrades to the "send" connector if transmitting static data and 
                 not using SSL, ranged or chunked transfers.
          */
-        native function setPipeline(incoming: Array, outgoing: Array, connector: String): Void
+        native function setPipeline(incoming: Array?, outgoing: Array?, connector: String? = null): Void
 
         /**
             Update the server resource limits. The supplied limit fields are updated.
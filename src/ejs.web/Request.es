@@ -171,6 +171,7 @@ module ejs.web {
             @param limits. Limits is an object hash with the following properties:
             @option chunk Maximum size of a chunk when using chunked transfer encoding.
             @option connReuse Maximum number of times to reuse a connection for requests (KeepAlive count).
+            @option form Maximum size of form data, including multipart form fields. Limited to the receive size.
             @option inactivityTimeout Maximum time in seconds to keep a connection open if idle. Set to zero for no timeout.
             @option receive Maximum size of incoming body data.
             @option requestTimeout Maximum time in seconds for a request to complete. Set to zero for no timeout.
@@ -358,6 +359,20 @@ module ejs.web {
          */
         native function autoFinalize(): Void 
 
+        /**
+            Save the buffered response in the native output cache. The $writeBuffer data, response headers and ETag 
+            are stored so the response can be written by $writeCachedOutput without running script. The ETag, 
+            Last-Modified and Cache-Control headers are defined for this response. Only successful responses are cached.
+            @param name Cache name
+            @param options Cache options
+            @option lifespan Time in seconds for the cached output to persist.
+            @option client Cache-Control header to send to the client.
+            @option direct If true, later GET requests for the same URI are served directly by the web handler 
+                without entering the interpreter.
+            @hide
+         */
+        native function cacheOutput(name: String, options: Object? = null): Void
+
         /** 
             @duplicate Stream.close
             This closes the current request by finalizing all transmission data and sending a "close" event. HttpServer
@@ -437,6 +452,18 @@ module ejs.web {
         function get extension(): String
             Uri(pathInfo).extension
 
+        /**
+            Get metadata for a static file. The metadata is cached and shared by all interpreters. Cached entries are
+            revalidated against the file system at most once per second.
+            @param path Path to the file
+            @param gzip If true and a precompressed "path.gz" variant of the file exists, describe the variant instead.
+            @return An object hash with the properties: path, size, modified, etag, lastModified, encoding and isDir.
+                The encoding is set to "gzip" if the compressed variant was selected. Returns null if the file does
+                not exist.
+            @hide
+         */
+        native function fileInfo(path: Path, gzip: Boolean = false): Object?
+
         /** 
             Signals the end of any and all response data and flushes any buffered write data to the client. 
             If the request has already been finalized, this call has no additional effect.
@@ -983,12 +1010,32 @@ TODO - DEBUG
         /**
             Send a static file back to the client. This is a high performance way to send static content to the client
             by using the "sendConnector". To be effective, this call must be invoked prior to sending any data or 
-            headers to the client, otherwise it will be ignored and the slower "netConnector" will be used instead.
+            headers to the client. If the send connector cannot be used, for example for SSL, ranged or chunked
+            responses, the file is copied to the client via the "netConnector" instead. The request is finalized.
             @param file Path to the file to send back to the client
-            @return True if the Send connector can successfully be used. 
+            @return True if the file was written to the client. False if the file could not be read. 
          */
         native function writeFile(file: Path): Boolean
 
+        /**
+            Write a response from the native output cache and finalize the request. Conditional requests using
+            If-None-Match or If-Modified-Since are answered with a Not-Modified status.
+            @param name Cache name used with $cacheOutput
+            @param direct If true, later GET requests for the same URI are served directly by the web handler.
+            @return True if cached output was found and written.
+            @hide
+         */
+        native function writeCachedOutput(name: String, direct: Boolean = false): Boolean
+
+        /**
+            Update or remove output in the native output cache. 
+            @param name Cache name
+            @param data Response body data. Set to null to remove the cached output.
+            @param options Cache options. See $cacheOutput for details.
+            @hide
+         */
+        static native function updateCachedOutput(name: String, data: Object?, options: Object? = null): Void
+
         /** 
             Send a response to the client. This can be used instead of setting status and calling setHeaders() and write(). 
             The $response argument is an object hash containing status, headers and
@@ -1012,8 +1059,7 @@ TODO - DEBUG
             Write safely. Write HTML escaped data back to the client.
             @param data Objects to HTML encode and write back to the client.
          */
-        function writeSafe(...data): Number
-            write(html(...data))
+        native function writeSafe(...data): Number
 
         /**
             The number of bytes written to the client. This is the count of bytes passed to $write and buffered, 
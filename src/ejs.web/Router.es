@@ -19,6 +19,12 @@ module ejs.web {
         The request's leading URI pathInfo segment is used to select a route set and then the request is matched 
         against each route in that set. Routes are matched in the order in which they are defined.
 
+        Before the first request is routed, each route set is compiled into a dispatch trie keyed by URI path segment.
+        String templates consisting of literal segments, whole segment tokens, simple character class constraints
+        and optional "()" groups are matched by walking the trie once for the request pathInfo. Templates that
+        require a regular expression and routes with function or RegExp templates are tested in definition order 
+        only if they precede the best trie match. The route table is recompiled after routes are added or removed. 
+
         @example:
         var r = new Router
         
@@ -157,6 +163,16 @@ module ejs.web {
             Routes indexed by first component of the URI path/template
          */
         public var routes: Object = {}
+
+        /*
+            Compiled dispatch tables indexed by route set name. Rebuilt on demand when the route table changes.
+         */
+        private var dispatch: Object?
+
+        /*
+            Routes object for which the dispatch tables were compiled. Used to detect a replaced route table.
+         */
+        private var dispatchRoutes: Object?
         
         /**
             Function to test if the Request.filename is a directory.
@@ -347,6 +363,7 @@ module ejs.web {
             if (r.workers == null) {
                 r.workers = routerOptions.workers
             }
+            dispatch = null
         }
 
         /**
@@ -444,6 +461,7 @@ module ejs.web {
             for (let routeName in routeSet) {
                 if (routeName == action) {
                     delete routeSet[action]
+                    dispatch = null
                     return
                 }
             }
@@ -455,6 +473,7 @@ module ejs.web {
          */
         public function reset(request): Void {
             routes = {}
+            dispatch = null
         }
 
         private function reroute(request): Route {
@@ -466,20 +485,22 @@ module ejs.web {
         }
 
         private function secondStageRoute(request: Request, r: Route): Route {
-            let params = request.params
             let pathInfo = request.pathInfo
             let log = request.log
 
-            for (field in r.params) {
-                /*  Apply override params */
-                let value = r.params[field]
-                if (value.toString().contains("$")) {
-                    value = pathInfo.replace(r.pattern, value)
-                }
-                if (value.toString().contains("{")) {
-                    value = Uri.template(value, params, request)
+            if (r.params && Object.getOwnPropertyCount(r.params) > 0) {
+                let params = request.params
+                for (field in r.params) {
+                    /*  Apply override params */
+                    let value = r.params[field]
+                    if (value.toString().contains("$")) {
+                        value = pathInfo.replace(r.pattern, value)
+                    }
+                    if (value.toString().contains("{")) {
+                        value = Uri.template(value, params, request)
+                    }
+                    params[field] = value
                 }
-                params[field] = value
             }
             if (r.rewrite && !r.rewrite(request)) {
                 log.debug(5, "Request rewritten as \"" + request.pathInfo + "\" (reroute)")
@@ -505,7 +526,7 @@ module ejs.web {
             if (log.level >= 3) {
                 log.debug(5, "Matched route \"" + r.routeSetName + "/" + r.name + "\"")
                 if (log.level >= 5) {
-                    log.debug(5, "  Route params " + serialize(params, {pretty: true}))
+                    log.debug(5, "  Route params " + serialize(request.params, {pretty: true}))
                 }
                 if (log.level >= 6) {
                     log.debug(6, "  Route " + serialize(r, {pretty: true}))
@@ -531,7 +552,9 @@ module ejs.web {
          */
         public function route(request): Route {
             let log = request.log
-            log.debug(5, "Routing " + request.pathInfo)
+            if (log.level >= 5) {
+                log.debug(5, "Routing " + request.pathInfo)
+            }
 
             //  TODO - this is now done by http for "-http-method" and X-HTTP-METHOD-OVERRIDE
             if (request.method == "POST") {
@@ -541,21 +564,170 @@ module ejs.web {
                     request.method = method
                 }
             }
-            let routeSet = routes[request.pathInfo.split("/")[1]]
-            for each (r in routeSet) {
-                log.debug(5, "Test route \"" + r.name + "\"")
-                if (r.match(request)) {
-                    return secondStageRoute(request, r)
+            if (!dispatch || dispatchRoutes != routes) {
+                compileDispatch()
+            }
+            let setName = request.pathInfo.split("/")[1]
+            let table = dispatch[setName]
+            let r = table ? matchTable(request, table) : null
+            if (!r && setName != "" && (table = dispatch[""]) != null) {
+                r = matchTable(request, table)
+            }
+            if (r) {
+                return secondStageRoute(request, r)
+            }
+            throw "No route for " + request.pathInfo
+        }
+
+        /*
+            Compile each route set into a dispatch table. A table has a trie for routes with segment templates and 
+            an ordered list of fallback routes that must be tested via their match function. Each route is 
+            numbered in definition order so the trie and fallback routes can be merged in the original order.
+         */
+        private function compileDispatch(): Void {
+            dispatch = {}
+            for (let setName in routes) {
+                let table = { root: new RouteNode, fallback: [] }
+                let order = 0
+                for each (r in routes[setName]) {
+                    if (r.segments) {
+                        for each (segments in r.segments) {
+                            insertSegments(table.root, r, segments, order)
+                        }
+                    } else {
+                        table.fallback.push({route: r, order: order})
+                    }
+                    order++
+                }
+                dispatch[setName] = table
+            }
+            dispatchRoutes = routes
+        }
+
+        private function insertSegments(root: RouteNode, r: Route, segments: Array, order: Number): Void {
+            let node = root
+            let names = []
+            let wild = false
+            node.minOrder = Math.min(node.minOrder, order)
+            for each (seg in segments) {
+                if (seg is String) {
+                    let child = node.literals[seg]
+                    if (!(child is RouteNode)) {
+                        child = node.literals[seg] = new RouteNode
+                    }
+                    node = child
+                } else if (seg.wild) {
+                    wild = true
+                    break
+                } else {
+                    let key = seg.check ? seg.check.source : ""
+                    let child = null
+                    for each (p in node.params) {
+                        if (p.key == key) {
+                            child = p.node
+                            break
+                        }
+                    }
+                    if (!child) {
+                        child = new RouteNode
+                        node.params.push({key: key, check: seg.check, node: child})
+                    }
+                    names.push(seg.token)
+                    node = child
+                }
+                node.minOrder = Math.min(node.minOrder, order)
+            }
+            let entry = {route: r, order: order, names: names, method: r.method}
+            if (wild) {
+                node.wild.push(entry)
+            } else {
+                node.routes.push(entry)
+            }
+            if (r.method) {
+                node.methods[r.method] = true
+            } else {
+                node.anyMethod = true
+            }
+        }
+
+        /*
+            Find the first route in a dispatch table that matches the request. Fallback routes that precede the best
+            trie match are tested in order. If a fallback route rewrites the request, the trie is searched again.
+         */
+        private function matchTable(request, table: Object): Route? {
+            let best = searchTrie(table.root, request.pathInfo.split("/"), 1, [], request.method, -1, null)
+            for each (fb in table.fallback) {
+                if (best && best.order < fb.order) {
+                    break
                 }
+                let pathInfo = request.pathInfo
+                let method = request.method
+                if (fb.route.match(request)) {
+                    return fb.route
+                }
+                if (request.pathInfo != pathInfo || request.method != method) {
+                    best = searchTrie(table.root, request.pathInfo.split("/"), 1, [], request.method, fb.order, null)
+                }
+            }
+            if (!best) {
+                return null
             }
-            routeSet = routes[""]
-            for each (r in routeSet) {
-                log.debug(5, "Test route \"" + r.name + "\"")
-                if (r.match(request)) {
-                    return secondStageRoute(request, r)
+            let r = best.entry.route
+            if (r.tokens && r.tokens.length > 0) {
+                /* Only create the request params if there are tokens to define */
+                let names = best.entry.names
+                let params = request.params
+                for each (token in r.tokens) {
+                    let i = names.indexOf(token)
+                    params[token] ||= (i >= 0) ? best.values[i] : ""
                 }
             }
-            throw "No route for " + request.pathInfo
+            return r
+        }
+
+        /*
+            Search the trie for the lowest ordered route matching the path segments. Only routes ordered after 
+            "after" are considered. Subtrees that cannot improve on the best match so far are pruned.
+         */
+        private function searchTrie(node: RouteNode, parts: Array, index: Number, values: Array, method: String,
+                after: Number, best: Object?): Object? {
+            if (best && node.minOrder >= best.order) {
+                return best
+            }
+            if (node.anyMethod || node.methods[method] == true) {
+                if (index == parts.length) {
+                    best = bestEntry(node.routes, values, method, after, best)
+                } else {
+                    best = bestEntry(node.wild, values, method, after, best)
+                }
+            }
+            if (index < parts.length) {
+                let seg = parts[index]
+                let child = node.literals[seg]
+                if (child is RouteNode) {
+                    best = searchTrie(child, parts, index + 1, values, method, after, best)
+                }
+                for each (p in node.params) {
+                    if (!p.check || p.check.test(seg)) {
+                        values.push(seg)
+                        best = searchTrie(p.node, parts, index + 1, values, method, after, best)
+                        values.pop()
+                    }
+                }
+            }
+            return best
+        }
+
+        private function bestEntry(entries: Array, values: Array, method: String, after: Number, best: Object?): Object? {
+            for each (e in entries) {
+                if (best && e.order >= best.order) {
+                    break
+                }
+                if (e.order > after && (!e.method || e.method == method)) {
+                    return {entry: e, order: e.order, values: values.clone()}
+                }
+            }
+            return best
         }
 
         /**
@@ -772,9 +944,16 @@ module ejs.web {
         internal var pattern: Object
 
         /*
-            Splitter. This is used as the replacement argument to extract tokens from the pathInfo
+            Compiled path segments for the Router dispatch trie. This is an array of alternative segment lists, one 
+            per expansion of the optional "()" groups in the template. Set to null if the template must be matched
+            using the regular expression pattern.
+         */
+        internal var segments: Array?
+
+        /*
+            Maximum number of template expansions to compile into the dispatch trie
          */
-        internal var splitter: String
+        private static const MaxVariants = 16
 
         /**
             Create a new Route instance. This is normally not invoked directly. Rather Router.add() is used to
@@ -848,6 +1027,7 @@ module ejs.web {
         private function compileTemplate(options: Object): Void {
             if (template is String) {
                 let t = template
+                segments = compileSegments(t, options.constraints)
                 /*  
                     For string templates, Create a regular expression splitter template so :TOKENS can be referenced
                     positionally in the override hash via $N args.
@@ -872,15 +1052,6 @@ module ejs.web {
                 //  TODO - is this required?
                 t = t.replace(/\//g, "\\/")
                 pattern = RegExp("^" + t + "$")
-                /*  Splitter ends up looking like "$1:$2:$3:$4" */
-                let count = 1
-                if (!splitter) {
-                    splitter = ""
-                    for (c in tokens) {
-                        splitter += "$" + count++ + ":"
-                    }
-                    splitter = splitter.trim(":")
-                }
                 match = matchAndSplit
                 template = template.replace(/[\(\)]/g, "").replace(/\/\.\*/g, "")
             } else {
@@ -897,19 +1068,107 @@ module ejs.web {
         }
 
         /*
-            Match a request and apply splitter to create request params
+            Split a string template into path segments for the dispatch trie. Each segment is either a literal 
+            string, a token descriptor {token, check} or a {wild} descriptor for a trailing "/.*". Return null if 
+            the template cannot be represented by segments.
+         */
+        private function compileSegments(t: String, constraints: Object?): Array? {
+            let variants = expandOptional(t)
+            if (!variants || variants.length > MaxVariants) {
+                return null
+            }
+            let result = []
+            for each (v in variants) {
+                if (v[0] != "/") {
+                    return null
+                }
+                let parts = v.split("/")
+                let list = []
+                for (let i = 1; i < parts.length; i++) {
+                    let seg = parts[i]
+                    if (seg == ".*" && i == (parts.length - 1)) {
+                        list.push({wild: true})
+                    } else if (seg[0] == "{" && seg.indexOf("}") == (seg.length - 1)) {
+                        let token = seg.slice(1, -1)
+                        let check = null
+                        if (constraints && constraints[token]) {
+                            let c = constraints[token]
+                            if (!(c is String) || !c.match(/^\[[^\]\/\\\^]+\][\+\*]?$/)) {
+                                return null
+                            }
+                            check = RegExp("^" + c + "$")
+                        }
+                        list.push({token: token, check: check})
+                    } else if (seg.match(/[\\\.\*\+\?\^\$\{\}\(\)\|\[\]]/)) {
+                        return null
+                    } else {
+                        list.push(seg)
+                    }
+                }
+                result.push(list)
+            }
+            return result
+        }
+
+        /*
+            Expand the optional "()" groups in a template into all alternative templates
+         */
+        private static function expandOptional(t: String): Array? {
+            let start = t.indexOf("(")
+            if (start < 0) {
+                return t.contains(")") ? null : [t]
+            }
+            let depth = 0
+            let end = -1
+            for (let i = start; i < t.length; i++) {
+                if (t[i] == "(") {
+                    depth++
+                } else if (t[i] == ")" && --depth == 0) {
+                    end = i
+                    break
+                }
+            }
+            if (end < 0) {
+                return null
+            }
+            let prefix = t.slice(0, start)
+            let inner = expandOptional(t.slice(start + 1, end))
+            let rest = expandOptional(t.slice(end + 1))
+            if (!inner || !rest || prefix.contains(")")) {
+                return null
+            }
+            let result = []
+            for each (r in rest) {
+                result.push(prefix + r)
+            }
+            for each (i in inner) {
+                if (i[0] != "/") {
+                    return null
+                }
+                for each (r in rest) {
+                    result.push(prefix + i + r)
+                }
+            }
+            return (result.length > MaxVariants) ? null : result
+        }
+
+        /*
+            Match a request using the template pattern and extract the tokens into the request params
          */
         private function matchAndSplit(request: Request): Boolean {
             if (method && !request.method.contains(method)) {
                 return false
             }
-            let pathInfo = request.pathInfo
-            if (!pathInfo.match(pattern)) {
+            let parts = pattern.exec(request.pathInfo)
+            if (!parts) {
                 return false
             }
-            let parts = pathInfo.replace(pattern, splitter).split(":")
-            for (i in tokens) {
-                request.params[tokens[i]] ||= parts[i].trimStart("/")
+            if (tokens && tokens.length > 0) {
+                let params = request.params
+                for (i in tokens) {
+                    let value = parts[i + 1]
+                    params[tokens[i]] ||= value ? value.trimStart("/") : ""
+                }
             }
             return true
         }
@@ -1047,6 +1306,20 @@ module ejs.web {
         }
 
     }
+
+    /*
+        Dispatch trie node. Children are indexed by literal segment value or by token constraint. The method
+        mask records the HTTP methods of the routes terminating at the node.
+     */
+    internal class RouteNode {
+        public var literals: Object = {}
+        public var params: Array = []
+        public var routes: Array = []
+        public var wild: Array = []
+        public var methods: Object = {}
+        public var anyMethod: Boolean = false
+        public var minOrder: Number = Infinity
+    }
 }
 
 /*
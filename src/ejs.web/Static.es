@@ -8,7 +8,8 @@ module ejs.web {
     /** 
         Static content handler. This supports DELETE, GET, POST and PUT methods. It handles directory redirection
         and will use X-SendFile for efficient transmission of static content. The If-Match, If-None-Match,
-        If-Modified-Since and If-Unmodified-Since headers are supported.
+        If-Modified-Since and If-Unmodified-Since headers are supported. File metadata is cached natively so most 
+        requests do not need to stat the file.
         @param request Request objects
         @returns A response hash object
         @example:
@@ -25,26 +26,31 @@ module ejs.web {
         if (type) {
             headers['Content-Type'] = type
         }
+        /*
+            File metadata, ETags and precompressed variants are cached natively and shared by all requests
+         */
+        let gzip = false
+        if (request.method != "PUT" && (encoding = request.header("Accept-Encoding")) && encoding.contains("gzip")) {
+            gzip = true
+        }
+        let info = request.fileInfo(filename, gzip)
         if (request.method != "PUT") {
-            if ((encoding = request.header("Accept-Encoding")) && encoding.contains("gzip")) {
-                let compressed = Path(filename + ".gz")
-                if (compressed.exists) {
-                    filename = request.filename = compressed
-                    headers["Content-Encoding"] = "gzip"
-                }
-            }
-            if (!filename.exists) {
+            if (!info) {
                 return {
                     status: Http.NotFound, 
                     body: errorBody("Not Found", "Cannot find " + escapeHtml(request.pathInfo))
                 }
             }
+            if (info.encoding) {
+                filename = request.filename = info.path
+                headers["Content-Encoding"] = info.encoding
+            }
         }
         let etag
-        if (filename.exists) {
-            etag = "%x-%x".format(filename.size, filename.modified)
+        if (info) {
+            etag = info.etag
             headers["ETag"] = etag
-            headers["Last-Modified"] = filename.modified.toUTCString()
+            headers["Last-Modified"] = info.lastModified
         }
         /*
             If a specified tag matches, then return the full resource
@@ -52,7 +58,7 @@ module ejs.web {
         let match = false
         if (hdr = request.header("If-Match")) {
             for each (rtag in hdr.split(",")) {
-                if (rtag == etag || (rtag == "*" && filename.exists)) {
+                if (rtag == etag || (rtag == "*" && info)) {
                     match = true
                     break
                 }
@@ -63,30 +69,27 @@ module ejs.web {
         }
         /*
             If a specified etag matches, then no need to process the request. Respond with Not-Modified.
+            Otherwise, if the resource has not been modified since, return Not-Modified.
          */
-        match = true
-        if (hdr = request.header("If-None-Match")) {
-            for each (rtag in hdr.split(",")) {
-                if (rtag != etag || (rtag == "*" && !filename.exists)) {
-                    match = false
+        if (request.method == "GET" || request.method == "HEAD") {
+            if (hdr = request.header("If-None-Match")) {
+                for each (rtag in hdr.split(",")) {
+                    rtag = rtag.trim()
+                    if (info && (rtag == etag || rtag == "*")) {
+                        status = Http.NotModified
+                        break
+                    }
                 }
-            }
-        }
-
-        /*
-            If the resource has not been modified since, return Not-Modified
-         */
-        if (match && (when = request.header("If-Modified-Since"))) {
-            if (request.method == "GET" || request.method == "HEAD") {
-                if (filename.exists && filename.modified <= Date.parse(when) && !request.header("Range")) {
+            } else if (when = request.header("If-Modified-Since")) {
+                if (info && info.modified <= Date.parse(when) && !request.header("Range")) {
                     status = Http.NotModified
                 }
             }
         }
         if (when = request.header("If-Unmodified-Since")) {
-            if (!filename.exists) {
+            if (!info) {
                 status = Http.NotFound
-            } else if (Date.parse(when) < filename.modified) {
+            } else if (Date.parse(when) < info.modified) {
                 status = Http.PrecondFailed
             }
         }
@@ -109,7 +112,7 @@ module ejs.web {
             }
         }
         if (request.method == "GET" || request.method == "POST") {
-            headers["Content-Length"] = filename.size
+            headers["Content-Length"] = info.size
             if (request.config.web.nosend) {
                 body = File(filename, "r")
             } else {
@@ -132,7 +135,7 @@ module ejs.web {
 
         } else if (request.method == "HEAD") {
             /* Just need the content length */
-            headers["Content-Length"] = filename.size
+            headers["Content-Length"] = info.size
 
         } else if (request.method == "OPTIONS") {
             headers["Allow"] = "OPTIONS,GET,HEAD,POST,PUT,DELETE"
@@ -99,6 +99,25 @@ static EjsPath *hs_hostedHome(Ejs *ejs, EjsHttpServer *sp, int argc, EjsObj **ar
 }
 
 
+/*  
+    function get acceptors(): Number
+ */
+static EjsNumber *hs_acceptors(Ejs *ejs, EjsHttpServer *sp, int argc, EjsObj **argv)
+{
+    return ejsCreateNumber(ejs, (MprNumber) sp->acceptors);
+}
+
+
+/*  
+    function set acceptors(count: Number): Void
+ */
+static EjsVoid *hs_set_acceptors(Ejs *ejs, EjsHttpServer *sp, int argc, EjsObj **argv)
+{
+    sp->acceptors = max(ejsGetInt(ejs, argv[0]), 0);
+    return 0;
+}
+
+
 /*  
     function close(): Void
  */
@@ -257,6 +276,7 @@ static EjsVoid *hs_listen(Ejs *ejs, EjsHttpServer *sp, int argc, EjsObj **argv)
         }
         httpSetSoftware(EJS_HTTPSERVER_NAME);
         httpSetEndpointAsync(endpoint, sp->async);
+        httpSetEndpointAcceptors(endpoint, sp->acceptors);
         httpSetEndpointContext(endpoint, sp);
         httpSetEndpointNotifier(endpoint, stateChangeNotifier);
 
@@ -432,9 +452,9 @@ static EjsObj *hs_secure(Ejs *ejs, EjsHttpServer *sp, int argc, EjsObj **argv)
  */
 static EjsObj *hs_setPipeline(Ejs *ejs, EjsHttpServer *sp, int argc, EjsObj **argv)
 {
-    sp->incomingStages = (EjsArray*) argv[0];
-    sp->outgoingStages = (EjsArray*) argv[1];
-    sp->connector = ejsToMulti(ejs, argv[2]);
+    sp->incomingStages = ejsIs(ejs, argv[0], Array) ? (EjsArray*) argv[0] : 0;
+    sp->outgoingStages = ejsIs(ejs, argv[1], Array) ? (EjsArray*) argv[1] : 0;
+    sp->connector = (argc >= 3 && ejsIs(ejs, argv[2], String)) ? ejsToMulti(ejs, argv[2]) : 0;
 
     if (sp->endpoint) {
         /* NOTE: this will only impact future requests */
@@ -605,6 +625,14 @@ static void stateChangeNotifier(HttpConn *conn, int event, int arg)
     switch (event) {
     case HTTP_EVENT_STATE:
         if (arg == HTTP_STATE_BEGIN) {
+            if (req) {
+                /*
+                    Next request on a keep-alive connection. The handler close callback is not invoked for the prior
+                    request, so detach it here to prevent its event listeners from acting on the new request.
+                 */
+                httpSetConnContext(conn, 0);
+                req->conn = 0;
+            }
             setupConnTrace(conn);
         } else if (arg == HTTP_STATE_FINALIZED) {
             if (req) {
@@ -627,6 +655,9 @@ static void stateChangeNotifier(HttpConn *conn, int event, int arg)
         break;
 
     case HTTP_EVENT_WRITABLE:
+        if (req && req->file) {
+            ejsStreamFile(ejs, req);
+        }
         if (req && req->emitter) {
             ejsSendEvent(ejs, req->emitter, "writable", NULL, req);
         }
@@ -754,6 +785,10 @@ static void startEjsHandler(HttpQueue *q)
     if (conn->error) {
         return;
     }
+    if (ejsServeCachedOutput(conn)) {
+        /* Cached action output served without entering the interpreter */
+        return;
+    }
     if ((sp = httpGetEndpointContext(endpoint)) == 0) {
         lp = conn->sock->listenSock;
         if ((sp = lookupServer(conn->ejs, lp->ip, lp->port)) == 0) {
@@ -884,6 +919,7 @@ EjsHttpServer *ejsCloneHttpServer(Ejs *ejs, EjsHttpServer *sp, bool deep)
     }
     nsp->cloned = sp;
     nsp->ejs = ejs;
+    nsp->acceptors = sp->acceptors;
     nsp->async = sp->async;
     nsp->endpoint = sp->endpoint;
     nsp->name = sp->name;
@@ -935,6 +971,7 @@ void ejsConfigureHttpServerType(Ejs *ejs)
 
     prototype = type->prototype;
     ejsBindMethod(ejs, prototype, ES_ejs_web_HttpServer_accept, hs_accept);
+    ejsBindAccess(ejs, prototype, ES_ejs_web_HttpServer_acceptors, hs_acceptors, hs_set_acceptors);
     ejsBindMethod(ejs, prototype, ES_ejs_web_HttpServer_address, hs_address);
     ejsBindAccess(ejs, prototype, ES_ejs_web_HttpServer_async, hs_async, hs_set_async);
     ejsBindMethod(ejs, prototype, ES_ejs_web_HttpServer_hostedDocuments, hs_hostedDocuments);
@@ -226,6 +226,21 @@ static EjsObj *createFiles(Ejs *ejs, EjsRequest *req)
 }
 
 
+/*
+    Get a request header without creating the headers object. Most requests only inspect a few headers, so the 
+    headers object is only created if the script accesses the headers property.
+ */
+static EjsObj *getRxHeader(Ejs *ejs, EjsRequest *req, cchar *key)
+{
+    cchar       *value;
+
+    if (req->conn == 0 || req->conn->rx == 0 || (value = mprLookupKey(req->conn->rx->headers, key)) == 0) {
+        return ESV(null);
+    }
+    return (EjsObj*) ejsCreateStringFromAsc(ejs, value);
+}
+
+
 static EjsObj *createHeaders(Ejs *ejs, EjsRequest *req)
 {
     EjsName     n;
@@ -260,7 +275,7 @@ static int fillResponseHeaders(EjsRequest *req)
     EjsObj      *vp;
     EjsTrait    *trait;
     EjsName     n;
-    char        *value;
+    cchar       *value;
     int         i, count;
     
     if (req->responseHeaders) {
@@ -276,7 +291,7 @@ static int fillResponseHeaders(EjsRequest *req)
             vp = ejsGetProperty(ejs, req->responseHeaders, i);
             if (n.name && vp && req->conn) {
                 if (ejsIsDefined(ejs, vp)) {
-                    value = ejsToMulti(ejs, vp);
+                    value = ejsGetMulti(ejs, vp);
                     httpSetHeaderString(req->conn, ejsToMulti(ejs, n.name), value);
                 }
             }
@@ -547,7 +562,9 @@ static EjsAny *getRequestProperty(Ejs *ejs, EjsRequest *req, int slotNum)
 
     case ES_ejs_web_Request_contentType:
         if (conn) {
-            createHeaders(ejs, req);
+            if (req->headers == 0) {
+                return getRxHeader(ejs, req, "content-type");
+            }
             return mapNull(ejs, ejsGetPropertyByName(ejs, req->headers, EN("content-type")));
         } else return ESV(null);
 
@@ -999,6 +1016,17 @@ static EjsObj *req_set_async(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 }
 
 
+/*
+    Save modified session state before the response is finalized so subsequent requests observe the changes
+ */
+static void saveSession(EjsRequest *req)
+{
+    if (req->session && req->session->dirty) {
+        ejsSaveSession(req->ejs, req->session);
+    }
+}
+
+
 /*  
     function autoFinalize(): Void
 
@@ -1007,8 +1035,9 @@ static EjsObj *req_set_async(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 static EjsObj *req_autoFinalize(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 {
     /* If writeBuffer is set, HttpServer is capturning output for caching */
-    if (req->conn && !req->dontAutoFinalize) {
+    if (req->conn && !req->dontAutoFinalize && !req->file) {
         if (!req->writeBuffer) {
+            saveSession(req);
             httpFinalize(req->conn);
         }
         req->finalized = 1;
@@ -1024,6 +1053,7 @@ static EjsObj *req_close(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 {
     if (req->conn) {
         if (!req->writeBuffer) {
+            saveSession(req);
             httpFinalize(req->conn);
         }
         req->finalized = 1;
@@ -1067,8 +1097,13 @@ static EjsObj *req_dontAutoFinalize(Ejs *ejs, EjsRequest *req, int argc, EjsObj
  */
 static EjsObj *req_finalize(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 {
+    if (req->file) {
+        /* A file is still being streamed. ejsStreamFile finalizes when the file has been written */
+        return 0;
+    }
     if (req->conn) {
         if (!req->writeBuffer || req->writeBuffer == ESV(null)) {
+            saveSession(req);
             httpFinalize(req->conn);
             httpFlush(req->conn);
             httpEnableConnEvents(req->conn);
@@ -1114,12 +1149,13 @@ static EjsObj *req_header(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 {
     EjsObj      *value;
     EjsName     qname;
-    char        *key;
+    cchar       *key;
     int         count, i;
 
-    createHeaders(ejs, req);
-    key = (char*) ejsToMulti(ejs, argv[0]);
-
+    key = ejsGetMulti(ejs, argv[0]);
+    if (req->headers == 0) {
+        return getRxHeader(ejs, req, key);
+    }
     if ((value = ejsGetPropertyByName(ejs, req->headers, EN(key))) == 0) {
         count = ejsGetLength(ejs, req->headers);
         for (i = 0; i < count; i++) {
@@ -1223,7 +1259,7 @@ static EjsObj *req_setHeader(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
     int         overwrite;
 
     if (!connOk(ejs, req, 1)) return 0;
-    key = ejsToMulti(ejs, argv[0]);
+    key = ejsGetMulti(ejs, argv[0]);
     value = (EjsString*) argv[1];
     overwrite = argc < 3 || argv[2] == ESV(true);
     createResponseHeaders(ejs, req);
@@ -1239,7 +1275,10 @@ static EjsObj *req_setHeader(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
         }
     }
     ejsSetPropertyByName(ejs, req->responseHeaders, EN(key), value);
-
+    if (ejsIsDefined(ejs, value)) {
+        /* Mirror into the transmit headers so output filters can inspect the response before the headers are created */
+        httpSetHeaderString(req->conn, key, ejsToMulti(ejs, value));
+    }
     return 0;
 }
 
@@ -1259,6 +1298,7 @@ static EjsObj *req_setLimits(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
     }
     ejsBlendObject(ejs, req->limits, argv[0], EJS_BLEND_OVERWRITE);
     ejsSetHttpLimits(ejs, req->conn->limits, req->limits, 0);
+    httpSetConnTimer(req->conn);
     if (req->session) {
         ejsSetSessionTimeout(ejs, req->session, req->conn->limits->sessionTimeout);
     }
@@ -1296,6 +1336,97 @@ static ssize writeResponseData(Ejs *ejs, EjsRequest *req, cchar *buf, ssize len)
 }
 
 
+/*
+    Manager for packet content buffers that reference data owned by another object. The owner is stored in refillArg
+    and is retained until the packet is transmitted. The data pointer may not be the start of a memory block, so it
+    must not be marked. The buffer cannot grow as the maxsize equals the buffer length.
+ */
+static void manageRefBuf(MprBuf *bp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(bp->refillArg);
+    }
+}
+
+
+/*
+    Queue packets that reference the data without copying. The owner must contain the data and it must not be 
+    modified after writing. The network connector transmits the referenced data directly via vectored socket writes.
+ */
+static ssize writeRefPackets(HttpConn *conn, void *owner, cchar *buf, ssize len)
+{
+    HttpQueue   *q;
+    HttpTx      *tx;
+    HttpPacket  *packet;
+    MprBuf      *content;
+    ssize       packetSize, thisWrite, totalWritten;
+
+    q = conn->writeq;
+    tx = conn->tx;
+    if (tx == 0 || tx->finalizedOutput) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    tx->responded = 1;
+    packetSize = (tx->chunkSize > 0) ? tx->chunkSize : q->packetSize;
+
+    for (totalWritten = 0; len > 0; ) {
+        if (conn->state >= HTTP_STATE_FINALIZED) {
+            return MPR_ERR_CANT_WRITE;
+        }
+        thisWrite = min(len, packetSize);
+        if ((packet = httpCreateDataPacket(0)) == 0 || (content = mprAllocObj(MprBuf, manageRefBuf)) == 0) {
+            return MPR_ERR_MEMORY;
+        }
+        content->data = content->start = (char*) buf;
+        content->end = content->endbuf = (char*) &buf[thisWrite];
+        content->buflen = content->maxsize = thisWrite;
+        content->refillArg = owner;
+        packet->content = content;
+        httpPutForService(q, packet, HTTP_DELAY_SERVICE);
+
+        buf += thisWrite;
+        len -= thisWrite;
+        totalWritten += thisWrite;
+        if (q->count >= q->max) {
+            httpFlushQueue(q, HTTP_BUFFER);
+        }
+    }
+    if (conn->error) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    return totalWritten;
+}
+
+
+/*
+    Write data by reference. Small writes and captured output are copied so they can be aggregated.
+ */
+static ssize writeResponseRef(Ejs *ejs, EjsRequest *req, void *owner, cchar *buf, ssize len)
+{
+    if (len < EJS_WRITE_REF_MIN || (req->writeBuffer && req->writeBuffer != ESV(null))) {
+        return writeResponseData(ejs, req, buf, len);
+    }
+    return writeRefPackets(req->conn, owner, buf, len);
+}
+
+
+/*
+    Send a "writable" event if the connection can accept more data
+ */
+static void notifyWritable(Ejs *ejs, EjsRequest *req)
+{
+    HttpConn    *conn;
+
+    conn = req->conn;
+    //  TODO should not need to test finalizedConnector
+    if (!conn->tx->finalizedConnector && 
+            !conn->error && HTTP_STATE_CONNECTED <= conn->state && conn->state < HTTP_STATE_FINALIZED &&
+            conn->writeq->ioCount == 0) {
+        ejsSendEvent(ejs, req->emitter, "writable", NULL, req);
+    }
+}
+
+
 /*  
     Write text to the client. This call writes the arguments back to the client's browser. 
     This and writeFile are the lowest channel for write data.
@@ -1324,8 +1455,9 @@ static EjsNumber *req_write(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
         data = args->data[i];
         switch (TYPE(data)->sid) {
         case S_String:
+            /* Strings are immutable and can be transmitted by reference */
             s = (EjsString*) data;
-            if ((written = writeResponseData(ejs, req, s->value, s->length)) != s->length) {
+            if ((written = writeResponseRef(ejs, req, s, s->value, s->length)) != s->length) {
                 err++;
             }
             break;
@@ -1342,7 +1474,7 @@ static EjsNumber *req_write(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 
         default:
             s = (EjsString*) ejsToString(ejs, data);
-            if (s == NULL || (written = writeResponseData(ejs, req, s->value, s->length)) != s->length) {
+            if (s == NULL || (written = writeResponseRef(ejs, req, s, s->value, s->length)) != s->length) {
                 err++;
             }
         }
@@ -1355,20 +1487,99 @@ static EjsNumber *req_write(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
         req->written += written;
         total += written;
     }
-    //  TODO should not need to test finalizedConnector
-    if (!conn->tx->finalizedConnector && 
-            !conn->error && HTTP_STATE_CONNECTED <= conn->state && conn->state < HTTP_STATE_FINALIZED &&
-            conn->writeq->ioCount == 0) {
-        ejsSendEvent(ejs, req->emitter, "writable", NULL, req);
+    notifyWritable(ejs, req);
+    return ejsCreateNumber(ejs, (MprNumber) total);
+}
+
+
+/*  
+    Write HTML escaped data to the client. Data without special characters is written without creating an 
+    escaped copy.
+
+    function writeSafe(...data): Number
+ */
+static EjsNumber *req_writeSafe(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
+{
+    EjsArray    *args;
+    EjsString   *s;
+    HttpConn    *conn;
+    char        *escaped;
+    ssize       len, written, total;
+    int         i;
+
+    conn = req->conn;
+    if (!connOk(ejs, req, 1) || httpIsOutputFinalized(conn)) {
+        return 0;
+    }
+    total = 0;
+    args = (EjsArray*) argv[0];
+
+    for (i = 0; i < args->length; i++) {
+        if ((s = (EjsString*) ejsToString(ejs, args->data[i])) == 0) {
+            return 0;
+        }
+        if (!ejsNeedsHtmlEscape(s->value, s->length)) {
+            len = s->length;
+            written = writeResponseRef(ejs, req, s, s->value, len);
+        } else {
+            escaped = mprEscapeHtml(s->value);
+            len = slen(escaped);
+            written = writeResponseRef(ejs, req, escaped, escaped, len);
+        }
+        if (written != len) {
+            ejsThrowIOError(ejs, "%s", conn->errorMsg);
+            return 0;
+        }
+        req->written += written;
+        total += written;
     }
+    notifyWritable(ejs, req);
     return ejsCreateNumber(ejs, (MprNumber) total);
 }
 
 
+/*
+    Copy file data to the client via the pipeline. Used when the send connector cannot be used. Buffers are written
+    only while the write queue is below its maximum. The remainder is written as the connection becomes writable.
+    The request is finalized once the entire file has been written. Returns 1 when complete, 0 if more data remains.
+ */
+PUBLIC int ejsStreamFile(Ejs *ejs, EjsRequest *req)
+{
+    HttpConn    *conn;
+    HttpQueue   *q;
+    char        *buf;
+    ssize       nbytes;
+
+    if ((conn = req->conn) == 0 || req->file == 0) {
+        return 1;
+    }
+    q = conn->writeq;
+    while (q->count < q->max || (req->writeBuffer && req->writeBuffer != ESV(null))) {
+        /* Each buffer is handed to the pipeline without copying, so allocate a new buffer per read */
+        if ((buf = mprAlloc(ME_MAX_BUFFER)) == 0 || (nbytes = mprReadFile(req->file, buf, ME_MAX_BUFFER)) <= 0) {
+            mprCloseFile(req->file);
+            req->file = 0;
+            saveSession(req);
+            httpFinalize(conn);
+            req->finalized = 1;
+            return 1;
+        }
+        if (writeResponseRef(ejs, req, buf, buf, nbytes) != nbytes) {
+            mprCloseFile(req->file);
+            req->file = 0;
+            ejsThrowIOError(ejs, "%s", conn->errorMsg);
+            return MPR_ERR_CANT_WRITE;
+        }
+        req->written += nbytes;
+    }
+    return 0;
+}
+
+
 /*  
     function writeFile(path: Path): Boolean
 
-    Note: this bypasses req->writeBuffer
+    Note: the send connector bypasses req->writeBuffer
  */
 static EjsObj *req_writeFile(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
 {
@@ -1381,11 +1592,19 @@ static EjsObj *req_writeFile(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
     if (!connOk(ejs, req, 1)) return 0;
     conn = req->conn;
     tx = conn->tx;
+    path = (EjsPath*) argv[0];
 
-    if (tx->outputRanges || conn->secure || tx->chunkSize > 0) {
-        return ESV(false);
+    if (tx->outputRanges || conn->secure || tx->chunkSize > 0 || (tx->flags & HTTP_TX_HEADERS_CREATED) ||
+            (req->writeBuffer && req->writeBuffer != ESV(null))) {
+        /*
+            The send connector cannot be used for TLS, ranges, chunking or captured output. Stream via the pipeline.
+         */
+        if ((req->file = mprOpenFile(path->value, O_RDONLY | O_BINARY, 0)) == 0) {
+            ejsThrowIOError(ejs, "Cannot open %s", path->value);
+            return ESV(false);
+        }
+        return ejsStreamFile(ejs, req) < 0 ? ESV(false) : ESV(true);
     }
-    path = (EjsPath*) argv[0];
     info = &tx->fileInfo;
     if (mprGetPathInfo(path->value, info) < 0) {
         ejsThrowIOError(ejs, "Cannot open %s", path->value);
@@ -1395,12 +1614,141 @@ static EjsObj *req_writeFile(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
     tx->length = tx->entityLength = info->size;
     httpSetSendConnector(req->conn, path->value);
     httpPutForService(conn->writeq, packet, 0);
+    saveSession(req);
     httpFinalize(req->conn);
     req->finalized = 1;
     return ESV(true);
 }
 
 
+/*
+    Get cached static file metadata. The cache is shared by all interpreters. Entries are revalidated via stat 
+    when they are older than EJS_FILE_CACHE_CHECK and a changed modified time, size or inode regenerates the ETag.
+ */
+typedef struct EjsFileEntry {
+    char        *etag;              /* Entity tag for the file */
+    char        *modified;          /* Last-Modified header value */
+    MprPath     info;               /* File metadata */
+    MprTicks    checked;            /* When the metadata was last verified */
+} EjsFileEntry;
+
+static MprHash  *fileCache;
+static MprMutex *fileLock;
+
+
+static void manageFileEntry(EjsFileEntry *fp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(fp->etag);
+        mprMark(fp->modified);
+    }
+}
+
+
+/*
+    Lookup a cache entry. If "update" is set, the cache entry is discarded and the file metadata is read directly.
+    This is used for requests that modify the file.
+ */
+static int getFileEntry(cchar *path, EjsFileEntry *result, int update)
+{
+    EjsFileEntry    *fp;
+    MprPath         info;
+    MprTicks        now;
+
+    if (!fileLock) {
+        mprGlobalLock();
+        if (!fileLock) {
+            fileCache = mprCreateHash(EJS_FILE_CACHE_MAX / 4, 0);
+            mprAddRoot(fileCache);
+            fileLock = mprCreateLock();
+            mprAddRoot(fileLock);
+        }
+        mprGlobalUnlock();
+    }
+    if (update) {
+        mprLock(fileLock);
+        mprRemoveKey(fileCache, path);
+        mprUnlock(fileLock);
+        memset(result, 0, sizeof(EjsFileEntry));
+        if (mprGetPathInfo(path, &result->info) < 0) {
+            return MPR_ERR_CANT_FIND;
+        }
+        result->etag = sfmt("%llx-%llx", (int64) result->info.size, (int64) result->info.mtime * MPR_TICKS_PER_SEC);
+        result->modified = httpGetDateString(&result->info);
+        return 0;
+    }
+    now = mprGetTicks();
+    mprLock(fileLock);
+    if ((fp = mprLookupKey(fileCache, path)) == 0 || (now - fp->checked) >= EJS_FILE_CACHE_CHECK) {
+        mprGetPathInfo(path, &info);
+        if (fp && fp->info.valid == info.valid && (!info.valid || (fp->info.mtime == info.mtime && 
+                fp->info.size == info.size && fp->info.inode == info.inode))) {
+            fp->checked = now;
+        } else if ((fp = mprAllocObj(EjsFileEntry, manageFileEntry)) != 0) {
+            fp->info = info;
+            fp->checked = now;
+            if (info.valid) {
+                fp->etag = sfmt("%llx-%llx", (int64) info.size, (int64) info.mtime * MPR_TICKS_PER_SEC);
+                fp->modified = httpGetDateString(&info);
+            }
+            if (mprGetHashLength(fileCache) >= EJS_FILE_CACHE_MAX) {
+                /* Simple bounded cache. Discard all entries and start afresh */
+                mprRemoveRoot(fileCache);
+                fileCache = mprCreateHash(EJS_FILE_CACHE_MAX / 4, 0);
+                mprAddRoot(fileCache);
+            }
+            mprAddKey(fileCache, path, fp);
+        }
+    }
+    if (fp) {
+        *result = *fp;
+    }
+    mprUnlock(fileLock);
+    return (fp && result->info.valid) ? 0 : MPR_ERR_CANT_FIND;
+}
+
+
+/*
+    function fileInfo(path: Path, gzip: Boolean = false): Object?
+ */
+static EjsObj *req_fileInfo(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
+{
+    EjsPath         *path;
+    EjsFileEntry    entry;
+    EjsObj          *result;
+    cchar           *filename, *encoding;
+    int             update;
+
+    path = (EjsPath*) argv[0];
+    encoding = 0;
+    filename = 0;
+    update = req->conn && req->conn->rx && (req->conn->rx->flags & (HTTP_DELETE | HTTP_PUT));
+    if (argc >= 2 && argv[1] == ESV(true)) {
+        filename = sjoin(path->value, ".gz", NULL);
+        if (getFileEntry(filename, &entry, update) == 0 && entry.info.isReg) {
+            encoding = "gzip";
+        } else {
+            filename = 0;
+        }
+    }
+    if (!filename) {
+        if (getFileEntry(path->value, &entry, update) < 0) {
+            return ESV(null);
+        }
+    }
+    result = ejsCreateEmptyPot(ejs);
+    ejsSetPropertyByName(ejs, result, EN("path"), filename ? ejsCreatePathFromAsc(ejs, filename) : path);
+    ejsSetPropertyByName(ejs, result, EN("size"), ejsCreateNumber(ejs, (MprNumber) entry.info.size));
+    ejsSetPropertyByName(ejs, result, EN("modified"), 
+        ejsCreateDate(ejs, (MprTime) entry.info.mtime * MPR_TICKS_PER_SEC));
+    ejsSetPropertyByName(ejs, result, EN("etag"), ejsCreateStringFromAsc(ejs, entry.etag));
+    ejsSetPropertyByName(ejs, result, EN("lastModified"), ejsCreateStringFromAsc(ejs, entry.modified));
+    ejsSetPropertyByName(ejs, result, EN("encoding"), encoding ? ejsCreateStringFromAsc(ejs, encoding) : ESV(null));
+    ejsSetPropertyByName(ejs, result, EN("isDir"), ejsCreateBoolean(ejs, entry.info.isDir));
+    return result;
+}
+
+
 /*
     function get written(): Number
  */
@@ -1410,6 +1758,430 @@ static EjsNumber *req_written(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv
 }
 
 
+/*
+    Native output cache for Controller action caching. Entries hold the response headers and body so cached responses
+    can be written by reference without serialization. Entries may also be indexed by request URI so that 
+    startEjsHandler can serve them before entering the interpreter. The cache is shared by all interpreters.
+ */
+typedef struct EjsOutput {
+    char        *name;              /* Cache name */
+    MprHash     *headers;           /* Response headers */
+    char        *body;              /* Response body */
+    ssize       length;             /* Length of body */
+    char        *etag;              /* ETag header value */
+    char        *lastModified;      /* Last-Modified header value */
+    char        *client;            /* Cache-Control header value */
+    MprTime     modified;           /* When the output was cached. Rounded to seconds. */
+    MprTime     expires;            /* When the entry expires */
+} EjsOutput;
+
+static MprHash  *outputCache;       /* Entries indexed by cache name */
+static MprHash  *outputUris;        /* Entries indexed by request URI for direct serving */
+static MprMutex *outputLock;
+
+
+static void manageOutput(EjsOutput *op, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(op->name);
+        mprMark(op->headers);
+        mprMark(op->body);
+        mprMark(op->etag);
+        mprMark(op->lastModified);
+        mprMark(op->client);
+    }
+}
+
+
+static void initOutputCache()
+{
+    if (!outputLock) {
+        mprGlobalLock();
+        if (!outputLock) {
+            outputCache = mprCreateHash(0, 0);
+            mprAddRoot(outputCache);
+            outputUris = mprCreateHash(0, 0);
+            mprAddRoot(outputUris);
+            outputLock = mprCreateLock();
+            mprAddRoot(outputLock);
+        }
+        mprGlobalUnlock();
+    }
+}
+
+
+/*
+    Create a cache entry. Options may specify the "lifespan" in seconds and a "client" Cache-Control header.
+ */
+static EjsOutput *createOutput(Ejs *ejs, cchar *name, cchar *body, ssize len, EjsObj *options)
+{
+    EjsOutput   *op;
+    EjsAny      *vp;
+    MprTicks    lifespan;
+
+    if ((op = mprAllocObj(EjsOutput, manageOutput)) == 0) {
+        return 0;
+    }
+    lifespan = EJS_OUTPUT_LIFESPAN;
+    if (options && ejsIsDefined(ejs, options)) {
+        if ((vp = ejsGetPropertyByName(ejs, options, EN("lifespan"))) != 0 && ejsIs(ejs, vp, Number)) {
+            lifespan = ejsGetInt64(ejs, vp) * MPR_TICKS_PER_SEC;
+        }
+        if ((vp = ejsGetPropertyByName(ejs, options, EN("client"))) != 0 && ejsIs(ejs, vp, String)) {
+            op->client = sclone(((EjsString*) vp)->value);
+        }
+    }
+    op->name = sclone(name);
+    op->headers = mprCreateHash(0, MPR_HASH_CASELESS);
+    op->body = mprMemdup(body, len);
+    op->length = len;
+    op->modified = mprGetTime() / MPR_TICKS_PER_SEC * MPR_TICKS_PER_SEC;
+    op->expires = op->modified + lifespan;
+    op->lastModified = mprFormatUniversalTime(HTTP_DATE_FORMAT, op->modified);
+    op->etag = sfmt("\"%llx-%x\"", (int64) op->modified, shash(body, len));
+    return op;
+}
+
+
+/*
+    Make room for a new entry in a full index. Expired and replaced entries are removed first. If none are found, the
+    entry that expires soonest is evicted. Must be called with the outputLock held.
+ */
+static void pruneOutput(MprHash *index)
+{
+    MprKey      *kp;
+    MprList     *stale;
+    EjsOutput   *op;
+    cchar       *oldest, *key;
+    MprTime     now, expires;
+    int         next;
+
+    if (mprGetHashLength(index) < EJS_OUTPUT_CACHE_MAX) {
+        return;
+    }
+    now = mprGetTime();
+    stale = mprCreateList(0, 0);
+    oldest = 0;
+    expires = MAXINT64;
+    for (ITERATE_KEYS(index, kp)) {
+        op = (EjsOutput*) kp->data;
+        if (op->expires <= now || mprLookupKey(outputCache, op->name) != op) {
+            mprAddItem(stale, kp->key);
+        } else if (op->expires < expires) {
+            expires = op->expires;
+            oldest = kp->key;
+        }
+    }
+    if (mprGetListLength(stale) == 0 && oldest) {
+        mprAddItem(stale, oldest);
+    }
+    for (ITERATE_ITEMS(stale, key, next)) {
+        mprRemoveKey(index, key);
+    }
+}
+
+
+static void addOutput(EjsOutput *op)
+{
+    mprLock(outputLock);
+    if (!mprLookupKey(outputCache, op->name)) {
+        pruneOutput(outputCache);
+    }
+    mprAddKey(outputCache, op->name, op);
+    mprUnlock(outputLock);
+}
+
+
+/*
+    URI index key. The Host header is included so that virtual hosts sharing an endpoint do not share entries.
+ */
+static char *getOutputUri(HttpConn *conn)
+{
+    HttpRx      *rx;
+
+    rx = conn->rx;
+    return sfmt("%d %s %s", conn->endpoint ? conn->endpoint->port : 0, rx->hostHeader ? rx->hostHeader : "", 
+        rx->originalUri);
+}
+
+
+/*
+    Index an entry by the request URI so that subsequent requests can be served before entering the interpreter
+ */
+static void indexOutput(HttpConn *conn, EjsOutput *op)
+{
+    cchar   *key;
+
+    key = getOutputUri(conn);
+    mprLock(outputLock);
+    if (!mprLookupKey(outputUris, key)) {
+        pruneOutput(outputUris);
+    }
+    mprAddKey(outputUris, key, op);
+    mprUnlock(outputLock);
+}
+
+
+/*
+    Lookup a current entry. Expired or replaced entries are removed from the index.
+ */
+static EjsOutput *lookupOutput(MprHash *index, cchar *key)
+{
+    EjsOutput   *op;
+
+    mprLock(outputLock);
+    if ((op = mprLookupKey(index, key)) != 0) {
+        if (op->expires <= mprGetTime() || mprLookupKey(outputCache, op->name) != op) {
+            mprRemoveKey(index, key);
+            op = 0;
+        }
+    }
+    mprUnlock(outputLock);
+    return op;
+}
+
+
+static void removeOutput(cchar *name)
+{
+    mprLock(outputLock);
+    mprRemoveKey(outputCache, name);
+    mprUnlock(outputLock);
+}
+
+
+/*
+    Test if an If-None-Match header value matches the entity tag (RFC 7232 3.2). The value is "*" or a comma separated
+    list of quoted entity tags. Weak comparison is used, so a "W/" prefix is ignored.
+ */
+static bool matchEtag(cchar *header, cchar *etag)
+{
+    cchar   *cp, *start;
+    ssize   len;
+
+    if (sstarts(etag, "W/")) {
+        etag += 2;
+    }
+    len = slen(etag);
+    for (cp = header; *cp; ) {
+        while (*cp == ',' || isspace((uchar) *cp)) {
+            cp++;
+        }
+        if (*cp == '*') {
+            return 1;
+        }
+        if (sstarts(cp, "W/")) {
+            cp += 2;
+        }
+        start = cp;
+        if (*cp == '"') {
+            /* Quoted tags may contain commas */
+            for (cp++; *cp && *cp != '"'; cp++) ;
+            if (*cp) {
+                cp++;
+            }
+        } else {
+            for (; *cp && *cp != ',' && !isspace((uchar) *cp); cp++) ;
+        }
+        if ((cp - start) == len && len > 0 && strncmp(start, etag, len) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Write cached output and finalize the response. Conditional requests are answered with "Not Modified".
+    If-None-Match takes precedence over If-Modified-Since (RFC 7232).
+ */
+static void sendOutput(HttpConn *conn, EjsOutput *op)
+{
+    MprKey      *kp;
+    MprTime     when;
+    cchar       *hdr;
+    int         status;
+
+    status = HTTP_CODE_OK;
+    if ((hdr = httpGetHeader(conn, "if-none-match")) != 0) {
+        status = matchEtag(hdr, op->etag) ? HTTP_CODE_NOT_MODIFIED : HTTP_CODE_OK;
+
+    } else if ((hdr = httpGetHeader(conn, "if-modified-since")) != 0 && 
+            mprParseTime(&when, hdr, MPR_UTC_TIMEZONE, 0) == 0) {
+        status = (op->modified <= when) ? HTTP_CODE_NOT_MODIFIED : HTTP_CODE_OK;
+    }
+    for (ITERATE_KEYS(op->headers, kp)) {
+        httpSetHeaderString(conn, kp->key, kp->data);
+    }
+    if (op->client) {
+        httpSetHeaderString(conn, "Cache-Control", op->client);
+    }
+    httpSetHeaderString(conn, "ETag", op->etag);
+    httpSetHeaderString(conn, "Last-Modified", op->lastModified);
+    httpSetStatus(conn, status);
+    if (status == HTTP_CODE_OK) {
+        writeRefPackets(conn, op, op->body, op->length);
+    }
+    httpFinalize(conn);
+}
+
+
+/*
+    Serve a request from the output cache without entering the interpreter. Only GET and HEAD requests for URIs
+    previously indexed by a Controller are eligible. Returns true if the request was served.
+ */
+PUBLIC int ejsServeCachedOutput(HttpConn *conn)
+{
+    HttpRx      *rx;
+    EjsOutput   *op;
+    cchar       *hdr;
+    int         empty;
+
+    rx = conn->rx;
+    if (!outputLock || !(rx->flags & (HTTP_GET | HTTP_HEAD))) {
+        return 0;
+    }
+    mprLock(outputLock);
+    empty = mprGetHashLength(outputUris) == 0;
+    mprUnlock(outputLock);
+    if (empty) {
+        return 0;
+    }
+    if ((hdr = httpGetHeader(conn, "cache-control")) != 0 && (scontains(hdr, "max-age=0") || scontains(hdr, "no-cache"))) {
+        return 0;
+    }
+    if ((op = lookupOutput(outputUris, getOutputUri(conn))) == 0) {
+        return 0;
+    }
+    mprDebug("ejs web", 5, "Use cached output for %s", op->name);
+    sendOutput(conn, op);
+    return 1;
+}
+
+
+/*
+    Save the buffered response output in the output cache. The ETag, Last-Modified and Cache-Control response headers
+    are defined for this response.
+
+    function cacheOutput(name: String, options: Object? = null): Void
+ */
+static EjsVoid *req_cacheOutput(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
+{
+    EjsByteArray    *ba;
+    EjsOutput       *op;
+    EjsTrait        *trait;
+    EjsObj          *options, *vp;
+    EjsName         n;
+    HttpConn        *conn;
+    cchar           *key;
+    int             i, count;
+
+    if (!connOk(ejs, req, 1)) return 0;
+    conn = req->conn;
+    options = (argc >= 2) ? argv[1] : 0;
+    ba = req->writeBuffer;
+    if (!ba || (EjsObj*) ba == ESV(null) || conn->tx->status != HTTP_CODE_OK) {
+        return 0;
+    }
+    initOutputCache();
+    if ((op = createOutput(ejs, ((EjsString*) argv[0])->value, (cchar*) &ba->value[ba->readPosition], 
+            ba->writePosition - ba->readPosition, options)) == 0) {
+        return 0;
+    }
+    createResponseHeaders(ejs, req);
+    count = ejsGetLength(ejs, req->responseHeaders);
+    for (i = 0; i < count; i++) {
+        trait = ejsGetPropertyTraits(ejs, req->responseHeaders, i);
+        if (trait && trait->attributes & (EJS_TRAIT_HIDDEN | EJS_TRAIT_DELETED)) {
+            continue;
+        }
+        n = ejsGetPropertyName(ejs, req->responseHeaders, i);
+        vp = ejsGetProperty(ejs, req->responseHeaders, i);
+        if (n.name && vp && ejsIsDefined(ejs, vp)) {
+            key = ejsToMulti(ejs, n.name);
+            if (scaselessmatch(key, "Set-Cookie") || scaselessmatch(key, "ETag") || 
+                    scaselessmatch(key, "Last-Modified") || scaselessmatch(key, "Cache-Control") || 
+                    scaselessmatch(key, "Content-Length") || scaselessmatch(key, "Date")) {
+                continue;
+            }
+            mprAddKey(op->headers, key, sclone(ejsGetMulti(ejs, vp)));
+        }
+    }
+    ejsSetPropertyByName(ejs, req->responseHeaders, EN("ETag"), ejsCreateStringFromAsc(ejs, op->etag));
+    ejsSetPropertyByName(ejs, req->responseHeaders, EN("Last-Modified"), 
+        ejsCreateStringFromAsc(ejs, op->lastModified));
+    if (op->client) {
+        ejsSetPropertyByName(ejs, req->responseHeaders, EN("Cache-Control"), ejsCreateStringFromAsc(ejs, op->client));
+    }
+    addOutput(op);
+    if (options && ejsGetPropertyByName(ejs, options, EN("direct")) == ESV(true) && (conn->rx->flags & HTTP_GET)) {
+        indexOutput(conn, op);
+    }
+    return 0;
+}
+
+
+/*
+    Write cached output for the request and finalize. If direct is true, subsequent requests for the same URI are 
+    served without entering the interpreter.
+
+    function writeCachedOutput(name: String, direct: Boolean = false): Boolean
+ */
+static EjsBoolean *req_writeCachedOutput(Ejs *ejs, EjsRequest *req, int argc, EjsObj **argv)
+{
+    EjsOutput   *op;
+    HttpConn    *conn;
+
+    if (!connOk(ejs, req, 1)) return 0;
+    conn = req->conn;
+    initOutputCache();
+    if (httpIsOutputFinalized(conn) || (op = lookupOutput(outputCache, ((EjsString*) argv[0])->value)) == 0) {
+        return ESV(false);
+    }
+    if (argc >= 2 && argv[1] == ESV(true) && (conn->rx->flags & HTTP_GET)) {
+        indexOutput(conn, op);
+    }
+    sendOutput(conn, op);
+    saveSession(req);
+    req->finalized = 1;
+    return ESV(true);
+}
+
+
+/*
+    Update or remove cached output.
+
+    static function updateCachedOutput(name: String, data: Object?, options: Object? = null): Void
+ */
+static EjsVoid *req_updateCachedOutput(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
+{
+    EjsByteArray    *ba;
+    EjsString       *str;
+    EjsOutput       *op;
+    cchar           *name;
+
+    name = ((EjsString*) argv[0])->value;
+    initOutputCache();
+    if (!ejsIsDefined(ejs, argv[1])) {
+        removeOutput(name);
+        return 0;
+    }
+    if (ejsIs(ejs, argv[1], ByteArray)) {
+        ba = (EjsByteArray*) argv[1];
+        op = createOutput(ejs, name, (cchar*) &ba->value[ba->readPosition], ba->writePosition - ba->readPosition, 
+            (argc >= 3) ? argv[2] : 0);
+    } else {
+        if ((str = ejsToString(ejs, argv[1])) == 0) {
+            return 0;
+        }
+        op = createOutput(ejs, name, str->value, str->length, (argc >= 3) ? argv[2] : 0);
+    }
+    if (op) {
+        addOutput(op);
+    }
+    return 0;
+}
+
+
 /************************************ Factory *************************************/
 /*
     Clone the request object into the "ejs" interpreter.
@@ -1483,6 +2255,15 @@ EjsRequest *ejsCreateRequest(Ejs *ejs, EjsHttpServer *server, HttpConn *conn, cc
 
 void ejsSendRequestCloseEvent(Ejs *ejs, EjsRequest *req)
 {
+    if (req->ejs == ejs) {
+        /* Save session changes made after the response was finalized */
+        saveSession(req);
+    }
+    if (req->file) {
+        /* Connection closed before the file was completely written */
+        mprCloseFile(req->file);
+        req->file = 0;
+    }
     if (!req->closed && req->emitter) {
         req->closed = 1;
         ejsSendEvent(ejs, req->emitter, "close", NULL, req);
@@ -1545,6 +2326,7 @@ static void manageRequest(EjsRequest *req, int flags)
         mprMark(req->writeBuffer);
         mprMark(req->ejs);
         mprMark(req->session);
+        mprMark(req->file);
     }
 }
 
@@ -1566,12 +2348,16 @@ void ejsConfigureRequestType(Ejs *ejs)
     helpers->lookupProperty = (EjsLookupPropertyHelper) lookupRequestProperty;
     helpers->setProperty = (EjsSetPropertyHelper) setRequestProperty;
 
+    ejsBindMethod(ejs, type, ES_ejs_web_Request_updateCachedOutput, req_updateCachedOutput);
+
     prototype = type->prototype;
     ejsBindAccess(ejs, prototype, ES_ejs_web_Request_async, req_async, req_set_async);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_autoFinalize, req_autoFinalize);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_Request_cacheOutput, req_cacheOutput);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_close, req_close);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_destroySession, req_destroySession);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_dontAutoFinalize, req_dontAutoFinalize);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_Request_fileInfo, req_fileInfo);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_finalize, req_finalize);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_finalized, req_finalized);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_flush, req_flush);
@@ -1583,7 +2369,9 @@ void ejsConfigureRequestType(Ejs *ejs)
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_setHeader, req_setHeader);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_trace, req_trace);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_write, req_write);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_Request_writeCachedOutput, req_writeCachedOutput);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_writeFile, req_writeFile);
+    ejsBindMethod(ejs, prototype, ES_ejs_web_Request_writeSafe, req_writeSafe);
     ejsBindMethod(ejs, prototype, ES_ejs_web_Request_written, req_written);
 }
 #endif
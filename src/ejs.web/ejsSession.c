@@ -62,6 +62,8 @@ EjsSession *ejsGetSession(Ejs *ejs, EjsString *key, MprTicks timeout, int create
     if ((sp = initSession(ejs, sp, key, timeout)) == 0) {
         return 0;
     }
+    /* Sessions for requests are saved once when the request is finalized */
+    sp->deferred = 1;
     if (!getSessionState(ejs, sp) && create) {
         sp->key = makeKey(ejs, sp);
     }
@@ -151,19 +153,37 @@ static int lookupSessionProperty(Ejs *ejs, EjsSession *sp, EjsName qname)
 
 
 /*
-    Set a session property with write-through to the key/value cache
+    Write the session to the key/value cache if it has been modified
  */
-static int setSessionProperty(Ejs *ejs, EjsSession *sp, int slotNum, EjsAny *value)
+PUBLIC int ejsSaveSession(Ejs *ejs, EjsSession *sp)
 {
-    if (ejs->service->potHelpers.setProperty(ejs, sp, slotNum, value) != slotNum) {
-        return EJS_ERR;
+    if (sp == 0 || !sp->dirty || sp->cache == 0) {
+        return 0;
     }
+    sp->dirty = 0;
     if (sp->options == 0) {
         sp->options = ejsCreateEmptyPot(ejs);
         ejsSetPropertyByName(ejs, sp->options, EN("lifespan"), 
             ejsCreateNumber(ejs, (MprNumber) (sp->timeout / MPR_TICKS_PER_SEC)));
     }
     if (ejsCacheWriteObj(ejs, sp->cache, sp->key, sp, sp->options) == 0) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    return 0;
+}
+
+
+/*
+    Set a session property. Request sessions are written to the key/value cache when the request is finalized so that
+    multiple updates only serialize the session once. Other sessions are written through immediately.
+ */
+static int setSessionProperty(Ejs *ejs, EjsSession *sp, int slotNum, EjsAny *value)
+{
+    if (ejs->service->potHelpers.setProperty(ejs, sp, slotNum, value) != slotNum) {
+        return EJS_ERR;
+    }
+    sp->dirty = 1;
+    if (!sp->deferred && ejsSaveSession(ejs, sp) < 0) {
         return EJS_ERR;
     }
     return 0;
@@ -18,8 +18,25 @@
 static int configureWebTypes(Ejs *ejs);
 
 /************************************ Code ************************************/
+/*
+    Test if any of the len characters of a string must be escaped. Strings may contain embedded nulls, so all
+    characters are examined.
+ */
+PUBLIC bool ejsNeedsHtmlEscape(cchar *str, ssize len)
+{
+    cchar   *cp, *end;
+
+    for (cp = str, end = &str[len]; cp < end; cp++) {
+        if (*cp && strchr(EJS_HTML_CHARS, *cp)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
 /*  
-    HTML escape a string
+    HTML escape a string. Strings without special characters are returned without allocating a copy.
     function escapeHtml(str: String): String
  */
 static EjsObj *web_escapeHtml(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
@@ -27,6 +44,9 @@ static EjsObj *web_escapeHtml(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
     EjsString   *str;
 
     str = (EjsString*) argv[0];
+    if (!ejsNeedsHtmlEscape(str->value, str->length)) {
+        return (EjsObj*) str;
+    }
     return (EjsObj*) ejsCreateStringFromAsc(ejs, mprEscapeHtml(str->value));
 }
 
@@ -15,6 +15,24 @@
 
 #define EJS_SESSION "-ejs-session-"             /**< Default session cookie string */
 
+#define EJS_HTML_CHARS "&<>#()\"'"              /**< Characters escaped by mprEscapeHtml */
+
+#ifndef EJS_FILE_CACHE_MAX
+#define EJS_FILE_CACHE_MAX      1024            /**< Maximum number of cached static file entries */
+#endif
+#ifndef EJS_FILE_CACHE_CHECK
+#define EJS_FILE_CACHE_CHECK    1000            /**< Period to revalidate cached static file metadata (msecs) */
+#endif
+#ifndef EJS_OUTPUT_CACHE_MAX
+#define EJS_OUTPUT_CACHE_MAX    1024            /**< Maximum number of cached action output entries */
+#endif
+#ifndef EJS_OUTPUT_LIFESPAN
+#define EJS_OUTPUT_LIFESPAN     (86400 * MPR_TICKS_PER_SEC) /**< Default lifespan for cached action output */
+#endif
+#ifndef EJS_WRITE_REF_MIN
+#define EJS_WRITE_REF_MIN       4096            /**< Minimum write size to transmit by reference without copying */
+#endif
+
 #ifdef  __cplusplus
 extern "C" {
 #endif
@@ -48,6 +66,7 @@ typedef struct EjsHttpServer {
     char            *ciphers;                   /**< SSL ciphers */
     char            *ip;                        /**< Listening address */
     char            *name;                      /**< Server name */
+    int             acceptors;                  /**< Number of SO_REUSEPORT listening sockets */
     int             async;                      /**< Async mode */
     int             port;                       /**< Listening port */
     int             hosted;                     /**< Server being hosted inside a web server */
@@ -110,6 +129,7 @@ typedef struct EjsRequest {
 
     Ejs             *ejs;               /**< Ejscript interpreter handle */
     struct EjsSession *session;         /**< Current session */
+    MprFile         *file;              /**< File being streamed by writeFile */
 
     //  OPT - make bit fields
     int             dontAutoFinalize;   /**< Suppress auto-finalization */
@@ -159,6 +179,8 @@ typedef struct EjsSession {
     EjsObj      *options;           /* Default write options */
     MprTicks    timeout;            /* Session inactivity timeout (msecs) */
     int         ready;              /* Data cached from store into pot */
+    int         deferred;           /* Defer writes to the store until ejsSaveSession */
+    int         dirty;              /* Session properties modified since last saved */
 } EjsSession;
 
 /** 
@@ -189,6 +211,16 @@ extern int ejsDestroySession(Ejs *ejs, EjsSession *session);
 */
 extern void ejsSetSessionTimeout(Ejs *ejs, EjsSession *sp, MprTicks lifespan);
 
+/** 
+    Save a session to the session store. Sessions obtained via ejsGetSession buffer property updates and are saved
+    when the request is finalized. This call does nothing if the session has not been modified.
+    @param ejs Ejs interpreter handle returned from $ejsCreate
+    @param sp Session object
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup EjsSession
+*/
+extern int ejsSaveSession(Ejs *ejs, EjsSession *sp);
+
 /******************************* Internal APIs ********************************/
 
 extern void ejsConfigureHttpServerType(Ejs *ejs);
@@ -197,6 +229,9 @@ extern void ejsConfigureSessionType(Ejs *ejs);
 extern void ejsConfigureWebTypes(Ejs *ejs);
 extern void ejsSendRequestCloseEvent(Ejs *ejs, EjsRequest *req);
 extern void ejsSendRequestErrorEvent(Ejs *ejs, EjsRequest *req);
+extern int ejsStreamFile(Ejs *ejs, EjsRequest *req);
+extern bool ejsNeedsHtmlEscape(cchar *str, ssize len);
+extern int ejsServeCachedOutput(HttpConn *conn);
 
 #ifdef  __cplusplus
 }
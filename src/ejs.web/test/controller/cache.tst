@@ -0,0 +1,168 @@
+/*
+    Test Controller action output caching
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+App.config.cache ||= {}
+App.config.cache.actions = { enable: true, lifespan: 1800 }
+
+var runs = 0
+
+public class CacheController extends Controller {
+    use namespace action
+
+    action function page() {
+        runs++
+        setHeader("Content-Type", "text/plain")
+        write("Page " + runs)
+    }
+    action function client() {
+        runs++
+        write("Client")
+    }
+} 
+
+public class GuardController extends Controller {
+    use namespace action
+
+    function GuardController() {
+        before(function () {})
+    }
+    action function page() {
+        runs++
+        write("Guarded")
+    }
+} 
+
+Controller.cache(CacheController, ["page"])
+Controller.cache(CacheController, ["client"], {mode: "client", lifespan: 60})
+Controller.cache(GuardController, ["page"])
+
+load("../utils.es")
+server = controllerServer(HTTP)
+var requests = 0
+server.on("readable", function (event, request) {
+    requests++
+})
+
+
+//  First request runs the action and caches the output
+let http = fetch(HTTP + "/cache/page")
+assert(http.response == "Page 1")
+assert(http.header("Content-Type") == "text/plain")
+let etag = http.header("ETag")
+assert(etag)
+assert(http.header("Last-Modified"))
+http.close()
+assert(runs == 1)
+
+
+//  Subsequent requests are served from the cache with the same ETag without running script
+assert(requests == 1)
+let http = fetch(HTTP + "/cache/page")
+assert(http.response == "Page 1")
+assert(http.header("Content-Type") == "text/plain")
+assert(http.header("ETag") == etag)
+http.close()
+assert(runs == 1)
+assert(requests == 1)
+
+
+//  Conditional request
+let http = new Http
+http.setHeader("If-None-Match", etag)
+http.get(HTTP + "/cache/page")
+http.wait(30000)
+assert(http.status == Http.NotModified)
+http.close()
+assert(runs == 1)
+
+
+//  If-None-Match lists, weak tags and "*"
+for each (value in ["\"other\", " + etag, "W/" + etag, "\"a,b\" ,W/" + etag + ",\"c\"", "*"]) {
+    let http = new Http
+    http.setHeader("If-None-Match", value)
+    http.get(HTTP + "/cache/page")
+    http.wait(30000)
+    assert(http.status == Http.NotModified)
+    http.close()
+}
+let http = new Http
+http.setHeader("If-None-Match", "\"other\", W/\"another\"")
+http.get(HTTP + "/cache/page")
+http.wait(30000)
+assert(http.status == Http.Ok)
+http.close()
+assert(runs == 1)
+
+
+//  If-None-Match takes precedence over If-Modified-Since
+let http = new Http
+http.setHeader("If-None-Match", "\"other\"")
+http.setHeader("If-Modified-Since", Date().toUTCString())
+http.get(HTTP + "/cache/page")
+http.wait(30000)
+assert(http.status == Http.Ok)
+assert(http.response == "Page 1")
+http.close()
+assert(runs == 1)
+
+
+//  Direct serving is keyed by the Host header as well as the URI
+let http = new Http
+http.setHeader("Host", "other.example.com")
+http.get(HTTP + "/cache/page")
+http.wait(30000)
+assert(http.status == Http.Ok)
+http.close()
+assert(requests == 2)
+
+
+//  Client reload bypasses the cache
+let http = new Http
+http.setHeader("Cache-Control", "no-cache")
+http.get(HTTP + "/cache/page")
+http.wait(30000)
+assert(http.status == Http.Ok)
+assert(http.response == "Page 2")
+http.close()
+assert(runs == 2)
+
+
+//  Client mode defines a Cache-Control header
+let http = fetch(HTTP + "/cache/client")
+assert(http.response == "Client")
+assert(http.header("Cache-Control") == "max-age=60")
+http.close()
+let http = fetch(HTTP + "/cache/client")
+assert(http.header("Cache-Control") == "max-age=60")
+http.close()
+assert(runs == 3)
+
+
+//  Updated and expired output
+Controller.updateCache(CacheController, "page", "Updated")
+let http = fetch(HTTP + "/cache/page")
+assert(http.response == "Updated")
+http.close()
+Controller.updateCache(CacheController, "page", null)
+let http = fetch(HTTP + "/cache/page")
+assert(http.response == "Page 4")
+http.close()
+assert(runs == 4)
+
+
+//  Controllers with checkers still run the checkers for cached output
+let http = fetch(HTTP + "/guard/page")
+assert(http.response == "Guarded")
+http.close()
+let count = requests
+let http = fetch(HTTP + "/guard/page")
+assert(http.response == "Guarded")
+http.close()
+assert(runs == 5)
+assert(requests == count + 1)
+
+server.close()
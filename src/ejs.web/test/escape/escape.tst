@@ -15,3 +15,9 @@ s = "\"'"
 s = escapeHtml(s)
 assert(s == "&quot;&#39;")
 
+//  Characters after an embedded null must still be escaped
+s = "a" + String.fromCharCode(0) + "<script>x</script>"
+assert(s.length == 20)
+s = escapeHtml(s)
+assert(!s.contains("<script>"))
+assert(!s.contains("<"))
@@ -19,6 +19,12 @@ for (i in COUNT) {
     written += data.write("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa: " + i + "\n")
 }
 
+//  About 1MB of string data which is written by reference
+let text = ""
+for (i in 16384) {
+    text += "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb: " + (i % 10) + "\n"
+}
+
 server.on("readable", function (event, request: Request) {
     switch (pathInfo) {
     case "/single":
@@ -26,6 +32,31 @@ server.on("readable", function (event, request: Request) {
         finalize()
         break
 
+    case "/string":
+        write(text)
+        finalize()
+        break
+
+    case "/mixed":
+        write("first\n")
+        write(text)
+        write("middle\n", text, "last\n")
+        finalize()
+        break
+
+    case "/stream":
+        //  Write much more than the queue maximum, one string per writable event
+        dontAutoFinalize()
+        let sent = 0
+        on("writable", function (event, request) {
+            if (sent++ < 8) {
+                write(text)
+            } else {
+                finalize()
+            }
+        })
+        break
+
 /* FUTURE
     case "/multiple":
         dontAutoFinalize()
@@ -53,6 +84,36 @@ assert(http.response.length == written)
 http.close()
 
 
+//  Large string write
+
+http = new Http
+http.afetch("GET", HTTP + "/string", null)
+App.waitForEvent(http, "close", 30000)
+assert(http.status == 200)
+assert(http.response == text)
+http.close()
+
+
+//  Large string writes interleaved with small buffered writes
+
+http = new Http
+http.afetch("GET", HTTP + "/mixed", null)
+App.waitForEvent(http, "close", 30000)
+assert(http.status == 200)
+assert(http.response == "first\n" + text + "middle\n" + text + "last\n")
+http.close()
+
+
+//  Streamed string writes driven by writable events
+
+http = new Http
+http.afetch("GET", HTTP + "/stream", null)
+App.waitForEvent(http, "close", 30000)
+assert(http.status == 200)
+assert(http.response.length == text.length * 8)
+http.close()
+
+
 /* FUTURE
 //  Multiple writes by the server
 let http = new Http
@@ -11,6 +11,47 @@ load("../utils.es")
 
 server.on("readable", function (event, request: Request) {
 
+    if (pathInfo == "/lazy") {
+        //  Single headers are read without creating the headers object
+        assert(header("X-Custom") == "custom")
+        assert(header("x-custom") == "custom")
+        assert(header("Missing") == null)
+        assert(contentType == "text/plain")
+        //  Modifications to the headers object are then visible via header()
+        assert(headers["X-Custom"] == "custom")
+        headers["X-Custom"] = "modified"
+        assert(header("x-custom") == "modified")
+        finalize()
+        return
+    }
+
+    if (pathInfo == "/parse") {
+        //  Repeated headers are combined and keep the case of the first occurrence
+        assert(header("X-Multi") == "one, two")
+        //  Leading white space is skipped, trailing text is preserved
+        assert(header("X-Space") == "value with spaces")
+        assert(header("User-Agent") == "test-agent")
+        assert(referrer == "http://example.com/")
+        assert(contentType == "text/plain")
+        assert(header("x-unknown-header") == "unknown")
+        assert(headers["X-Multi"] == "one, two")
+        setHeader("Content-Type", "text/plain")
+        write("parsed")
+        finalize()
+        return
+    }
+
+    if (pathInfo == "/duplicate") {
+        //  Repeated headers are combined in the headers collection, but request fields use the last occurrence
+        assert(header("Host") == "first.example.com, second.example.com")
+        assert(host == "second.example.com")
+        assert(header("Content-Type") == "application/x-www-form-urlencoded, text/plain")
+        assert(params.color == null)
+        write("duplicate")
+        finalize()
+        return
+    }
+
     //  Request headers
     count = Object.getOwnPropertyCount(headers)
     assert(count == 6)
@@ -61,4 +102,56 @@ http.get(HTTP + "/index.html")
 http.wait()
 http.close()
 
+http = new Http
+http.setHeader("X-Custom", "custom")
+http.setHeader("Content-Type", "text/plain")
+http.get(HTTP + "/lazy")
+http.wait()
+assert(http.status == 200)
+http.close()
+
+//  Raw request with repeated headers and irregular spacing
+let response = new ByteArray
+let socket = new Socket
+socket.async = true
+socket.on("readable", function () {
+    if (socket.read(response, -1) == null) {
+        socket.close()
+    }
+})
+socket.connect(HTTP)
+socket.write("GET /parse HTTP/1.1\r\nHost: localhost\r\nX-Multi: one\r\nx-multi: two\r\n" +
+    "X-Space:    value with spaces\r\nUser-Agent:test-agent\r\nReferer: http://example.com/\r\n" +
+    "Content-Type: text/plain\r\nX-Unknown-Header: unknown\r\nConnection: close\r\n\r\n")
+for (i in 100) {
+    if (socket.isEof) {
+        break
+    }
+    App.run(100, true)
+}
+assert(response.toString().startsWith("HTTP/1.1 200"))
+assert(response.toString().contains("parsed"))
+
+//  Raw request with repeated Host and Content-Type headers
+response = new ByteArray
+socket = new Socket
+socket.async = true
+socket.on("readable", function () {
+    if (socket.read(response, -1) == null) {
+        socket.close()
+    }
+})
+socket.connect(HTTP)
+socket.write("POST /duplicate HTTP/1.1\r\nHost: first.example.com\r\nHost: second.example.com\r\n" +
+    "Content-Type: application/x-www-form-urlencoded\r\nContent-Type: text/plain\r\nContent-Length: 9\r\n" +
+    "Connection: close\r\n\r\ncolor=red")
+for (i in 100) {
+    if (socket.isEof) {
+        break
+    }
+    App.run(100, true)
+}
+assert(response.toString().startsWith("HTTP/1.1 200"))
+assert(response.toString().contains("duplicate"))
+
 server.close()
@@ -0,0 +1,67 @@
+/*
+    Test consecutive requests on a keep-alive connection
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+server = new HttpServer
+server.listen(HTTP)
+load("../utils.es")
+
+server.on("readable", function (event, request: Request) {
+    switch (pathInfo) {
+    case "/form":
+        assert(params.color == "red")
+        write("form")
+        finalize()
+        break
+
+    case "/post":
+        dontAutoFinalize()
+        on("readable", function (event) {
+            let ba = new ByteArray
+            if (!read(ba)) {
+                write("post")
+                finalize()
+            }
+        })
+        break
+
+    default:
+        writeError(Http.ServerError, "Bad test URI")
+    }
+})
+
+/*
+    The server decrements the Keep-Alive "max" count for each request on a connection
+ */
+function requestsRemaining(http: Http): Number {
+    let keepAlive = http.header("Keep-Alive")
+    assert(keepAlive)
+    return keepAlive.replace(/.*max=/, "") cast Number
+}
+
+//  Each request must be serviced by its own pipeline, not the previous request's connector
+let http = new Http
+http.form(HTTP + "/form", { color: "red", shape: "square" })
+http.wait()
+assert(http.status == 200)
+assert(http.response == "form")
+let first = requestsRemaining(http)
+
+for (i in 4) {
+    http.post(HTTP + "/post", "Some data")
+    http.wait()
+    assert(http.status == 200)
+    assert(http.response == "post")
+    assert(requestsRemaining(http) == first - (i * 2) - 1)
+
+    http.form(HTTP + "/form", { color: "red", shape: "square" })
+    http.wait()
+    assert(http.status == 200)
+    assert(http.response == "form")
+}
+http.close()
+
+server.close()
@@ -9,6 +9,19 @@ server = new HttpServer
 server.listen(HTTP)
 load("../utils.es")
 
+//  Larger than the write queue maximum
+let bigFile = Path("response-big.tmp")
+let line = "cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc\n"
+let contents = ""
+for (i in 1024) {
+    contents += line
+}
+let f = File(bigFile, "w")
+for (i in 32) {
+    f.write(contents)
+}
+f.close()
+
 server.on("readable", function (event, request: Request) {
     switch (pathInfo) {
     case "/sendfile":
@@ -16,6 +29,13 @@ server.on("readable", function (event, request: Request) {
         finalize()
         break
 
+    case "/streamfile":
+        //  Chunked output cannot use the send connector so the file is streamed as the connection drains
+        setHeader("X-Chunk-Size", 8192)
+        writeFile(bigFile)
+        finalize()
+        break
+
     case "/writeResponse":
         writeResponse({ status: 201, headers: {"Custom": 42}, body: "hello moon"})
         break
@@ -79,6 +99,16 @@ assert(http.status == 200)
 assert(http.response == Path("../utils.es").readString())
 http.close()
 
+//  writeFile streamed via the pipeline
+let http = new Http
+http.afetch("GET", HTTP + "/streamfile", null)
+App.waitForEvent(http, "close", 30000)
+assert(http.status == 200)
+assert(http.response.length == bigFile.size)
+assert(http.response == bigFile.readString())
+http.close()
+bigFile.remove()
+
 // no response
 server.setLimits({inactivityTimeout: 1})
 let http = fetch(HTTP + "/hang", Http.RequestTimeout)
@@ -19,6 +19,7 @@ server.on("readable", function (event, request: Request) {
     write(ba)
 
     writeSafe("<p>html</p>")
+    writeSafe(String.fromCharCode(0) + "<script>")
     flush()
     finalize()
 })
@@ -28,7 +29,8 @@ http.get(HTTP + "/index.html")
 http.wait()
 
 //  Validate output
-assert(http.response == "1234, a string, 1234, from byte array, &lt;p&gt;html&lt;/p&gt;")
+assert(http.response.startsWith("1234, a string, 1234, from byte array, &lt;p&gt;html&lt;/p&gt;"))
+assert(!http.response.contains("<script>"))
 
 http.close()
 server.close()
@@ -0,0 +1,147 @@
+/*
+    Router dispatch trie. Verify trie matching preserves route definition order, methods and token captures.
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+load("helper.es")
+server = new HttpServer
+server.listen(HTTP)
+
+server.on("readable", function (event, request: Request) {
+    try {
+        router.route(request)
+    } catch (e) {
+        print(e)
+        finalize()
+        assert(!e)
+    }
+    write(serialize(request) + "\n")
+    finalize()
+})
+
+function send(url: String, method: String = "GET"): Object {
+    let http = new Http
+    http.connect(method, HTTP + url)
+    http.wait(30000)
+    assert(http.status == Http.Ok)
+    return deserialize(http.response)
+}
+
+let router = new Router(null)
+
+
+//  Restful resources with constrained ids
+
+router.reset()
+router.addResources(["User", "Post", "Comment"])
+let response = test("/Post/init")
+assert(response.route.name == "init")
+assert(response.params.controller == "Post")
+
+let response = test("/Post/42")
+assert(response.route.name == "show")
+assert(response.params.id == "42")
+
+let response = test("/Post/42/edit")
+assert(response.route.name == "edit")
+assert(response.params.id == "42")
+
+//  Non-numeric id must not match the constrained routes
+let response = test("/Post/latest")
+assert(response.route.name == "default")
+assert(response.params.action == "latest")
+
+
+//  Method selection
+
+let response = send("/User/7", "PUT")
+assert(response.route.name == "update")
+let response = send("/User/7", "DELETE")
+assert(response.route.name == "destroy")
+let response = send("/User", "POST")
+assert(response.route.name == "create")
+
+
+//  Optional groups and missing tokens
+
+router.reset()
+router.add("/{controller}(/{action}(/.*))", {name: "default", method: "*"})
+let response = test("/Blog")
+assert(response.params.controller == "Blog")
+assert(response.params.action == "")
+let response = test("/Blog/list")
+assert(response.params.action == "list")
+let response = test("/Blog/list/a/b/c")
+assert(response.params.controller == "Blog")
+assert(response.params.action == "list")
+
+
+//  Definition order is preserved between trie and fallback routes
+
+router.reset()
+router.add("/Admin/{action}", {name: "generic"})
+router.add("/Admin/login", {name: "login"})
+let response = test("/Admin/login")
+assert(response.route.name == "generic")
+
+router.reset()
+router.add(/^\/Admin\//, {name: "regexp"})
+router.add("/{controller}/{action}", {name: "generic"})
+let response = test("/Admin/login")
+assert(response.route.name == "regexp")
+
+
+//  Literal segments are preferred only when defined first
+
+router.reset()
+router.add("/Shop/special", {name: "special"})
+router.add("/Shop/{action}", {name: "action"})
+let response = test("/Shop/special")
+assert(response.route.name == "special")
+let response = test("/Shop/other")
+assert(response.route.name == "action")
+assert(response.params.action == "other")
+
+
+//  A rewriting function route causes the trie to be searched with the new path
+
+router.reset()
+router.add(function (request) {
+    if (request.pathInfo.startsWith("/old/")) {
+        request.pathInfo = request.pathInfo.replace("/old/", "/new/")
+    }
+    return false
+}, {name: "rewrite"})
+router.add("/{kind}/{item}", {name: "item"})
+let response = test("/old/thing")
+assert(response.route.name == "item")
+assert(response.params.kind == "new")
+assert(response.params.item == "thing")
+
+
+//  Templates needing a regular expression still match
+
+router.reset()
+router.add("/[Dd]ash/refresh", {name: "dash", set: "dash"})
+router.add("/files/file-{id}", {name: "file"})
+let response = test("/dash/refresh")
+assert(response.route.name == "dash")
+let response = test("/files/file-12")
+assert(response.route.name == "file")
+assert(response.params.id == "12")
+
+
+//  Many resources
+
+router.reset()
+for (let i = 0; i < 200; i++) {
+    router.addResources("Res" + i)
+}
+let response = test("/Res150/9/edit")
+assert(response.route.name == "edit")
+assert(response.params.controller == "Res150")
+assert(response.params.id == "9")
+
+server.close()
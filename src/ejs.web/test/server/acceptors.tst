@@ -0,0 +1,66 @@
+/*
+    Test multiple SO_REUSEPORT acceptors on one endpoint
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+const PORT = Uri(HTTP).port
+const ACCEPTORS = 4
+
+/*
+    Count listening sockets bound to the port. Returns null if the O/S does not provide socket tables.
+ */
+function listeners(port: Number): Number? {
+    if (!Path("/proc/net/tcp").exists) {
+        return null
+    }
+    let local = ""
+    for (; port > 0; port = Math.floor(port / 16)) {
+        local = "0123456789ABCDEF"[port % 16] + local
+    }
+    local = ":" + local
+    let count = 0
+    for each (line in Cmd.run("cat /proc/net/tcp").split("\n")) {
+        let fields = line.trim().split(/ +/)
+        if (fields[1] && fields[1].endsWith(local) && fields[3] == "0A") {
+            count++
+        }
+    }
+    return count
+}
+
+server = new HttpServer
+assert(server.acceptors == 0)
+server.acceptors = ACCEPTORS
+assert(server.acceptors == ACCEPTORS)
+
+let served = 0
+server.on("readable", function (event, request) {
+    served++
+    setHeader("Content-Type", "text/plain")
+    write("Hello " + pathInfo)
+    finalize()
+})
+server.listen(HTTP)
+
+let count = listeners(PORT)
+if (count != null && Config.OS == "linux") {
+    assert(count == ACCEPTORS)
+}
+
+//  Each request uses a new connection so the O/S distributes them over the listeners
+for (i in 40) {
+    let http = new Http
+    http.setHeader("Connection", "close")
+    http.get(HTTP + "/request-" + i)
+    http.wait(30 * 1000)
+    assert(http.status == Http.Ok)
+    assert(http.response == "Hello /request-" + i)
+    http.close()
+}
+assert(served == 40)
+
+server.close()
+if (count != null && Config.OS == "linux") {
+    assert(listeners(PORT) == 0)
+}
@@ -0,0 +1,119 @@
+/*
+    Test on-the-fly response compression
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+if (!test.features.me_zlib) {
+    test.skip("SKIP compression - ejs.zlib not configured in build")
+} else {
+    require ejs.zlib
+
+    App.config.web.compress = { minimum: 100 }
+    let server = new HttpServer
+    delete App.config.web.compress
+
+    let text = "Hello World\n".times(200)
+
+    server.on("readable", function (event, request) {
+        if (pathInfo == "/small") {
+            setHeader("Content-Type", "text/plain")
+            write("Hello")
+        } else if (pathInfo == "/binary") {
+            setHeader("Content-Type", "application/octet-stream")
+            write(text)
+        } else if (pathInfo == "/notransform") {
+            setHeader("Content-Type", "text/plain")
+            setHeader("Cache-Control", "no-transform")
+            write(text)
+        } else {
+            setHeader("Content-Type", "text/plain")
+            setHeader("ETag", "\"abc\"")
+            write(text)
+        }
+        finalize()
+    })
+    server.listen(HTTP)
+
+    function get(url: String, encoding: String? = "gzip"): Http {
+        let http = new Http
+        if (encoding) {
+            http.setHeader("Accept-Encoding", encoding)
+        }
+        http.get(HTTP + url)
+        http.wait(30 * 1000)
+        assert(http.status == Http.Ok)
+        return http
+    }
+
+    function readAll(http: Http): ByteArray {
+        let data = new ByteArray
+        while (http.read(data, -1) > 0) {}
+        return data
+    }
+
+    //  Compressed with gzip
+    let http = get("/text")
+    assert(http.header("Content-Encoding") == "gzip")
+    assert(http.header("Vary").contains("Accept-Encoding"))
+    assert(http.header("ETag") == "\"abc-gzip\"")
+    let path = Path("compress.tmp.gz")
+    let file = new File(path, "w")
+    file.write(readAll(http))
+    file.close()
+    http.close()
+    assert(path.size < text.length)
+    Zlib.uncompress(path)
+    assert(Path("compress.tmp").readString() == text)
+    path.remove()
+    Path("compress.tmp").remove()
+
+    //  Deflate if gzip is not acceptable
+    http = get("/text", "gzip;q=0, deflate")
+    assert(http.header("Content-Encoding") == "deflate")
+    let data = Zlib.uncompressBytes(readAll(http))
+    assert(data.toString() == text)
+    http.close()
+
+    //  HEAD describes the same compressed entity as GET
+    http = new Http
+    http.setHeader("Accept-Encoding", "gzip")
+    http.head(HTTP + "/text")
+    http.wait(30 * 1000)
+    assert(http.status == Http.Ok)
+    assert(http.header("Content-Encoding") == "gzip")
+    assert(http.header("Vary").contains("Accept-Encoding"))
+    assert(http.header("ETag") == "\"abc-gzip\"")
+    http.close()
+
+    http = new Http
+    http.setHeader("Accept-Encoding", "gzip")
+    http.head(HTTP + "/small")
+    http.wait(30 * 1000)
+    assert(!http.header("Content-Encoding"))
+    http.close()
+
+    //  Not compressed if the client does not accept compression
+    http = get("/text", null)
+    assert(!http.header("Content-Encoding"))
+    assert(http.response == text)
+    http.close()
+
+    //  Small responses, incompressible types and no-transform are not compressed
+    http = get("/small")
+    assert(!http.header("Content-Encoding"))
+    assert(http.response == "Hello")
+    http.close()
+
+    http = get("/binary")
+    assert(!http.header("Content-Encoding"))
+    http.close()
+
+    http = get("/notransform")
+    assert(!http.header("Content-Encoding"))
+    assert(http.response == text)
+    http.close()
+
+    server.close()
+}
@@ -0,0 +1,31 @@
+/*
+    Test that idle connections are closed by the connection inactivity timer
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+server = new HttpServer
+server.setLimits({ inactivityTimeout: 1 })
+server.on("readable", function (event, request) {
+    finalize()
+})
+server.listen(HTTP)
+
+//  Connect and send nothing. The server should close the connection after the inactivity timeout.
+let client = new Socket
+client.async = true
+client.connect(Uri(HTTP).port)
+let mark = new Date
+let count
+while (mark.elapsed < 10000) {
+    App.run(100, true)
+    if ((count = client.read(new ByteArray)) == null) {
+        break
+    }
+}
+assert(count == null)
+assert(mark.elapsed >= 900)
+client.close()
+
+server.close()
@@ -0,0 +1,50 @@
+/*
+    Test pipelined requests. Responses to buffered requests may be coalesced into fewer writes.
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+server = new HttpServer
+server.on("readable", function (event, request) {
+    setHeader("Content-Type", "text/plain")
+    write("Response " + pathInfo)
+    finalize()
+})
+server.listen(HTTP)
+
+//  Send several requests in one write and expect all responses in order
+let requests = ""
+for (i in 5) {
+    requests += "GET /" + i + " HTTP/1.1\r\nHost: localhost\r\n\r\n"
+}
+let client = new Socket
+client.async = true
+client.connect(Uri(HTTP).port)
+client.write(requests)
+
+let response = ""
+let mark = new Date
+while (mark.elapsed < 10000) {
+    App.run(100, true)
+    let data = new ByteArray
+    let count = client.read(data)
+    if (count == null) {
+        break
+    }
+    response += data.toString()
+    if (response.contains("Response /4")) {
+        break
+    }
+}
+client.close()
+
+let prior = -1
+for (i in 5) {
+    let index = response.indexOf("Response /" + i)
+    assert(index > prior)
+    prior = index
+}
+assert(response.split("HTTP/1.1 200 OK").length == 6)
+
+server.close()
@@ -0,0 +1,51 @@
+/*
+    Test multipart uploads where file data resembles the mime boundary and spans many packets
+ */
+require ejs.web
+
+const HTTP = App.config.uris.http
+
+server = new HttpServer
+server.on("readable", function (event, request) {
+    let result = ""
+    for each (file in files) {
+        result += file.name + ":" + file.size + ":" + 
+            (Path(file.filename).readString() == Path(file.clientFilename).readString()) + " "
+    }
+    write(result + "field:" + params.field)
+    finalize()
+})
+server.listen(HTTP)
+
+let line = "-\r\n--ab--\r\n"
+let sizes = [0, 1, 100, 8191, 40000]
+let uploads = {}
+for (i in sizes) {
+    let data = line.times(sizes[i] / line.length + 1).slice(0, sizes[i])
+    let path = Path("upload-" + i + ".tmp")
+    path.write(data)
+    uploads["file" + i] = path.name
+}
+let http = new Http
+http.upload(HTTP + "/upload", uploads, { field: "value" })
+http.finalize()
+assert(http.status == Http.Ok)
+let response = http.response
+for (i in sizes) {
+    assert(response.contains("file" + i + ":" + sizes[i] + ":true"))
+}
+assert(response.contains("field:value"))
+http.close()
+
+//  Form fields are buffered until their boundary and are bounded by the form limit
+server.setLimits({form: 8192, receive: 1024 * 1024, upload: 1024 * 1024})
+http = new Http
+http.upload(HTTP + "/upload", { file0: uploads.file0 }, { field: "v".times(20000) })
+http.finalize()
+assert(http.status == Http.EntityTooLarge)
+http.close()
+
+for each (path in uploads) {
+    Path(path).remove()
+}
+server.close()
@@ -34,6 +34,15 @@ server.on("readable", function (event, request: Request) {
         finalize()
         break
 
+    case "/deferred":
+        //  Session updates are written to the cache once when the request is finalized
+        session["count"] = 1
+        session["count"] = 2
+        assert(App.cache.read(sessionID) == null)
+        finalize()
+        assert(deserialize(App.cache.read(sessionID)).count == 2)
+        break
+
     case "/destroy":
         assert(sessionID == null)
         createSession()
@@ -64,6 +73,11 @@ do { App.run(10, true) } while(!http.wait())
 assert(http.status == 200)
 http.close()
 
+//  Deferred session writes
+http = fetch(HTTP + "/deferred")
+assert(http.status == Http.Ok)
+http.close()
+
 //  destroySession
 http = fetch(HTTP + "/destroy")
 http.close()
@@ -0,0 +1,66 @@
+/*
+    cache.tst -- Test static file metadata caching, conditional requests and precompressed variants
+ */
+
+const HTTP = App.config.uris.http
+
+let path = Path("web/cache.txt")
+let compressed = Path("web/cache.txt.gz")
+path.write("First version")
+
+//  ETags are stable across requests
+var http: Http = new Http
+http.get(HTTP + "/cache.txt")
+assert(http.status == 200)
+assert(http.response == "First version")
+let etag = http.header("ETag")
+assert(etag)
+assert(http.header("Last-Modified"))
+http.close()
+
+http.get(HTTP + "/cache.txt")
+assert(http.status == 200)
+assert(http.header("ETag") == etag)
+http.close()
+
+//  Conditional request with a matching ETag
+http.setHeader("If-None-Match", etag)
+http.get(HTTP + "/cache.txt")
+assert(http.status == Http.NotModified)
+http.close()
+
+//  Modified files are detected once the cached metadata is revalidated
+App.sleep(1100)
+path.write("Second version of the file")
+App.sleep(1100)
+http = new Http
+http.get(HTTP + "/cache.txt")
+assert(http.status == 200)
+assert(http.response == "Second version of the file")
+assert(http.header("ETag") != etag)
+http.close()
+
+//  Precompressed variant is selected if the client accepts gzip
+compressed.write("Compressed")
+http = new Http
+http.setHeader("Accept-Encoding", "gzip")
+http.get(HTTP + "/cache.txt")
+assert(http.status == 200)
+assert(http.header("Content-Encoding") == "gzip")
+http.close()
+
+http = new Http
+http.get(HTTP + "/cache.txt")
+assert(http.status == 200)
+assert(!http.header("Content-Encoding"))
+http.close()
+
+path.remove()
+compressed.remove()
+
+//  Removed files are detected once the cached metadata is revalidated
+App.sleep(1100)
+http = new Http
+http.get(HTTP + "/cache.txt")
+assert(http.status == Http.NotFound)
+http.close()
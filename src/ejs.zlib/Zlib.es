@@ -24,6 +24,20 @@ module ejs.zlib {
 
         static native function compressString(data: String): String
         static native function uncompressString(data: String): String
+
+        /**
+            Configure the "compressFilter" Http pipeline stage. This stage compresses responses on-the-fly using 
+            gzip or deflate content encoding if the client accepts a compressed response. Responses that are not 
+            successful, have ranges, are already encoded or specify a "Cache-Control: no-transform" are not compressed.
+            The settings apply to all servers in the process.
+            @param options Configuration options.
+            @option types Array of mime type prefixes to compress. Defaults to text types, JSON, Javascript, XML and SVG.
+            @option minimum Minimum response size in bytes to compress. Responses of unknown length are always 
+                compressed. Defaults to 1024.
+            @option level Compression level from 0 (none) to 9 (best). Defaults to the zlib default level (6).
+            @hide
+         */
+        static native function configureFilter(options: Object): Void
     }
 }
 
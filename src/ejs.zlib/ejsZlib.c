@@ -13,6 +13,36 @@
 #include    "ejs.zlib.slots.h"
 
 #define     ZBUFSIZE (16 * 1024)
+#define     ZPOOLSIZE 16                /* Maximum number of idle compression streams to retain */
+#define     ZMINSIZE  1024              /* Default minimum response size to compress */
+#define     ZTYPES    "text/ application/json application/javascript application/x-javascript application/xml image/svg+xml"
+
+/*
+    Compression filter configuration. Shared by all interpreters.
+ */
+typedef struct CompressConfig {
+    MprList     *types;                 /* Mime type prefixes to compress */
+    MprOff      minimum;                /* Minimum response size to compress */
+    int         level;                  /* Compression level */
+} CompressConfig;
+
+/*
+    Per-request compression filter state
+ */
+typedef struct Compress {
+    HttpConn    *conn;                  /* Owning connection */
+    z_stream    *zs;                    /* Compression stream */
+    HttpHeadersCallback headersCallback;/* Prior callback to fill response headers */
+    void        *headersCallbackArg;    /* Argument for headersCallback */
+    int         gzip;                   /* Using gzip (otherwise deflate) encoding */
+    int         level;                  /* Compression level of the stream */
+    int         state;                  /* Zero if undecided, 1 if compressing, -1 if passing data through */
+} Compress;
+
+static CompressConfig   *compressConfig;
+static z_stream         *streamPool[ZPOOLSIZE];
+static int              streamCount;
+static MprMutex         *streamLock;
 
 /************************************ Code ************************************/
 /*
@@ -302,6 +332,413 @@ static EjsString *zlib_uncompressString(Ejs *ejs, EjsObj *unused, int argc, EjsO
     return ejsCreateStringFromBytes(ejs, mprGetBufStart(out), mprGetBufLength(out));
 }
 
+/*
+    static function configureFilter(options: Object): Void
+ */
+static EjsObj *zlib_configureFilter(Ejs *ejs, EjsObj *unused, int argc, EjsObj **argv)
+{
+    EjsObj      *options, *vp;
+    EjsArray    *types;
+    MprList     *list;
+    z_stream    *zs;
+    int         i, level;
+
+    options = argv[0];
+    if ((types = ejsGetPropertyByName(ejs, options, EN("types"))) != 0 && ejsIs(ejs, types, Array)) {
+        list = mprCreateList(types->length, 0);
+        for (i = 0; i < types->length; i++) {
+            mprAddItem(list, sclone(ejsToMulti(ejs, ejsGetProperty(ejs, types, i))));
+        }
+        mprLock(streamLock);
+        mprRemoveRoot(compressConfig->types);
+        compressConfig->types = list;
+        mprAddRoot(list);
+        mprUnlock(streamLock);
+    }
+    if ((vp = ejsGetPropertyByName(ejs, options, EN("minimum"))) != 0 && ejsIs(ejs, vp, Number)) {
+        compressConfig->minimum = (MprOff) ejsGetNumber(ejs, vp);
+    }
+    if ((vp = ejsGetPropertyByName(ejs, options, EN("level"))) != 0 && ejsIs(ejs, vp, Number)) {
+        level = (int) ejsGetNumber(ejs, vp);
+        if (level < Z_NO_COMPRESSION || level > Z_BEST_COMPRESSION) {
+            ejsThrowArgError(ejs, "Bad compression level");
+            return 0;
+        }
+        /* Discard pooled streams that use the old level */
+        mprLock(streamLock);
+        compressConfig->level = level;
+        while (streamCount > 0) {
+            zs = streamPool[--streamCount];
+            deflateEnd(zs);
+            free(zs);
+        }
+        mprUnlock(streamLock);
+    }
+    return 0;
+}
+
+/****************************** Compression Filter ****************************/
+/*
+    The "compressFilter" Http pipeline stage compresses responses on-the-fly using gzip or deflate content encoding
+    as negotiated via the Accept-Encoding header. Streams are reset and reused via a pool as creating a deflate 
+    stream allocates a large window.
+ */
+
+static z_stream *getStream(Compress *cp)
+{
+    z_stream    *zs;
+
+    zs = 0;
+    mprLock(streamLock);
+    cp->level = compressConfig->level;
+    if (cp->gzip && streamCount > 0) {
+        zs = streamPool[--streamCount];
+    }
+    mprUnlock(streamLock);
+    if (zs) {
+        deflateReset(zs);
+        return zs;
+    }
+    if ((zs = malloc(sizeof(z_stream))) == 0) {
+        return 0;
+    }
+    memset(zs, 0, sizeof(z_stream));
+    /* Window bits of 31 selects the gzip format, 15 selects the zlib format required for "deflate" */
+    if (deflateInit2(zs, cp->level, Z_DEFLATED, cp->gzip ? 31 : 15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        free(zs);
+        return 0;
+    }
+    return zs;
+}
+
+
+static void releaseStream(Compress *cp)
+{
+    z_stream    *zs;
+
+    if ((zs = cp->zs) == 0) {
+        return;
+    }
+    cp->zs = 0;
+    mprLock(streamLock);
+    if (cp->gzip && cp->level == compressConfig->level && streamCount < ZPOOLSIZE) {
+        streamPool[streamCount++] = zs;
+        zs = 0;
+    }
+    mprUnlock(streamLock);
+    if (zs) {
+        deflateEnd(zs);
+        free(zs);
+    }
+}
+
+
+static void manageCompress(Compress *cp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(cp->conn);
+        mprMark(cp->headersCallbackArg);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        releaseStream(cp);
+    }
+}
+
+
+/*
+    Test if an Accept-Encoding header accepts the given encoding with a non-zero quality
+ */
+static int acceptsEncoding(cchar *header, cchar *encoding)
+{
+    char    *list, *item, *tok, *params, *q;
+
+    list = sclone(header);
+    for (item = stok(list, ",", &tok); item; item = stok(NULL, ",", &tok)) {
+        item = strim(item, " \t", MPR_TRIM_BOTH);
+        if ((params = schr(item, ';')) != 0) {
+            *params++ = '\0';
+            item = strim(item, " \t", MPR_TRIM_END);
+        }
+        if (scaselessmatch(item, encoding)) {
+            if (params && (q = sncontains(params, "q=", -1)) != 0 && stof(&q[2]) <= 0) {
+                return 0;
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+static int matchCompress(HttpConn *conn, HttpRoute *route, int dir)
+{
+    cchar   *accept;
+
+    if (!(dir & HTTP_STAGE_TX) || httpClientConn(conn) || conn->upgraded) {
+        return HTTP_ROUTE_OMIT_FILTER;
+    }
+    if ((accept = httpGetHeader(conn, "accept-encoding")) == 0) {
+        return HTTP_ROUTE_OMIT_FILTER;
+    }
+    if (!acceptsEncoding(accept, "gzip") && !acceptsEncoding(accept, "deflate")) {
+        return HTTP_ROUTE_OMIT_FILTER;
+    }
+    return HTTP_ROUTE_OK;
+}
+
+
+static int openCompress(HttpQueue *q)
+{
+    Compress    *cp;
+
+    if ((cp = mprAllocObj(Compress, manageCompress)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    cp->conn = q->conn;
+    cp->gzip = acceptsEncoding(httpGetHeader(q->conn, "accept-encoding"), "gzip");
+    q->queueData = cp;
+    return 0;
+}
+
+
+static void closeCompress(HttpQueue *q)
+{
+    if (q->queueData) {
+        releaseStream(q->queueData);
+    }
+}
+
+
+/*
+    Decide if the response should be compressed. This is done when the first output is serviced as the response
+    status and headers are not known when the pipeline is created. HEAD requests are decided the same way so their
+    headers match the corresponding GET response. The connector discards the body.
+ */
+static int shouldCompress(HttpQueue *q)
+{
+    HttpConn    *conn;
+    HttpTx      *tx;
+    HttpPacket  *packet;
+    MprOff      length;
+    cchar       *type, *value, *prefix;
+    int         next, matched;
+
+    conn = q->conn;
+    tx = conn->tx;
+    if (tx->status != HTTP_CODE_OK || (tx->flags & (HTTP_TX_NO_BODY | HTTP_TX_HEADERS_CREATED)) || tx->outputRanges ||
+            httpGetHeader(conn, "range")) {
+        return 0;
+    }
+    if (mprLookupKey(tx->headers, "Content-Encoding")) {
+        return 0;
+    }
+    if ((value = mprLookupKey(tx->headers, "Cache-Control")) != 0 && scontains(value, "no-transform")) {
+        return 0;
+    }
+    if ((type = mprLookupKey(tx->headers, "Content-Type")) == 0) {
+        return 0;
+    }
+    matched = 0;
+    mprLock(streamLock);
+    for (ITERATE_ITEMS(compressConfig->types, prefix, next)) {
+        if (sncaselesscmp(type, prefix, slen(prefix)) == 0) {
+            matched = 1;
+            break;
+        }
+    }
+    mprUnlock(streamLock);
+    if (!matched) {
+        return 0;
+    }
+    for (packet = q->first; packet; packet = packet->next) {
+        if (packet->esize > 0) {
+            /* File entity packet for the send connector */
+            return 0;
+        }
+    }
+    length = -1;
+    if ((value = mprLookupKey(tx->headers, "Content-Length")) != 0) {
+        length = stoi(value);
+    } else if (tx->length >= 0) {
+        length = tx->length;
+    } else if (q->last && (q->last->flags & HTTP_PACKET_END)) {
+        length = q->count;
+    }
+    if (length >= 0 && length < compressConfig->minimum) {
+        return 0;
+    }
+    return 1;
+}
+
+
+/*
+    Define the response headers for the compressed entity
+ */
+static void setCompressHeaders(Compress *cp)
+{
+    HttpConn    *conn;
+    cchar       *etag, *vary, *suffix;
+    ssize       len;
+
+    conn = cp->conn;
+    httpSetHeaderString(conn, "Content-Encoding", cp->gzip ? "gzip" : "deflate");
+    if ((vary = mprLookupKey(conn->tx->headers, "Vary")) == 0 || !scontains(slower(vary), "accept-encoding")) {
+        httpAppendHeaderString(conn, "Vary", "Accept-Encoding");
+    }
+    httpRemoveHeader(conn, "Content-Length");
+
+    /* The compressed representation must have a distinct entity tag */
+    suffix = cp->gzip ? "-gzip" : "-deflate";
+    if ((etag = mprLookupKey(conn->tx->headers, "ETag")) != 0 && !scontains(etag, suffix)) {
+        len = slen(etag);
+        if (len > 1 && etag[len - 1] == '"') {
+            httpSetHeaderString(conn, "ETag", sfmt("%s%s\"", snclone(etag, len - 1), suffix));
+        } else {
+            httpSetHeaderString(conn, "ETag", sjoin(etag, suffix, NULL));
+        }
+    }
+}
+
+
+/*
+    Headers callback to redefine the response headers after the prior callback fills them
+ */
+static int fillCompressHeaders(Compress *cp)
+{
+    if (cp->headersCallback) {
+        (cp->headersCallback)(cp->headersCallbackArg);
+    }
+    setCompressHeaders(cp);
+    return 0;
+}
+
+
+static void startCompress(HttpQueue *q, Compress *cp)
+{
+    HttpConn    *conn;
+
+    conn = q->conn;
+    if ((cp->zs = getStream(cp)) == 0) {
+        cp->state = -1;
+        return;
+    }
+    cp->state = 1;
+    /* The length is unknown until compressed. Downstream filters will chunk or measure the output */
+    conn->tx->length = -1;
+    setCompressHeaders(cp);
+    if (conn->headersCallback) {
+        cp->headersCallback = conn->headersCallback;
+        cp->headersCallbackArg = conn->headersCallbackArg;
+        httpSetHeadersCallback(conn, (HttpHeadersCallback) fillCompressHeaders, cp);
+    }
+}
+
+
+/*
+    Compress a packet of data and pass the output downstream
+ */
+static void compressPacket(HttpQueue *q, Compress *cp, HttpPacket *packet, int flush)
+{
+    HttpPacket  *out;
+    z_stream    *zs;
+
+    zs = cp->zs;
+    if (packet && packet->content) {
+        zs->next_in = (Bytef*) mprGetBufStart(packet->content);
+        zs->avail_in = (uInt) httpGetPacketLength(packet);
+    } else {
+        zs->next_in = 0;
+        zs->avail_in = 0;
+    }
+    do {
+        if ((out = httpCreateDataPacket(ZBUFSIZE)) == 0) {
+            return;
+        }
+        zs->next_out = (Bytef*) mprGetBufEnd(out->content);
+        zs->avail_out = ZBUFSIZE;
+        deflate(zs, flush);
+        mprAdjustBufEnd(out->content, ZBUFSIZE - zs->avail_out);
+        if (httpGetPacketLength(out) > 0) {
+            httpPutPacketToNext(q, out);
+        }
+    } while (zs->avail_out == 0);
+}
+
+
+static void outgoingCompressService(HttpQueue *q)
+{
+    HttpPacket  *packet;
+    Compress    *cp;
+    int         flush;
+
+    cp = q->queueData;
+    if (cp->state == 0) {
+        if (q->first == 0) {
+            return;
+        }
+        if (shouldCompress(q)) {
+            startCompress(q, cp);
+        } else {
+            cp->state = -1;
+        }
+    }
+    if (cp->state < 0) {
+        httpDefaultOutgoingServiceStage(q);
+        return;
+    }
+    for (packet = httpGetPacket(q); packet; packet = httpGetPacket(q)) {
+        if (!httpWillNextQueueAcceptPacket(q, packet)) {
+            httpPutBackPacket(q, packet);
+            return;
+        }
+        if (packet->flags & HTTP_PACKET_DATA) {
+            /* Flush when the queue is drained so streamed responses are not delayed */
+            flush = q->first ? Z_NO_FLUSH : Z_SYNC_FLUSH;
+            compressPacket(q, cp, packet, flush);
+
+        } else if (packet->flags & HTTP_PACKET_END) {
+            compressPacket(q, cp, NULL, Z_FINISH);
+            releaseStream(cp);
+            httpPutPacketToNext(q, packet);
+
+        } else {
+            httpPutPacketToNext(q, packet);
+        }
+    }
+}
+
+
+static int openCompressFilter()
+{
+    HttpStage   *filter;
+    char        *type, *tok;
+
+    mprGlobalLock();
+    if (httpLookupStage("compressFilter") == 0) {
+        compressConfig = mprAllocStruct(CompressConfig);
+        mprAddRoot(compressConfig);
+        compressConfig->types = mprCreateList(0, 0);
+        for (type = stok(sclone(ZTYPES), " ", &tok); type; type = stok(NULL, " ", &tok)) {
+            mprAddItem(compressConfig->types, sclone(type));
+        }
+        mprAddRoot(compressConfig->types);
+        compressConfig->minimum = ZMINSIZE;
+        compressConfig->level = Z_DEFAULT_COMPRESSION;
+        streamLock = mprCreateLock();
+        mprAddRoot(streamLock);
+        if ((filter = httpCreateFilter("compressFilter", NULL)) == 0) {
+            mprGlobalUnlock();
+            return MPR_ERR_CANT_CREATE;
+        }
+        filter->match = matchCompress;
+        filter->open = openCompress;
+        filter->close = closeCompress;
+        filter->outgoingService = outgoingCompressService;
+    }
+    mprGlobalUnlock();
+    return 0;
+}
+
 /*********************************** Factory *******************************/
 
 #if UNUSED
@@ -333,7 +770,8 @@ static int configureZlibTypes(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_uncompressBytes, zlib_uncompressBytes);
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_compressString, zlib_compressString);
     ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_uncompressString, zlib_uncompressString);
-    return 0;
+    ejsBindMethod(ejs, type, ES_ejs_zlib_Zlib_configureFilter, zlib_configureFilter);
+    return openCompressFilter();
 }
 
 
@@ -95,6 +95,9 @@ struct HttpWebSocket;
 #ifndef ME_MAX_IOVEC
     #define ME_MAX_IOVEC           16                  /**< Number of fragments in a single socket write */
 #endif
+#ifndef ME_MAX_COALESCE
+    #define ME_MAX_COALESCE        (32 * 1024)         /**< Maximum pipelined response data to coalesce per write */
+#endif
 #ifndef ME_MAX_CLIENTS_HASH
     #define ME_MAX_CLIENTS_HASH    131                 /**< Hash table for client IP addresses */
 #endif
@@ -2885,7 +2888,7 @@ PUBLIC void httpSetIOCallback(struct HttpConn *conn, HttpIOCallback fn);
         httpDisconnect httpEnableUpload httpError httpIOEvent httpGetAsync httpGetChunkSize httpGetConnContext
         httpGetConnHost httpGetError httpGetExt httpGetKeepAliveCount httpGetWriteQueueCount httpMatchHost httpMemoryError
         httpAfterEvent httpPrepClientConn httpResetCredentials httpRouteRequest httpRunHandlerReady httpService
-        httpSetAsync httpSetChunkSize httpSetConnContext httpSetConnHost httpSetConnNotifier httpSetCredentials
+        httpSetAsync httpSetChunkSize httpSetConnContext httpSetConnHost httpSetConnNotifier httpSetConnTimer httpSetCredentials
         httpSetFileHandler httpSetKeepAliveCount httpSetProtocol httpSetRetries httpSetSendConnector httpSetState 
         httpSetTimeout httpSetTimestamp httpStartPipeline
     @stability Internal
@@ -2920,9 +2923,11 @@ typedef struct HttpConn {
     HttpPacket      *input;                 /**< Header packet */
     ssize           lastRead;               /**< Length of new data last read into the input packet */
     HttpQueue       *connectorq;            /**< Connector write queue */
+    MprBuf          *pendingOutput;         /**< Coalesced responses awaiting a single write (pipelined requests) */
     MprTicks        started;                /**< When the request started (ticks) */
     MprTicks        lastActivity;           /**< Last activity on the connection */
     MprEvent        *timeoutEvent;          /**< Connection or request timeout event */
+    MprEvent        *timerEvent;            /**< Connection timer on the MPR timer wheel */
     MprEvent        *workerEvent;           /**< Event for running connection via a worker thread (used by ejs) */
 
     void            *context;               /**< Embedding context (EjsRequest) */
@@ -2951,6 +2956,7 @@ typedef struct HttpConn {
     bool            async: 1;               /**< Connection is in async mode (non-blocking) */
     bool            authRequested: 1;       /**< Authorization requested based on user credentials */
     bool            borrowed: 1;            /**< Connection has been borrowed */
+    bool            corked: 1;              /**< Coalesce completed responses while servicing pipelined requests */
     bool            destroyed: 1;           /**< Connection has been destroyed */
     bool            encoded: 1;             /**< True if the password is MD5(username:realm:password) */
     bool            followRedirects: 1;     /**< Follow redirects for client requests */
@@ -3402,7 +3408,7 @@ PUBLIC void httpRouteRequest(HttpConn *conn);
     Schedule a connection timeout event on a connection
     @description This call schedules an event to run serialized on the connection dispatcher. When run, it will
         cancels the current request, disconnects the socket and issues an error to the error log.
-        This call is normally invoked by the httpTimer which runs regularly to check for timed out requests.
+        This call is normally invoked by the connection timer when a request or connection timeout expires.
     @param conn HttpConn connection object created via #httpCreateConn
     @ingroup HttpConn
     @stability Internal
@@ -3504,6 +3510,18 @@ PUBLIC void httpSetConnHost(HttpConn *conn, void *host);
  */
 PUBLIC void httpSetConnNotifier(HttpConn *conn, HttpNotifier notifier);
 
+/**
+    Arm the connection timer
+    @description The connection timer enforces the request parse, inactivity and request duration timeouts. It is held
+        on the MPR timer wheel and armed for the earliest timeout. Connection activity does not re-arm the timer.
+        Rather, when the timer fires, it re-evaluates the timeouts and re-arms for the remaining time. Call this after
+        changing the connection limits so that a shorter timeout takes effect.
+    @param conn HttpConn connection object created via #httpCreateConn
+    @ingroup HttpConn
+    @stability Internal
+ */
+PUBLIC void httpSetConnTimer(HttpConn *conn);
+
 /**
     Set the logged in user associated with the connection
     @param conn HttpConn connection object created via #httpCreateConn
@@ -3691,6 +3709,7 @@ PUBLIC bool httpVerifyWebSocketsHandshake(HttpConn *conn);
 /* Internal APIs */
 PUBLIC struct HttpConn *httpAccept(struct HttpEndpoint *endpoint);
 PUBLIC void httpEnableConnEvents(HttpConn *conn);
+PUBLIC bool httpFlushPendingOutput(HttpConn *conn);
 PUBLIC void httpParseMethod(HttpConn *conn);
 PUBLIC HttpLimits *httpSetUniqueConnLimits(HttpConn *conn);
 PUBLIC void httpUsePrimary(HttpConn *conn);
@@ -7219,7 +7238,7 @@ PUBLIC ssize httpWriteUploadData(HttpConn *conn, MprList *formData, MprList *fil
     @see HttpEndpoint httpAcceptConn httpAddHostToEndpoint httpCreateConfiguredEndpoint httpCreateEndpoint
         httpDestroyEndpoint httpGetEndpointContext httpIsEndpointAsync
         httpLookupHostOnEndpoint httpSecureEndpoint httpSecureEndpointByName httpSetEndpointAddress
-        httpSetEndpointAsync httpSetEndpointContext httpSetEndpointNotifier
+        httpSetEndpointAcceptors httpSetEndpointAsync httpSetEndpointContext httpSetEndpointNotifier
         httpStartEndpoint httpStopEndpoint
     @stability Internal
  */
@@ -7230,10 +7249,13 @@ typedef struct HttpEndpoint {
     int             port;                   /**< Listen port */
     int             async;                  /**< Listening is in async mode (non-blocking) */
     int             flags;                  /**< Endpoint control flags */
+    int             acceptors;              /**< Number of SO_REUSEPORT listening sockets. Zero or one for one listener */
     void            *context;               /**< Embedding context */
     HttpLimits      *limits;                /**< Alias for first host, default route resource limits */
     MprSocket       *sock;                  /**< Listening socket */
+    MprList         *listeners;             /**< All listening sockets when using multiple acceptors */
     MprDispatcher   *dispatcher;            /**< Event dispatcher */
+    MprList         *dispatchers;           /**< Acceptor dispatchers used only to accept connections */
     HttpNotifier    notifier;               /**< Default connection notifier callback */
     struct MprSsl   *ssl;                   /**< Endpoint SSL configuration */
     MprMutex        *mutex;                 /**< Multithread sync */
@@ -7377,6 +7399,22 @@ PUBLIC int httpSecureEndpointByName(cchar *name, struct MprSsl *ssl);
  */
 PUBLIC int httpSetEndpointAddress(HttpEndpoint *endpoint, cchar *ip, int port);
 
+/**
+    Set the number of acceptors for the endpoint
+    @description An endpoint with multiple acceptors opens one SO_REUSEPORT listening socket per acceptor and the O/S
+        distributes new connections between them. Each acceptor has its own dispatcher that only accepts connections.
+        Each accepted connection is serviced on a new dispatcher as for a single listener. If the endpoint was
+        created with a dispatcher, all acceptors and connections use that dispatcher. Multiple acceptors require async mode and a
+        system that supports SO_REUSEPORT. Otherwise the endpoint uses one listener. This must be called before
+        starting the endpoint.
+    @param endpoint HttpEndpoint object created via #httpCreateEndpoint
+    @param acceptors Number of listening sockets. Typically the number of CPU cores. Set to zero or one for a
+        single listener.
+    @ingroup HttpEndpoint
+    @stability Prototype
+ */
+PUBLIC void httpSetEndpointAcceptors(HttpEndpoint *endpoint, int acceptors);
+
 /**
     Control if the endpoint is running in asynchronous mode
     @param endpoint HttpEndpoint object created via #httpCreateEndpoint
@@ -7685,6 +7723,7 @@ typedef struct HttpWebSocket {
     HttpPacket      *currentMessage;        /**< Current incoming messsage so far */
     HttpPacket      *tailMessage;           /**< Subsequent message frames */
     MprEvent        *pingEvent;             /**< Ping timer event */
+    MprEvent        *flushEvent;            /**< Deferred flush of buffered messages */
     char            *subProtocol;           /**< Application level sub-protocol */
     cchar           *errorMsg;              /**< Error message for last I/O */
     cchar           *closeReason;           /**< Reason for closure */
@@ -7820,7 +7859,8 @@ PUBLIC ssize httpSend(HttpConn *conn, cchar *fmt, ...) PRINTF_ATTRIBUTE(2,3);
     This is required by the WebSockets specification.
     \n\n
     Buffered mode is the default and may be explicitly specified via the HTTP_BUFFER flag. In buffered mode, the entire 
-    message will be accepted and will be buffered if required.
+    message will be accepted and will be buffered if required. On the server, buffered data messages are written when 
+    the current event callback returns, so that messages sent together are written to the socket with one system call.
     \n\n
     This API may split the message into frames such that no frame is larger than the limit conn->limits->webSocketsFrameSize.
     However, if the HTTP_MORE flag is specified to indicate there is more data to complete this entire message, the data 
@@ -593,7 +593,8 @@ PUBLIC void httpSetListenCallback(HttpListenCallback fn)
 
 /*
     The http timer does maintenance activities and will fire per second while there are active requests.
-    This routine will also be called by httpTerminate with event == 0 to signify a shutdown.
+    Request and connection timeouts are enforced by the per-connection timers (see httpSetConnTimer). This routine will
+    also be called by httpTerminate with event == 0 to signify a shutdown, and then examines all connections.
     NOTE: Because we lock the http here, connections cannot be deleted while we are modifying the list.
  */
 static void httpTimer(Http *http, MprEvent *event)
@@ -606,38 +607,37 @@ static void httpTimer(Http *http, MprEvent *event)
 
     updateCurrentDate();
 
-    /* 
-       Check for any inactive connections or expired requests (inactivityTimeout and requestTimeout)
-       OPT - could check for expired connections every 10 seconds.
-     */
     lock(http->connections);
-    for (active = 0, next = 0; (conn = mprGetNextItem(http->connections, &next)) != 0; active++) {
-        limits = conn->limits;
-        if (!conn->timeoutEvent) {
-            abort = mprIsStopping();
-            if (httpServerConn(conn) && (HTTP_STATE_CONNECTED < conn->state && conn->state < HTTP_STATE_PARSED) && 
-                    (http->now - conn->started) > limits->requestParseTimeout) {
-                conn->timeout = HTTP_PARSE_TIMEOUT;
-                abort = 1;
-            } else if ((http->now - conn->lastActivity) > limits->inactivityTimeout) {
-                conn->timeout = HTTP_INACTIVITY_TIMEOUT;
-                abort = 1;
-            } else if ((http->now - conn->started) > limits->requestTimeout) {
-                conn->timeout = HTTP_REQUEST_TIMEOUT;
-                abort = 1;
-            } else if (!event) {
-                /* Called directly from httpStop to stop connections */
-                if (MPR->exitTimeout > 0) {
-                    if (conn->state == HTTP_STATE_COMPLETE || 
-                        (HTTP_STATE_CONNECTED < conn->state && conn->state < HTTP_STATE_PARSED)) {
+    active = mprGetListLength(http->connections);
+    if (!event || mprIsStopping()) {
+        for (next = 0; (conn = mprGetNextItem(http->connections, &next)) != 0; ) {
+            limits = conn->limits;
+            if (!conn->timeoutEvent) {
+                abort = mprIsStopping();
+                if (httpServerConn(conn) && (HTTP_STATE_CONNECTED < conn->state && conn->state < HTTP_STATE_PARSED) && 
+                        (http->now - conn->started) > limits->requestParseTimeout) {
+                    conn->timeout = HTTP_PARSE_TIMEOUT;
+                    abort = 1;
+                } else if ((http->now - conn->lastActivity) > limits->inactivityTimeout) {
+                    conn->timeout = HTTP_INACTIVITY_TIMEOUT;
+                    abort = 1;
+                } else if ((http->now - conn->started) > limits->requestTimeout) {
+                    conn->timeout = HTTP_REQUEST_TIMEOUT;
+                    abort = 1;
+                } else if (!event) {
+                    /* Called directly from httpStop to stop connections */
+                    if (MPR->exitTimeout > 0) {
+                        if (conn->state == HTTP_STATE_COMPLETE || 
+                            (HTTP_STATE_CONNECTED < conn->state && conn->state < HTTP_STATE_PARSED)) {
+                            abort = 1;
+                        }
+                    } else {
                         abort = 1;
                     }
-                } else {
-                    abort = 1;
                 }
-            }
-            if (abort && !mprGetDebugMode()) {
-                httpScheduleConnTimeout(conn);
+                if (abort && !mprGetDebugMode()) {
+                    httpScheduleConnTimeout(conn);
+                }
             }
         }
     }
@@ -731,12 +731,19 @@ PUBLIC void httpAddConn(HttpConn *conn)
         }
     }
     unlock(http);
+    httpSetConnTimer(conn);
 }
 
 
 PUBLIC void httpRemoveConn(HttpConn *conn)
 {
+    lock(HTTP->connections);
+    if (conn->timerEvent) {
+        mprRemoveEvent(conn->timerEvent);
+        conn->timerEvent = 0;
+    }
     mprRemoveItem(HTTP->connections, conn);
+    unlock(HTTP->connections);
 }
 
 
@@ -4861,12 +4868,13 @@ static void parseServerListen(HttpRoute *route, cchar *key, MprJson *prop)
     HttpHost        *host;
     MprJson         *child;
     char            *ip;
-    int             ji, port, secure;
+    int             acceptors, ji, port, secure;
 
     if (route->flags & HTTP_ROUTE_HOSTED) {
         return;
     }
     host = route->host;
+    acceptors = (int) stoi(mprGetJson(route->config, "http.server.acceptors"));
     for (ITERATE_CONFIG(route, prop, child, ji)) {
         mprParseSocketAddress(child->value, &ip, &port, &secure, 80);
         if (port == 0) {
@@ -4874,6 +4882,7 @@ static void parseServerListen(HttpRoute *route, cchar *key, MprJson *prop)
             return;
         }
         endpoint = httpCreateEndpoint(ip, port, NULL);
+        httpSetEndpointAcceptors(endpoint, acceptors);
         if (!host->defaultEndpoint) {
             httpSetHostDefaultEndpoint(host, endpoint);
         }
@@ -5480,7 +5489,9 @@ PUBLIC int httpInitParser()
 
 /***************************** Forward Declarations ***************************/
 
+static void connTimer(HttpConn *conn, MprEvent *event);
 static HttpPacket *getPacket(HttpConn *conn, ssize *bytesToRead);
+static MprTicks getConnTimeout(HttpConn *conn, MprTicks now, int *timeout);
 static void manageConn(HttpConn *conn, int flags);
 static bool prepForNext(HttpConn *conn);
 
@@ -5589,7 +5600,9 @@ static void manageConn(HttpConn *conn, int flags)
         mprMark(conn->host);
         mprMark(conn->input);
         mprMark(conn->connectorq);
+        mprMark(conn->pendingOutput);
         mprMark(conn->timeoutEvent);
+        mprMark(conn->timerEvent);
         mprMark(conn->workerEvent);
         mprMark(conn->context);
         mprMark(conn->ejs);
@@ -5699,6 +5712,83 @@ PUBLIC void httpScheduleConnTimeout(HttpConn *conn)
 }
 
 
+/*
+    Get the time remaining till the earliest applicable timeout. If a timeout has expired, return a negative value
+    and set *timeout to the expired timeout.
+ */
+static MprTicks getConnTimeout(HttpConn *conn, MprTicks now, int *timeout)
+{
+    HttpLimits  *limits;
+    MprTicks    parse, inactivity, duration;
+
+    limits = conn->limits;
+    parse = MPR_MAX_TIMEOUT;
+    if (httpServerConn(conn) && (HTTP_STATE_CONNECTED < conn->state && conn->state < HTTP_STATE_PARSED)) {
+        parse = limits->requestParseTimeout - (now - conn->started);
+    }
+    inactivity = limits->inactivityTimeout - (now - conn->lastActivity);
+    duration = limits->requestTimeout - (now - conn->started);
+
+    if (parse < 0) {
+        *timeout = HTTP_PARSE_TIMEOUT;
+    } else if (inactivity < 0) {
+        *timeout = HTTP_INACTIVITY_TIMEOUT;
+    } else if (duration < 0) {
+        *timeout = HTTP_REQUEST_TIMEOUT;
+    }
+    /* Limits may be MPR_MAX_TIMEOUT. Bound the result so the timer due time cannot overflow */
+    return min(min(parse, min(inactivity, duration)), MAXINT);
+}
+
+
+/*
+    Connection timer. This runs on the MPR non-blocking dispatcher. Activity on the connection does not re-arm the
+    timer, so the timeouts are re-evaluated here and the timer re-armed for the remaining time.
+    NOTE: Because we lock the http connections here, the connection cannot be removed while it is being examined.
+ */
+static void connTimer(HttpConn *conn, MprEvent *event)
+{
+    MprTicks    remaining;
+    int         timeout;
+
+    lock(conn->http->connections);
+    if (conn->destroyed || conn->timerEvent != event) {
+        unlock(conn->http->connections);
+        return;
+    }
+    remaining = HTTP_TIMER_PERIOD;
+    if (!conn->timeoutEvent) {
+        timeout = 0;
+        if ((remaining = getConnTimeout(conn, mprGetTicks(), &timeout)) < 0) {
+            conn->timeout = timeout;
+            httpScheduleConnTimeout(conn);
+            /* Recheck in case the connection survives the timeout */
+            remaining = HTTP_TIMER_PERIOD;
+        }
+    }
+    event->period = max(remaining, 1);
+    unlock(conn->http->connections);
+}
+
+
+PUBLIC void httpSetConnTimer(HttpConn *conn)
+{
+    MprTicks    remaining;
+    int         timeout;
+
+    if (conn->destroyed || mprGetDebugMode()) {
+        return;
+    }
+    remaining = max(getConnTimeout(conn, mprGetTicks(), &timeout), 1);
+    if (conn->timerEvent) {
+        mprRescheduleEvent(conn->timerEvent, remaining);
+    } else {
+        conn->timerEvent = mprCreateTimerEvent(NULL, "connTimer", remaining, connTimer, conn, 
+            MPR_EVENT_QUICK | MPR_EVENT_WHEEL);
+    }
+}
+
+
 static void commonPrep(HttpConn *conn)
 {
     if (conn->timeoutEvent) {
@@ -5744,6 +5834,10 @@ static bool prepForNext(HttpConn *conn)
     conn->user = 0;
     conn->authData = 0;
     conn->encoded = 0;
+    /*
+        The connector queue belongs to the completed pipeline. Do not let I/O events resume it against the new request.
+     */
+    conn->connectorq = 0;
     conn->rx = httpCreateRx(conn);
     conn->tx = httpCreateTx(conn, NULL);
     commonPrep(conn);
@@ -5928,8 +6022,11 @@ PUBLIC void httpIO(HttpConn *conn, int eventMask)
     assert(conn->tx);
     assert(conn->rx);
 
-    if ((eventMask & MPR_WRITABLE) && conn->connectorq) {
-        httpResumeQueue(conn->connectorq);
+    if (eventMask & MPR_WRITABLE) {
+        httpFlushPendingOutput(conn);
+        if (conn->connectorq) {
+            httpResumeQueue(conn->connectorq);
+        }
     }
     if (eventMask & MPR_READABLE) {
         readPeerData(conn);
@@ -5946,12 +6043,16 @@ PUBLIC void httpIO(HttpConn *conn, int eventMask)
         }
     }
     /*
-        Process one or more complete requests in the packet
+        Process one or more complete requests in the packet. While corked, the net connector may coalesce completed
+        responses to pipelined requests. These are written together once all the buffered requests have been served.
      */
+    conn->corked = 1;
     do {
         /* This is and must be the only place httpProtocol is ever called */
         httpProtocol(conn);
     } while (conn->endpoint && conn->state == HTTP_STATE_COMPLETE && prepForNext(conn));
+    conn->corked = 0;
+    httpFlushPendingOutput(conn);
 
     /*
         When a request completes, prepForNext will reset the state to HTTP_STATE_BEGIN
@@ -5990,6 +6091,7 @@ PUBLIC int httpGetConnEventMask(HttpConn *conn)
     if (rx) {
         if (conn->connError || (tx->writeBlocked) ||
            (conn->connectorq && (conn->connectorq->count > 0 || conn->connectorq->ioCount > 0)) ||
+           (conn->pendingOutput && mprGetBufLength(conn->pendingOutput) > 0) ||
            (httpQueuesNeedService(conn)) ||
            (mprSocketHasBufferedWrite(sp)) ||
            (rx->eof && tx->finalized && conn->state < HTTP_STATE_FINALIZED)) {
@@ -6354,6 +6456,7 @@ PUBLIC void httpSetTimeout(HttpConn *conn, MprTicks requestTimeout, MprTicks ina
             conn->limits->inactivityTimeout = inactivityTimeout;
         }
     }
+    httpSetConnTimer(conn);
 }
 
 
@@ -7526,10 +7629,18 @@ PUBLIC int httpOpenDirHandler()
 
 
 
+/*********************************** Locals ***********************************/
+
+#define HTTP_ACCEPT_BATCH   16              /* Maximum connections accepted per acceptor I/O event */
+
 /********************************** Forwards **********************************/
 
 static void acceptConn(HttpEndpoint *endpoint);
+static void acceptOnListener(HttpEndpoint *endpoint, MprEvent *event);
+static void closeListeners(HttpEndpoint *endpoint);
 static int manageEndpoint(HttpEndpoint *endpoint, int flags);
+static MprSocket *openListener(HttpEndpoint *endpoint, int flags);
+static int startAcceptors(HttpEndpoint *endpoint, int flags);
 
 /************************************ Code ************************************/
 /*
@@ -7556,9 +7667,15 @@ PUBLIC HttpEndpoint *httpCreateEndpoint(cchar *ip, int port, MprDispatcher *disp
 
 PUBLIC void httpDestroyEndpoint(HttpEndpoint *endpoint)
 {
-    if (endpoint->sock) {
-        mprCloseSocket(endpoint->sock, 0);
-        endpoint->sock = 0;
+    MprDispatcher   *dispatcher;
+    int             next;
+
+    closeListeners(endpoint);
+    if (endpoint->dispatchers) {
+        for (ITERATE_ITEMS(endpoint->dispatchers, dispatcher, next)) {
+            mprDestroyDispatcher(dispatcher);
+        }
+        endpoint->dispatchers = 0;
     }
     httpRemoveEndpoint(endpoint);
 }
@@ -7573,7 +7690,9 @@ static int manageEndpoint(HttpEndpoint *endpoint, int flags)
         mprMark(endpoint->context);
         mprMark(endpoint->limits);
         mprMark(endpoint->sock);
+        mprMark(endpoint->listeners);
         mprMark(endpoint->dispatcher);
+        mprMark(endpoint->dispatchers);
         mprMark(endpoint->ssl);
         mprMark(endpoint->mutex);
     }
@@ -7674,7 +7793,7 @@ PUBLIC int httpStartEndpoint(HttpEndpoint *endpoint)
 {
     HttpHost    *host;
     cchar       *proto, *ip;
-    int         next;
+    int         flags, next;
 
     if (!validateEndpoint(endpoint)) {
         return MPR_ERR_BAD_ARGS;
@@ -7682,23 +7801,24 @@ PUBLIC int httpStartEndpoint(HttpEndpoint *endpoint)
     for (ITERATE_ITEMS(endpoint->hosts, host, next)) {
         httpStartHost(host);
     }
-    if ((endpoint->sock = mprCreateSocket()) == 0) {
-        return MPR_ERR_MEMORY;
+    flags = MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD;
+#if defined(SO_REUSEPORT)
+    if (endpoint->async && endpoint->acceptors > 1) {
+        flags |= MPR_SOCKET_REUSE_PORT;
     }
-    if (mprListenOnSocket(endpoint->sock, endpoint->ip, endpoint->port, 
-                MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD) == SOCKET_ERROR) {
-        if (mprGetError() == EADDRINUSE) {
-            mprLog("error http", 0, "Cannot open a socket on %s:%d, socket already bound.", 
-                *endpoint->ip ? endpoint->ip : "*", endpoint->port);
-        } else {
-            mprLog("error http", 0, "Cannot open a socket on %s:%d", *endpoint->ip ? endpoint->ip : "*", endpoint->port);
-        }
+#endif
+    if ((endpoint->sock = openListener(endpoint, flags)) == 0) {
         return MPR_ERR_CANT_OPEN;
     }
     if (endpoint->http->listenCallback && (endpoint->http->listenCallback)(endpoint) < 0) {
         return MPR_ERR_CANT_OPEN;
     }
-    if (endpoint->async && !endpoint->sock->handler) {
+    if (flags & MPR_SOCKET_REUSE_PORT) {
+        if (startAcceptors(endpoint, flags) < 0) {
+            closeListeners(endpoint);
+            return MPR_ERR_CANT_OPEN;
+        }
+    } else if (endpoint->async && !endpoint->sock->handler) {
         mprAddSocketHandler(endpoint->sock, MPR_SOCKET_READABLE, endpoint->dispatcher, acceptConn, endpoint, 
             (endpoint->dispatcher ? 0 : MPR_WAIT_NEW_DISPATCHER) | MPR_WAIT_IMMEDIATE);
     } else {
@@ -7715,13 +7835,72 @@ PUBLIC int httpStartEndpoint(HttpEndpoint *endpoint)
 }
 
 
-PUBLIC void httpStopEndpoint(HttpEndpoint *endpoint)
+static MprSocket *openListener(HttpEndpoint *endpoint, int flags)
 {
-    HttpHost    *host;
+    MprSocket   *sock;
+
+    if ((sock = mprCreateSocket()) == 0) {
+        return 0;
+    }
+    if (mprListenOnSocket(sock, endpoint->ip, endpoint->port, flags) == SOCKET_ERROR) {
+        if (mprGetError() == EADDRINUSE) {
+            mprLog("error http", 0, "Cannot open a socket on %s:%d, socket already bound.", 
+                *endpoint->ip ? endpoint->ip : "*", endpoint->port);
+        } else {
+            mprLog("error http", 0, "Cannot open a socket on %s:%d", *endpoint->ip ? endpoint->ip : "*", endpoint->port);
+        }
+        return 0;
+    }
+    return sock;
+}
+
+
+/*
+    Open one SO_REUSEPORT listener per acceptor. The O/S distributes new connections over the listeners. Each acceptor
+    has its own dispatcher which is used only to accept connections. As for a single listener, each accepted connection
+    is served on a new dispatcher. If the endpoint has a dispatcher, it is used by all acceptors and connections.
+ */
+static int startAcceptors(HttpEndpoint *endpoint, int flags)
+{
+    MprDispatcher   *dispatcher;
+    MprSocket       *sock;
+    int             i;
+
+    endpoint->listeners = mprCreateList(endpoint->acceptors, MPR_LIST_STABLE);
+    if (!endpoint->dispatcher && !endpoint->dispatchers) {
+        endpoint->dispatchers = mprCreateList(endpoint->acceptors, MPR_LIST_STABLE);
+    }
+    for (i = 0; i < endpoint->acceptors; i++) {
+        if (i == 0) {
+            sock = endpoint->sock;
+        } else if ((sock = openListener(endpoint, flags)) == 0) {
+            return MPR_ERR_CANT_OPEN;
+        }
+        mprAddItem(endpoint->listeners, sock);
+        if ((dispatcher = endpoint->dispatcher) == 0) {
+            if ((dispatcher = mprGetItem(endpoint->dispatchers, i)) == 0) {
+                dispatcher = mprCreateDispatcher(sfmt("acceptor-%d", i), 0);
+                mprAddItem(endpoint->dispatchers, dispatcher);
+            }
+        }
+        mprAddSocketHandler(sock, MPR_SOCKET_READABLE, dispatcher, acceptOnListener, endpoint, 0);
+    }
+    return 0;
+}
+
+
+static void closeListeners(HttpEndpoint *endpoint)
+{
+    MprSocket   *sock;
     int         next;
 
-    for (ITERATE_ITEMS(endpoint->hosts, host, next)) {
-        httpStopHost(host);
+    if (endpoint->listeners) {
+        for (ITERATE_ITEMS(endpoint->listeners, sock, next)) {
+            if (sock != endpoint->sock) {
+                mprCloseSocket(sock, 0);
+            }
+        }
+        endpoint->listeners = 0;
     }
     if (endpoint->sock) {
         mprCloseSocket(endpoint->sock, 0);
@@ -7730,6 +7909,18 @@ PUBLIC void httpStopEndpoint(HttpEndpoint *endpoint)
 }
 
 
+PUBLIC void httpStopEndpoint(HttpEndpoint *endpoint)
+{
+    HttpHost    *host;
+    int         next;
+
+    for (ITERATE_ITEMS(endpoint->hosts, host, next)) {
+        httpStopHost(host);
+    }
+    closeListeners(endpoint);
+}
+
+
 /*
     This routine runs using the service event thread. It accepts the socket and creates an event on a new dispatcher to 
     manage the connection. When it returns, it immediately can listen for new connections without having to modify the 
@@ -7766,6 +7957,47 @@ static void acceptConn(HttpEndpoint *endpoint)
 }
 
 
+/*
+    This routine runs on the acceptor dispatcher for a SO_REUSEPORT listener. It accepts a batch of pending connections
+    and queues each on a new dispatcher (or the endpoint dispatcher if defined), then re-enables events on the listener.
+ */
+static void acceptOnListener(HttpEndpoint *endpoint, MprEvent *event)
+{
+    MprDispatcher   *dispatcher;
+    MprEvent        *accept;
+    MprSocket       *listen, *sock;
+    int             count, next;
+
+    if (!endpoint->listeners) {
+        return;
+    }
+    for (ITERATE_ITEMS(endpoint->listeners, listen, next)) {
+        if (listen->handler == event->handler) {
+            break;
+        }
+    }
+    if (!listen) {
+        return;
+    }
+    for (count = 0; count < HTTP_ACCEPT_BATCH && (sock = mprAcceptSocket(listen)) != 0; count++) {
+        if ((dispatcher = endpoint->dispatcher) == 0) {
+            dispatcher = mprCreateDispatcher("IO", MPR_DISPATCHER_AUTO);
+        }
+        accept = mprCreateEvent(dispatcher, "AcceptConn", 0, httpAcceptConn, endpoint, MPR_EVENT_DONT_QUEUE);
+        accept->mask = MPR_READABLE;
+        accept->sock = sock;
+        accept->handler = event->handler;
+        mprQueueEvent(dispatcher, accept);
+    }
+    if (count) {
+        mprSetEventServiceSleep(HTTP_TIMER_PERIOD);
+    }
+    if (listen->handler) {
+        mprEnableSocketEvents(listen, MPR_READABLE);
+    }
+}
+
+
 PUBLIC void httpMatchHost(HttpConn *conn)
 { 
     MprSocket       *listenSock;
@@ -7830,6 +8062,13 @@ PUBLIC int httpSetEndpointAddress(HttpEndpoint *endpoint, cchar *ip, int port)
 }
 
 
+PUBLIC void httpSetEndpointAcceptors(HttpEndpoint *endpoint, int acceptors)
+{
+    assert(endpoint);
+    endpoint->acceptors = max(acceptors, 0);
+}
+
+
 PUBLIC void httpSetEndpointAsync(HttpEndpoint *endpoint, int async)
 {
     if (endpoint->sock) {
@@ -9880,9 +10119,12 @@ PUBLIC int httpAddRemedies()
 static void addPacketForNet(HttpQueue *q, HttpPacket *packet);
 static void adjustNetVec(HttpQueue *q, ssize written);
 static MprOff buildNetVec(HttpQueue *q);
+static bool coalesceNetVec(HttpQueue *q);
 static void freeNetPackets(HttpQueue *q, ssize written);
 static void netClose(HttpQueue *q);
 static void netOutgoingService(HttpQueue *q);
+static void prependPendingOutput(HttpQueue *q);
+static ssize takePendingOutput(HttpQueue *q, ssize written);
 
 /*********************************** Code *************************************/
 /*
@@ -9918,7 +10160,7 @@ static void netOutgoingService(HttpQueue *q)
 {
     HttpConn    *conn;
     HttpTx      *tx;
-    ssize       written;
+    ssize       len, written;
     int         errCode;
 
     conn = q->conn;
@@ -9951,6 +10193,11 @@ static void netOutgoingService(HttpQueue *q)
             }
         }
         if (tx->file) {
+            /* Coalesced output from prior pipelined responses must precede this response */
+            if (!httpFlushPendingOutput(conn)) {
+                tx->writeBlocked = 1;
+                return;
+            }
             httpSendOutgoingService(q);
             return;
         }
@@ -9959,8 +10206,14 @@ static void netOutgoingService(HttpQueue *q)
     tx->writeBlocked = 0;
 
     while (q->first || q->ioIndex) {
-        if (q->ioIndex == 0 && buildNetVec(q) <= 0) {
-            break;
+        if (q->ioIndex == 0) {
+            if (buildNetVec(q) <= 0) {
+                break;
+            }
+            if (coalesceNetVec(q)) {
+                continue;
+            }
+            prependPendingOutput(q);
         }
         /*
             Issue a single I/O request to write all the blocks in the I/O vector
@@ -9987,8 +10240,10 @@ static void netOutgoingService(HttpQueue *q)
             break;
 
         } else if (written > 0) {
-            tx->bytesWritten += written;
-            freeNetPackets(q, written);
+            if ((len = written - takePendingOutput(q, written)) > 0) {
+                tx->bytesWritten += len;
+                freeNetPackets(q, len);
+            }
             adjustNetVec(q, written);
 
         } else {
@@ -10041,6 +10296,140 @@ static MprOff buildNetVec(HttpQueue *q)
 }
 
 
+/*
+    Coalesce a completed response into the connection's pending output instead of writing it now. This is done only
+    while servicing pipelined requests (conn->corked) when more request data is already buffered, so the responses to
+    a burst of pipelined requests can be written by a single vectored write. The entire remaining response must be in
+    the I/O vector and total pending output is capped at ME_MAX_COALESCE.
+ */
+static bool coalesceNetVec(HttpQueue *q)
+{
+    HttpConn    *conn;
+    HttpPacket  *packet;
+    MprOff      count;
+    int         i;
+
+    conn = q->conn;
+    if (!conn->corked || !conn->endpoint || conn->borrowed || conn->upgraded || conn->connError ||
+            conn->keepAliveCount <= 0 || !conn->input || httpGetPacketLength(conn->input) <= 0) {
+        return 0;
+    }
+    count = conn->pendingOutput ? mprGetBufLength(conn->pendingOutput) : 0;
+    if ((count + q->ioCount) > ME_MAX_COALESCE) {
+        return 0;
+    }
+    for (count = 0, packet = q->first; packet && !(packet->flags & HTTP_PACKET_END); packet = packet->next) {
+        if (packet->prefix) {
+            count += mprGetBufLength(packet->prefix);
+        }
+        count += httpGetPacketLength(packet);
+    }
+    if (!packet || count != q->ioCount) {
+        /* Response is not yet complete or did not fit in the vector */
+        return 0;
+    }
+    if (!conn->pendingOutput && (conn->pendingOutput = mprCreateBuf(ME_MAX_BUFFER, ME_MAX_COALESCE)) == 0) {
+        return 0;
+    }
+    for (i = 0; i < q->ioIndex; i++) {
+        mprPutBlockToBuf(conn->pendingOutput, q->iovec[i].start, q->iovec[i].len);
+    }
+    count = q->ioCount;
+    conn->tx->bytesWritten += count;
+    freeNetPackets(q, (ssize) count);
+    q->ioIndex = 0;
+    q->ioCount = 0;
+    return 1;
+}
+
+
+/*
+    Put coalesced output from prior pipelined responses at the front of the I/O vector so it goes out in the same write.
+    buildNetVec leaves room for this entry.
+ */
+static void prependPendingOutput(HttpQueue *q)
+{
+    MprBuf      *buf;
+    ssize       len;
+
+    buf = q->conn->pendingOutput;
+    if (!buf || (len = mprGetBufLength(buf)) == 0) {
+        return;
+    }
+    assert(q->ioIndex < ME_MAX_IOVEC);
+    memmove(&q->iovec[1], &q->iovec[0], q->ioIndex * sizeof(MprIOVec));
+    q->iovec[0].start = mprGetBufStart(buf);
+    q->iovec[0].len = len;
+    q->ioCount += len;
+    q->ioIndex++;
+}
+
+
+/*
+    Account for written bytes that belong to coalesced pending output. Pending output only ever occupies the first
+    vector entry. Return the number of pending bytes consumed.
+ */
+static ssize takePendingOutput(HttpQueue *q, ssize written)
+{
+    MprBuf      *buf;
+    ssize       len;
+
+    buf = q->conn->pendingOutput;
+    if (!buf || (len = mprGetBufLength(buf)) == 0) {
+        return 0;
+    }
+    len = min(len, written);
+    mprAdjustBufStart(buf, len);
+    if (mprGetBufLength(buf) == 0) {
+        mprFlushBuf(buf);
+    }
+    return len;
+}
+
+
+/*
+    Write coalesced pipelined output. Return true if all pending output has been written.
+ */
+PUBLIC bool httpFlushPendingOutput(HttpConn *conn)
+{
+    MprBuf      *buf;
+    ssize       written;
+    int         errCode;
+
+    buf = conn->pendingOutput;
+    if (!buf || mprGetBufLength(buf) == 0) {
+        return 1;
+    }
+    if (conn->destroyed || !conn->sock || conn->connError) {
+        mprFlushBuf(buf);
+        return 1;
+    }
+    if (conn->connectorq && conn->connectorq->ioIndex > 0) {
+        /* Pending output is already at the front of the connector I/O vector */
+        return 0;
+    }
+    while (mprGetBufLength(buf) > 0) {
+        written = mprWriteSocket(conn->sock, mprGetBufStart(buf), mprGetBufLength(buf));
+        if (written < 0) {
+            errCode = mprGetError();
+            if (errCode == EAGAIN || errCode == EWOULDBLOCK) {
+                return 0;
+            }
+            mprFlushBuf(buf);
+            httpDisconnect(conn);
+            httpTrace(conn, "connection.io.error", "error", "msg:'Connector write error', errno: %d", errCode);
+            return 1;
+        } else if (written == 0) {
+            return 0;
+        }
+        mprAdjustBufStart(buf, written);
+        conn->lastActivity = conn->http->now;
+    }
+    mprFlushBuf(buf);
+    return 1;
+}
+
+
 /*
     Add one entry to the io vector
  */
@@ -12727,7 +13116,10 @@ PUBLIC void httpRouteRequest(HttpConn *conn)
         return;
     }
     rx->route = route;
-    conn->limits = route->limits;
+    if (conn->limits != route->limits) {
+        conn->limits = route->limits;
+        httpSetConnTimer(conn);
+    }
     conn->trace = route->trace;
 
     if (rewrites >= ME_MAX_REWRITE) {
@@ -15786,7 +16178,10 @@ PUBLIC HttpRx *httpCreateRx(HttpConn *conn)
     rx->pathInfo = sclone("/");
     rx->scriptName = mprEmptyString();
     rx->needInputPipeline = httpClientConn(conn);
-    rx->headers = mprCreateHash(HTTP_SMALL_HASH_SIZE, MPR_HASH_CASELESS | MPR_HASH_STABLE);
+    /*
+        Header keys are stored in the same block as their value by parseHeaders
+     */
+    rx->headers = mprCreateHash(HTTP_SMALL_HASH_SIZE, MPR_HASH_CASELESS | MPR_HASH_STABLE | MPR_HASH_STATIC_KEYS);
     rx->chunkState = HTTP_CHUNK_UNCHUNKED;
     rx->seqno = ++conn->totalRequests;
     return rx;
@@ -16132,6 +16527,7 @@ static bool parseRequestLine(HttpConn *conn, HttpPacket *packet)
      */
     conn->startMark = mprGetHiResTicks();
     conn->started = conn->http->now;
+    httpSetConnTimer(conn);
 
     content = packet->content;
     start = content->start;
@@ -16234,6 +16630,219 @@ static bool parseResponseLine(HttpConn *conn, HttpPacket *packet)
 }
 
 
+/*
+    Well-known headers are mapped to an ID using a perfect hash of the name length and the first, middle and last
+    characters. The table is indexed by the hash and a single caseless compare confirms the match.
+ */
+typedef enum HttpHeaderId {
+    HTTP_HDR_UNKNOWN = 0,
+    HTTP_HDR_ACCEPT,
+    HTTP_HDR_ACCEPT_CHARSET,
+    HTTP_HDR_ACCEPT_ENCODING,
+    HTTP_HDR_ACCEPT_LANGUAGE,
+    HTTP_HDR_AUTHORIZATION,
+    HTTP_HDR_CONNECTION,
+    HTTP_HDR_CONTENT_LENGTH,
+    HTTP_HDR_CONTENT_RANGE,
+    HTTP_HDR_CONTENT_TYPE,
+    HTTP_HDR_COOKIE,
+    HTTP_HDR_EXPECT,
+    HTTP_HDR_HOST,
+    HTTP_HDR_IF_MATCH,
+    HTTP_HDR_IF_MODIFIED_SINCE,
+    HTTP_HDR_IF_NONE_MATCH,
+    HTTP_HDR_IF_RANGE,
+    HTTP_HDR_IF_UNMODIFIED_SINCE,
+    HTTP_HDR_KEEP_ALIVE,
+    HTTP_HDR_LOCATION,
+    HTTP_HDR_ORIGIN,
+    HTTP_HDR_PRAGMA,
+    HTTP_HDR_RANGE,
+    HTTP_HDR_REFERER,
+    HTTP_HDR_TRANSFER_ENCODING,
+    HTTP_HDR_UPGRADE,
+    HTTP_HDR_USER_AGENT,
+    HTTP_HDR_WWW_AUTHENTICATE,
+    HTTP_HDR_X_CHUNK_SIZE,
+    HTTP_HDR_X_HTTP_METHOD_OVERRIDE,
+    HTTP_HDR_X_OWN_PARAMS,
+} HttpHeaderId;
+
+typedef struct HttpHeaderName {
+    cchar       *name;
+    int         id;
+} HttpHeaderName;
+
+#define HTTP_HDR_HASH_SIZE 64
+
+static HttpHeaderName headerNames[HTTP_HDR_HASH_SIZE] = {
+    { 0, 0 },
+    { 0, 0 },
+    { "connection", HTTP_HDR_CONNECTION },
+    { "pragma", HTTP_HDR_PRAGMA },
+    { "accept-language", HTTP_HDR_ACCEPT_LANGUAGE },
+    { 0, 0 },
+    { "origin", HTTP_HDR_ORIGIN },
+    { 0, 0 },
+    { 0, 0 },
+    { "accept-encoding", HTTP_HDR_ACCEPT_ENCODING },
+    { "if-range", HTTP_HDR_IF_RANGE },
+    { "x-http-method-override", HTTP_HDR_X_HTTP_METHOD_OVERRIDE },
+    { 0, 0 },
+    { 0, 0 },
+    { "accept", HTTP_HDR_ACCEPT },
+    { 0, 0 },
+    { "cookie", HTTP_HDR_COOKIE },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { "accept-charset", HTTP_HDR_ACCEPT_CHARSET },
+    { 0, 0 },
+    { "x-own-params", HTTP_HDR_X_OWN_PARAMS },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { "if-unmodified-since", HTTP_HDR_IF_UNMODIFIED_SINCE },
+    { "if-modified-since", HTTP_HDR_IF_MODIFIED_SINCE },
+    { "if-match", HTTP_HDR_IF_MATCH },
+    { 0, 0 },
+    { "upgrade", HTTP_HDR_UPGRADE },
+    { "content-type", HTTP_HDR_CONTENT_TYPE },
+    { "content-range", HTTP_HDR_CONTENT_RANGE },
+    { 0, 0 },
+    { "keep-alive", HTTP_HDR_KEEP_ALIVE },
+    { 0, 0 },
+    { "transfer-encoding", HTTP_HDR_TRANSFER_ENCODING },
+    { "if-none-match", HTTP_HDR_IF_NONE_MATCH },
+    { 0, 0 },
+    { "host", HTTP_HDR_HOST },
+    { 0, 0 },
+    { 0, 0 },
+    { "user-agent", HTTP_HDR_USER_AGENT },
+    { 0, 0 },
+    { "content-length", HTTP_HDR_CONTENT_LENGTH },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { "www-authenticate", HTTP_HDR_WWW_AUTHENTICATE },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { "location", HTTP_HDR_LOCATION },
+    { "authorization", HTTP_HDR_AUTHORIZATION },
+    { 0, 0 },
+    { "range", HTTP_HDR_RANGE },
+    { 0, 0 },
+    { 0, 0 },
+    { "expect", HTTP_HDR_EXPECT },
+    { 0, 0 },
+    { 0, 0 },
+    { "x-chunk-size", HTTP_HDR_X_CHUNK_SIZE },
+    { "referer", HTTP_HDR_REFERER },
+    { 0, 0 },
+};
+
+
+static int lookupHeader(cchar *key, ssize len)
+{
+    HttpHeaderName  *hp;
+    uint            index;
+
+    if (len < 4) {
+        return HTTP_HDR_UNKNOWN;
+    }
+    index = (uint) (len + tolower((uchar) key[0]) * 11 + tolower((uchar) key[len - 1]) * 6 + 
+        tolower((uchar) key[len / 2])) & (HTTP_HDR_HASH_SIZE - 1);
+    hp = &headerNames[index];
+    if (hp->name && scaselessmatch(key, hp->name)) {
+        return hp->id;
+    }
+    return HTTP_HDR_UNKNOWN;
+}
+
+
+/*
+    Get the next header line from the packet. The line end and key delimiter are located with memchr which is 
+    vectorized by most C libraries. The key and value are null terminated in place and leading white space is skipped.
+    Return false if the line is not a valid header.
+ */
+static bool getHeaderLine(MprBuf *content, char **keyp, ssize *keyLen, char **valuep, ssize *valueLen)
+{
+    char    *start, *end, *eol, *colon, *key, *value;
+
+    start = mprGetBufStart(content);
+    end = mprGetBufEnd(content);
+    for (eol = start; (eol = memchr(eol, '\n', end - eol)) != 0; eol++) {
+        if (eol > start && eol[-1] == '\r') {
+            break;
+        }
+    }
+    if (eol == 0) {
+        return 0;
+    }
+    content->start = eol + 1;
+    *--eol = '\0';
+
+    for (key = start; *key == ' ' || *key == '\t'; key++) {}
+    if ((colon = memchr(key, ':', eol - key)) == 0 || colon == key) {
+        return 0;
+    }
+    *colon = '\0';
+    for (value = colon + 1; isspace((uchar) *value); value++) {}
+
+    *keyp = key;
+    *keyLen = colon - key;
+    *valuep = value;
+    *valueLen = eol - value;
+    return 1;
+}
+
+
+/*
+    Add a header to the rx headers hash. The value and key are copied into a single block with the value first. 
+    The value can then be returned by httpGetHeader and retained by callers while the key is kept alive by the value.
+    Repeated headers are combined into a comma separated list in the headers hash only. Returns this occurrence's value
+    which is the stored value for the first occurrence and a separate copy for repeated headers.
+ */
+static char *addHeader(HttpRx *rx, cchar *key, ssize keyLen, cchar *value, ssize valueLen)
+{
+    MprKey      *kp;
+    char        *block, *bkey;
+    ssize       oldLen, len;
+
+    if ((kp = mprLookupKeyEntry(rx->headers, key)) != 0) {
+        /* Retain the case of the first occurrence of the key */
+        key = kp->key;
+        keyLen = slen(key);
+    }
+    oldLen = kp ? slen(kp->data) + 2 : 0;
+    len = oldLen + valueLen;
+    if ((block = mprAlloc(len + keyLen + 2)) == 0) {
+        return 0;
+    }
+    if (kp) {
+        memcpy(block, kp->data, oldLen - 2);
+        memcpy(&block[oldLen - 2], ", ", 2);
+    }
+    memcpy(&block[oldLen], value, valueLen);
+    block[len] = '\0';
+    bkey = &block[len + 1];
+    memcpy(bkey, key, keyLen);
+    bkey[keyLen] = '\0';
+
+    if (kp) {
+        /* Replace the key as well as it refers to the prior value block */
+        kp->key = bkey;
+        kp->data = block;
+        return snclone(value, valueLen);
+    }
+    if (mprAddKey(rx->headers, bkey, block) == 0) {
+        return 0;
+    }
+    return block;
+}
+
+
 /*
     Parse the request headers. Return true if the header parsed.
  */
@@ -16244,7 +16853,7 @@ static bool parseHeaders(HttpConn *conn, HttpPacket *packet)
     HttpLimits  *limits;
     MprBuf      *content;
     char        *cp, *key, *value, *tok, *hvalue;
-    cchar       *oldValue;
+    ssize       keyLen, valueLen;
     int         count, keepAliveHeader;
 
     rx = conn->rx;
@@ -16259,75 +16868,76 @@ static bool parseHeaders(HttpConn *conn, HttpPacket *packet)
             httpLimitError(conn, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Too many headers");
             return 0;
         }
-        if ((key = getToken(conn, ":")) == 0 || *key == '\0') {
+        if (!getHeaderLine(content, &key, &keyLen, &value, &valueLen)) {
             httpBadRequestError(conn, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad header format");
             return 0;
         }
-        value = getToken(conn, "\r\n");
-        while (isspace((uchar) *value)) {
-            value++;
-        }
         if (strspn(key, "%<>/\\") > 0) {
             httpBadRequestError(conn, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad header key value");
             return 0;
         }
-        if ((oldValue = mprLookupKey(rx->headers, key)) != 0) {
-            hvalue = sfmt("%s, %s", oldValue, value);
-        } else {
-            hvalue = sclone(value);
+        /*
+            The value is copied once. Well-known header fields refer to the stored header value, or to a copy of this
+            occurrence if the header is repeated.
+         */
+        if ((hvalue = addHeader(rx, key, keyLen, value, valueLen)) == 0) {
+            httpMemoryError(conn);
+            return 0;
         }
-        mprAddKey(rx->headers, key, hvalue);
-
-        switch (tolower((uchar) key[0])) {
-        case 'a':
-            if (strcasecmp(key, "authorization") == 0) {
-                value = sclone(value);
-                conn->authType = slower(stok(value, " \t", &tok));
-                rx->authDetails = sclone(tok);
+        switch (lookupHeader(key, keyLen)) {
+        case HTTP_HDR_AUTHORIZATION:
+            value = sclone(value);
+            conn->authType = slower(stok(value, " \t", &tok));
+            rx->authDetails = sclone(tok);
+            break;
 
-            } else if (strcasecmp(key, "accept-charset") == 0) {
-                rx->acceptCharset = sclone(value);
+        case HTTP_HDR_ACCEPT_CHARSET:
+            rx->acceptCharset = hvalue;
+            break;
 
-            } else if (strcasecmp(key, "accept") == 0) {
-                rx->accept = sclone(value);
+        case HTTP_HDR_ACCEPT:
+            rx->accept = hvalue;
+            break;
 
-            } else if (strcasecmp(key, "accept-encoding") == 0) {
-                rx->acceptEncoding = sclone(value);
+        case HTTP_HDR_ACCEPT_ENCODING:
+            rx->acceptEncoding = hvalue;
+            break;
 
-            } else if (strcasecmp(key, "accept-language") == 0) {
-                rx->acceptLanguage = sclone(value);
-            }
+        case HTTP_HDR_ACCEPT_LANGUAGE:
+            rx->acceptLanguage = hvalue;
             break;
 
-        case 'c':
-            if (strcasecmp(key, "connection") == 0) {
-                rx->connection = sclone(value);
-                if (scaselesscmp(value, "KEEP-ALIVE") == 0) {
-                    keepAliveHeader = 1;
+        case HTTP_HDR_CONNECTION:
+            rx->connection = hvalue;
+            if (scaselesscmp(value, "KEEP-ALIVE") == 0) {
+                keepAliveHeader = 1;
 
-                } else if (scaselesscmp(value, "CLOSE") == 0) {
-                    conn->keepAliveCount = 0;
-                    conn->mustClose = 1;
-                }
+            } else if (scaselesscmp(value, "CLOSE") == 0) {
+                conn->keepAliveCount = 0;
+                conn->mustClose = 1;
+            }
+            break;
 
-            } else if (strcasecmp(key, "content-length") == 0) {
-                if (rx->length >= 0) {
-                    httpBadRequestError(conn, HTTP_CLOSE | HTTP_CODE_BAD_REQUEST, "Mulitple content length headers");
-                    break;
-                }
-                rx->length = stoi(value);
-                if (rx->length < 0) {
-                    httpBadRequestError(conn, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad content length");
-                    return 0;
-                }
-                rx->contentLength = sclone(value);
-                assert(rx->length >= 0);
-                if (httpServerConn(conn) || !scaselessmatch(tx->method, "HEAD")) {
-                    rx->remainingContent = rx->length;
-                    rx->needInputPipeline = 1;
-                }
+        case HTTP_HDR_CONTENT_LENGTH:
+            if (rx->length >= 0) {
+                httpBadRequestError(conn, HTTP_CLOSE | HTTP_CODE_BAD_REQUEST, "Mulitple content length headers");
+                break;
+            }
+            rx->length = stoi(value);
+            if (rx->length < 0) {
+                httpBadRequestError(conn, HTTP_ABORT | HTTP_CODE_BAD_REQUEST, "Bad content length");
+                return 0;
+            }
+            rx->contentLength = hvalue;
+            assert(rx->length >= 0);
+            if (httpServerConn(conn) || !scaselessmatch(tx->method, "HEAD")) {
+                rx->remainingContent = rx->length;
+                rx->needInputPipeline = 1;
+            }
+            break;
 
-            } else if (strcasecmp(key, "content-range") == 0) {
+        case HTTP_HDR_CONTENT_RANGE:
+            {
                 /*
                     The Content-Range header is used in the response. The Range header is used in the request.
                     This headers specifies the range of any posted body data
@@ -16360,53 +16970,54 @@ static bool parseHeaders(HttpConn *conn, HttpPacket *packet)
                     break;
                 }
                 rx->inputRange = httpCreateRange(conn, start, end);
+            }
+            break;
 
-            } else if (strcasecmp(key, "content-type") == 0) {
-                rx->mimeType = sclone(value);
-                if (rx->flags & (HTTP_POST | HTTP_PUT)) {
-                    if (httpServerConn(conn)) {
-                        rx->form = scontains(rx->mimeType, "application/x-www-form-urlencoded") != 0;
-                        rx->upload = scontains(rx->mimeType, "multipart/form-data") != 0;
-                    }
-                } else {
-                    rx->form = rx->upload = 0;
-                }
-            } else if (strcasecmp(key, "cookie") == 0) {
-                if (rx->cookie && *rx->cookie) {
-                    rx->cookie = sjoin(rx->cookie, "; ", value, NULL);
-                } else {
-                    rx->cookie = sclone(value);
+        case HTTP_HDR_CONTENT_TYPE:
+            rx->mimeType = hvalue;
+            if (rx->flags & (HTTP_POST | HTTP_PUT)) {
+                if (httpServerConn(conn)) {
+                    rx->form = scontains(rx->mimeType, "application/x-www-form-urlencoded") != 0;
+                    rx->upload = scontains(rx->mimeType, "multipart/form-data") != 0;
                 }
+            } else {
+                rx->form = rx->upload = 0;
             }
             break;
 
-        case 'e':
-            if (strcasecmp(key, "expect") == 0) {
-                /*
-                    Handle 100-continue for HTTP/1.1 clients only. This is the only expectation that is currently supported.
-                 */
-                if (!conn->http10) {
-                    if (strcasecmp(value, "100-continue") != 0) {
-                        httpBadRequestError(conn, HTTP_CODE_EXPECTATION_FAILED, "Expect header value is not supported");
-                    } else {
-                        rx->flags |= HTTP_EXPECT_CONTINUE;
-                    }
-                }
+        case HTTP_HDR_COOKIE:
+            if (rx->cookie && *rx->cookie) {
+                rx->cookie = sjoin(rx->cookie, "; ", value, NULL);
+            } else {
+                rx->cookie = hvalue;
             }
             break;
 
-        case 'h':
-            if (strcasecmp(key, "host") == 0) {
-                rx->hostHeader = sclone(value);
+        case HTTP_HDR_EXPECT:
+            /*
+                Handle 100-continue for HTTP/1.1 clients only. This is the only expectation that is currently supported.
+             */
+            if (!conn->http10) {
+                if (strcasecmp(value, "100-continue") != 0) {
+                    httpBadRequestError(conn, HTTP_CODE_EXPECTATION_FAILED, "Expect header value is not supported");
+                } else {
+                    rx->flags |= HTTP_EXPECT_CONTINUE;
+                }
             }
             break;
 
-        case 'i':
-            if ((strcasecmp(key, "if-modified-since") == 0) || (strcasecmp(key, "if-unmodified-since") == 0)) {
+        case HTTP_HDR_HOST:
+            rx->hostHeader = hvalue;
+            break;
+
+        case HTTP_HDR_IF_MODIFIED_SINCE:
+        case HTTP_HDR_IF_UNMODIFIED_SINCE:
+            {
                 MprTime     newDate = 0;
                 char        *cp;
                 bool        ifModified = (tolower((uchar) key[3]) == 'm');
 
+                /* Value is the packet copy and may be modified. The stored header value is unchanged. */
                 if ((cp = strchr(value, ';')) != 0) {
                     *cp = '\0';
                 }
@@ -16419,8 +17030,12 @@ static bool parseHeaders(HttpConn *conn, HttpPacket *packet)
                     rx->ifModified = ifModified;
                     rx->flags |= HTTP_IF_MODIFIED;
                 }
+            }
+            break;
 
-            } else if ((strcasecmp(key, "if-match") == 0) || (strcasecmp(key, "if-none-match") == 0)) {
+        case HTTP_HDR_IF_MATCH:
+        case HTTP_HDR_IF_NONE_MATCH:
+            {
                 char    *word, *tok;
                 bool    ifMatch = (tolower((uchar) key[3]) == 'm');
 
@@ -16435,8 +17050,11 @@ static bool parseHeaders(HttpConn *conn, HttpPacket *packet)
                     addMatchEtag(conn, word);
                     word = stok(0, " ,", &tok);
                 }
+            }
+            break;
 
-            } else if (strcasecmp(key, "if-range") == 0) {
+        case HTTP_HDR_IF_RANGE:
+            {
                 char    *word, *tok;
                 if ((tok = strchr(value, ';')) != 0) {
                     *tok = '\0';
@@ -16452,115 +17070,104 @@ static bool parseHeaders(HttpConn *conn, HttpPacket *packet)
             }
             break;
 
-        case 'k':
+        case HTTP_HDR_KEEP_ALIVE:
             /* Keep-Alive: timeout=N, max=1 */
-            if (strcasecmp(key, "keep-alive") == 0) {
-                if ((tok = scontains(value, "max=")) != 0) {
-                    conn->keepAliveCount = atoi(&tok[4]);
-                    if (conn->keepAliveCount < 0) {
-                        conn->keepAliveCount = 0;
-                    }
-                    if (conn->keepAliveCount > ME_MAX_KEEP_ALIVE) {
-                        conn->keepAliveCount = ME_MAX_KEEP_ALIVE;
-                    }
-                    /*
-                        IMPORTANT: Deliberately close client connections one request early. This encourages a client-led
-                        termination and may help relieve excessive server-side TIME_WAIT conditions.
-                     */
-                    if (httpClientConn(conn) && conn->keepAliveCount == 1) {
-                        conn->keepAliveCount = 0;
-                    }
+            if ((tok = scontains(value, "max=")) != 0) {
+                conn->keepAliveCount = atoi(&tok[4]);
+                if (conn->keepAliveCount < 0) {
+                    conn->keepAliveCount = 0;
+                }
+                if (conn->keepAliveCount > ME_MAX_KEEP_ALIVE) {
+                    conn->keepAliveCount = ME_MAX_KEEP_ALIVE;
+                }
+                /*
+                    IMPORTANT: Deliberately close client connections one request early. This encourages a client-led
+                    termination and may help relieve excessive server-side TIME_WAIT conditions.
+                 */
+                if (httpClientConn(conn) && conn->keepAliveCount == 1) {
+                    conn->keepAliveCount = 0;
                 }
             }
             break;
 
-        case 'l':
-            if (strcasecmp(key, "location") == 0) {
-                rx->redirect = sclone(value);
-            }
+        case HTTP_HDR_LOCATION:
+            rx->redirect = hvalue;
             break;
 
-        case 'o':
-            if (strcasecmp(key, "origin") == 0) {
-                rx->origin = sclone(value);
-            }
+        case HTTP_HDR_ORIGIN:
+            rx->origin = hvalue;
             break;
 
-        case 'p':
-            if (strcasecmp(key, "pragma") == 0) {
-                rx->pragma = sclone(value);
+        case HTTP_HDR_PRAGMA:
+            rx->pragma = hvalue;
+            break;
+
+        case HTTP_HDR_RANGE:
+            /*
+                The Content-Range header is used in the response. The Range header is used in the request.
+             */
+            if (!parseRange(conn, value)) {
+                httpBadRequestError(conn, HTTP_CLOSE | HTTP_CODE_RANGE_NOT_SATISFIABLE, "Bad range");
             }
             break;
 
-        case 'r':
-            if (strcasecmp(key, "range") == 0) {
+        case HTTP_HDR_REFERER:
+            /* NOTE: yes the header is misspelt in the spec */
+            rx->referrer = hvalue;
+            break;
+
+        case HTTP_HDR_TRANSFER_ENCODING:
+            if (scaselesscmp(value, "chunked") == 0 && !conn->http10) {
                 /*
-                    The Content-Range header is used in the response. The Range header is used in the request.
+                    remainingContent will be revised by the chunk filter as chunks are processed and will
+                    be set to zero when the last chunk has been received.
                  */
-                if (!parseRange(conn, value)) {
-                    httpBadRequestError(conn, HTTP_CLOSE | HTTP_CODE_RANGE_NOT_SATISFIABLE, "Bad range");
-                }
-            } else if (strcasecmp(key, "referer") == 0) {
-                /* NOTE: yes the header is misspelt in the spec */
-                rx->referrer = sclone(value);
+                rx->flags |= HTTP_CHUNKED;
+                rx->chunkState = HTTP_CHUNK_START;
+                rx->remainingContent = MAXINT;
+                rx->needInputPipeline = 1;
             }
             break;
 
-        case 't':
-            if (strcasecmp(key, "transfer-encoding") == 0) {
-                if (scaselesscmp(value, "chunked") == 0 && !conn->http10) {
-                    /*
-                        remainingContent will be revised by the chunk filter as chunks are processed and will
-                        be set to zero when the last chunk has been received.
-                     */
-                    rx->flags |= HTTP_CHUNKED;
-                    rx->chunkState = HTTP_CHUNK_START;
-                    rx->remainingContent = MAXINT;
-                    rx->needInputPipeline = 1;
-                }
-            }
+        case HTTP_HDR_X_HTTP_METHOD_OVERRIDE:
+            httpSetMethod(conn, value);
             break;
 
-        case 'x':
-            if (strcasecmp(key, "x-http-method-override") == 0) {
-                httpSetMethod(conn, value);
+        case HTTP_HDR_X_OWN_PARAMS:
+            /*
+                Optimize and don't convert query and body content into params.
+                This is for those who want very large forms and to do their own custom handling.
+             */
+            rx->ownParams = 1;
+            break;
 
-            } else if (strcasecmp(key, "x-own-params") == 0) {
-                /*
-                    Optimize and don't convert query and body content into params.
-                    This is for those who want very large forms and to do their own custom handling.
-                 */
-                rx->ownParams = 1;
 #if ME_DEBUG
-            } else if (strcasecmp(key, "x-chunk-size") == 0) {
-                tx->chunkSize = atoi(value);
-                if (tx->chunkSize <= 0) {
-                    tx->chunkSize = 0;
-                } else if (tx->chunkSize > conn->limits->chunkSize) {
-                    tx->chunkSize = conn->limits->chunkSize;
-                }
-#endif
+        case HTTP_HDR_X_CHUNK_SIZE:
+            tx->chunkSize = atoi(value);
+            if (tx->chunkSize <= 0) {
+                tx->chunkSize = 0;
+            } else if (tx->chunkSize > conn->limits->chunkSize) {
+                tx->chunkSize = conn->limits->chunkSize;
             }
             break;
+#endif
 
-        case 'u':
-            if (scaselesscmp(key, "upgrade") == 0) {
-                rx->upgrade = sclone(value);
-            } else if (strcasecmp(key, "user-agent") == 0) {
-                rx->userAgent = sclone(value);
-            }
+        case HTTP_HDR_UPGRADE:
+            rx->upgrade = hvalue;
             break;
 
-        case 'w':
-            if (strcasecmp(key, "www-authenticate") == 0) {
-                cp = value;
-                while (*value && !isspace((uchar) *value)) {
-                    value++;
-                }
-                *value++ = '\0';
-                conn->authType = slower(cp);
-                rx->authDetails = sclone(value);
+        case HTTP_HDR_USER_AGENT:
+            rx->userAgent = hvalue;
+            break;
+
+        case HTTP_HDR_WWW_AUTHENTICATE:
+            cp = value;
+            while (*value && !isspace((uchar) *value)) {
+                value++;
             }
+            *value++ = '\0';
+            conn->authType = slower(cp);
+            rx->authDetails = sclone(value);
             break;
         }
     }
@@ -17162,7 +17769,7 @@ PUBLIC cchar *httpGetHeader(HttpConn *conn, cchar *key)
         assert(conn->rx);
         return 0;
     }
-    return mprLookupKey(conn->rx->headers, slower(key));
+    return mprLookupKey(conn->rx->headers, key);
 }
 
 
@@ -20436,6 +21043,8 @@ typedef struct Upload {
     MprFile         *file;              /* Current file I/O object */
     char            *boundary;          /* Boundary signature */
     ssize           boundaryLen;        /* Length of boundary */
+    ssize           skip[256];          /* Boyer-Moore-Horspool skip table for the boundary */
+    char            *window;            /* Scratch buffer to test for boundaries spanning packets */
     int             contentState;       /* Input states */
     char            *clientFilename;    /* Current file filename */
     char            *tmpPath;           /* Current temp filename for upload data */
@@ -20445,7 +21054,7 @@ typedef struct Upload {
 /********************************** Forwards **********************************/
 
 static void closeUpload(HttpQueue *q);
-static char *getBoundary(char *buf, ssize bufLen, char *boundary, ssize boundaryLen, bool *pureData);
+static char *getBoundary(Upload *up, char *buf, ssize bufLen);
 static void incomingUpload(HttpQueue *q, HttpPacket *packet);
 static void manageHttpUploadFile(HttpUploadFile *file, int flags);
 static void manageUpload(Upload *up, int flags);
@@ -20454,6 +21063,8 @@ static int openUpload(HttpQueue *q);
 static int  processUploadBoundary(HttpQueue *q, char *line);
 static int  processUploadHeader(HttpQueue *q, char *line);
 static int  processUploadData(HttpQueue *q);
+static int  writeUploadResidue(HttpQueue *q, HttpPacket *packet);
+static int  writeToFile(HttpQueue *q, char *data, ssize len);
 
 /************************************* Code ***********************************/
 
@@ -20524,6 +21135,7 @@ static int openUpload(HttpQueue *q)
     Upload      *up;
     cchar       *uploadDir;
     char        *boundary;
+    ssize       i, last;
 
     conn = q->conn;
     rx = conn->rx;
@@ -20547,6 +21159,16 @@ static int openUpload(HttpQueue *q)
         httpError(conn, HTTP_CODE_BAD_REQUEST, "Bad boundary");
         return MPR_ERR_BAD_ARGS;
     }
+    last = up->boundaryLen - 1;
+    for (i = 0; i < 256; i++) {
+        up->skip[i] = up->boundaryLen;
+    }
+    for (i = 0; i < last; i++) {
+        up->skip[(uchar) up->boundary[i]] = last - i;
+    }
+    if ((up->window = mprAlloc(up->boundaryLen * 2 + 2)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
     return 0;
 }
 
@@ -20557,6 +21179,7 @@ static void manageUpload(Upload *up, int flags)
         mprMark(up->currentFile);
         mprMark(up->file);
         mprMark(up->boundary);
+        mprMark(up->window);
         mprMark(up->clientFilename);
         mprMark(up->tmpPath);
         mprMark(up->name);
@@ -20617,8 +21240,12 @@ static void incomingUpload(HttpQueue *q, HttpPacket *packet)
     }
     /*
         Put the packet data onto the service queue for buffering. This aggregates input data incase we don't have
-        a complete mime record yet.
+        a complete mime record yet. While streaming file data, the residue from the last packet is written first if
+        possible so the new packet can be parsed in place without being copied.
      */
+    if (up->contentState == HTTP_UPLOAD_CONTENT_DATA && up->clientFilename && writeUploadResidue(q, packet) < 0) {
+        return;
+    }
     httpJoinPacketForService(q, packet, 0);
 
     packet = q->first;
@@ -20654,11 +21281,8 @@ static void incomingUpload(HttpQueue *q, HttpPacket *packet)
 
         case HTTP_UPLOAD_CONTENT_DATA:
             rc = processUploadData(q);
-            if (rc < 0) {
-                done++;
-            }
-            if (httpGetPacketLength(packet) < up->boundaryLen) {
-                /*  Incomplete boundary - return to get more data */
+            if (rc < 0 || up->contentState == HTTP_UPLOAD_CONTENT_DATA) {
+                /*  Error or no boundary yet - return to get more data */
                 done++;
             }
             break;
@@ -20911,7 +21535,6 @@ static int processUploadData(HttpQueue *q)
     MprBuf          *content;
     Upload          *up;
     ssize           size, dataLen;
-    bool            pureData;
     char            *data, *bp, *key;
 
     conn = q->conn;
@@ -20924,22 +21547,36 @@ static int processUploadData(HttpQueue *q)
         /*  Incomplete boundary. Return and get more data */
         return 0;
     }
-    bp = getBoundary(mprGetBufStart(content), size, up->boundary, up->boundaryLen, &pureData);
+    bp = getBoundary(up, mprGetBufStart(content), size);
+    if (!up->clientFilename) {
+        /*
+            Form fields are buffered until the boundary is seen. Bound them by the form size limit rather than
+            the much larger upload limit.
+         */
+        dataLen = (bp) ? (bp - mprGetBufStart(content)) : size;
+        if (dataLen >= conn->limits->receiveFormSize) {
+            httpLimitError(conn, HTTP_CLOSE | HTTP_CODE_REQUEST_TOO_LARGE,
+                "Upload form field of %'lld bytes is too big. Limit %'lld", (int64) dataLen,
+                conn->limits->receiveFormSize);
+            return MPR_ERR_WONT_FIT;
+        }
+    }
     if (bp == 0) {
         if (up->clientFilename) {
             /*
-                No signature found yet. probably more data to come. Must handle split boundaries.
+                No signature found yet. probably more data to come. Must handle split boundaries, so retain enough
+                data for a partial boundary and the CRLF that precedes it.
              */
-            data = mprGetBufStart(content);
-            dataLen = pureData ? size : (size - (up->boundaryLen - 1));
+            dataLen = size - (up->boundaryLen + 1);
             if (dataLen > 0) {
                 if (writeToFile(q, mprGetBufStart(content), dataLen) < 0) {
                     return MPR_ERR_CANT_WRITE;
                 }
+                mprAdjustBufStart(content, dataLen);
             }
-            mprAdjustBufStart(content, dataLen);
-            return 0;       /* Get more data */
         }
+        /* Get more data. Form fields are parsed once the whole value has been received. */
+        return 0;
     }
     data = mprGetBufStart(content);
     dataLen = (bp) ? (bp - data) : mprGetBufLength(content);
@@ -21005,36 +21642,64 @@ static int processUploadData(HttpQueue *q)
 
 
 /*
-    Find the boundary signature in memory. Returns pointer to the first match.
+    The residue is the data retained from the prior packet in case it holds the start of a boundary. If no boundary
+    (with its preceding CRLF) starts in the residue, the residue is file data. Write it and remove it from the queue
+    so the new packet can be queued and parsed without being joined (copied) onto the residue.
+    Returns < 0 on errors, 1 if the residue was written and 0 if the packet must be joined.
  */
-static char *getBoundary(char *buf, ssize bufLen, char *boundary, ssize boundaryLen, bool *pureData)
+static int writeUploadResidue(HttpQueue *q, HttpPacket *packet)
 {
-    char    *cp, *endp;
-    char    first;
+    HttpPacket  *first;
+    Upload      *up;
+    char        *bp;
+    ssize       len, plen;
+
+    up = q->queueData;
+    first = q->first;
+    if (!first || first->next || (first->flags & HTTP_PACKET_HEADER) || !first->content) {
+        return 0;
+    }
+    len = httpGetPacketLength(first);
+    plen = up->boundaryLen + 1;
+    if (len > plen || httpGetPacketLength(packet) < plen) {
+        return 0;
+    }
+    memcpy(up->window, mprGetBufStart(first->content), len);
+    memcpy(&up->window[len], mprGetBufStart(packet->content), plen);
+    if ((bp = getBoundary(up, up->window, len + plen)) != 0 && (bp - up->window) < (len + 2)) {
+        return 0;
+    }
+    if (len > 0 && writeToFile(q, mprGetBufStart(first->content), len) < 0) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    httpGetPacket(q);
+    return 1;
+}
+
+
+/*
+    Find the boundary signature in memory using a Boyer-Moore-Horspool search. Returns pointer to the first match.
+ */
+static char *getBoundary(Upload *up, char *buf, ssize bufLen)
+{
+    uchar   *cp, *endp, *boundary;
+    ssize   last;
 
     assert(buf);
-    assert(boundary);
-    assert(boundaryLen > 0);
+    assert(up->boundaryLen > 0);
 
-    first = *boundary & 0xff;
-    endp = &buf[bufLen];
+    if (bufLen < up->boundaryLen) {
+        return 0;
+    }
+    boundary = (uchar*) up->boundary;
+    last = up->boundaryLen - 1;
+    endp = (uchar*) &buf[bufLen - last];
 
-    for (cp = buf; cp < endp; cp++) {
-        if ((cp = memchr(cp, first, endp - cp)) == 0) {
-            *pureData = 1;
-            return 0;
-        }
-        /* Potential boundary */
-        if ((endp - cp) < boundaryLen) {
-            *pureData = 0;
-            return 0;
-        }
-        if (memcmp(cp, boundary, boundaryLen) == 0) {
-            *pureData = 0;
-            return cp;
+    for (cp = (uchar*) buf; cp < endp; cp += up->skip[cp[last]]) {
+        if (cp[last] == boundary[last] && memcmp(cp, boundary, last) == 0) {
+            return (char*) cp;
         }
     }
-    *pureData = 0;
     return 0;
 }
 
@@ -22749,6 +23414,7 @@ static const uchar utfTable[] = {
 static void closeWebSock(HttpQueue *q);
 static void incomingWebSockData(HttpQueue *q, HttpPacket *packet);
 static void manageWebSocket(HttpWebSocket *ws, int flags);
+static int maskWebSockData(char *data, ssize len, cuchar *mask, int offset);
 static int matchWebSock(HttpConn *conn, HttpRoute *route, int dir);
 static int openWebSock(HttpQueue *q);
 static void outgoingWebSockService(HttpQueue *q);
@@ -22756,6 +23422,7 @@ static int processFrame(HttpQueue *q, HttpPacket *packet);
 static void readyWebSock(HttpQueue *q);
 static int validUTF8(HttpConn *conn, cchar *str, ssize len);
 static bool validateText(HttpConn *conn, HttpPacket *packet);
+static void webSockFlush(HttpConn *conn, MprEvent *event);
 static void webSockPing(HttpConn *conn);
 static void webSockTimeout(HttpConn *conn);
 
@@ -22932,6 +23599,7 @@ static void manageWebSocket(HttpWebSocket *ws, int flags)
         mprMark(ws->currentMessage);
         mprMark(ws->tailMessage);
         mprMark(ws->pingEvent);
+        mprMark(ws->flushEvent);
         mprMark(ws->subProtocol);
         mprMark(ws->errorMsg);
         mprMark(ws->closeReason);
@@ -22953,6 +23621,10 @@ static void closeWebSock(HttpQueue *q)
                 mprRemoveEvent(ws->pingEvent);
                 ws->pingEvent = 0;
            }
+           if (ws->flushEvent) {
+                mprRemoveEvent(ws->flushEvent);
+                ws->flushEvent = 0;
+           }
         }
     }
 }
@@ -22973,7 +23645,7 @@ static void incomingWebSockData(HttpQueue *q, HttpPacket *packet)
     HttpPacket      *tail;
     HttpLimits      *limits;
     MprBuf          *content;
-    char            *fp, *cp;
+    char            *fp;
     ssize           len, currentFrameLen, offset, frameLen;
     int             i, error, mask, lenBytes, opcode;
 
@@ -23125,9 +23797,7 @@ static void incomingWebSockData(HttpQueue *q, HttpPacket *packet)
                 break;
             }
             if (ws->maskOffset >= 0) {
-                for (cp = content->start; cp < content->end; cp++) {
-                    *cp = *cp ^ ws->dataMask[ws->maskOffset++ & 0x3];
-                }
+                ws->maskOffset = maskWebSockData(content->start, len, ws->dataMask, ws->maskOffset);
             }
             if (packet->type == WS_MSG_CONT && ws->currentFrame) {
                 httpJoinPacket(ws->currentFrame, packet);
@@ -23376,6 +24046,7 @@ PUBLIC ssize httpSendBlock(HttpConn *conn, int type, cchar *buf, ssize len, int
     HttpPacket      *packet;
     HttpQueue       *q;
     ssize           room, thisWrite, totalWritten;
+    int             control;
 
     assert(conn);
 
@@ -23395,6 +24066,7 @@ PUBLIC ssize httpSendBlock(HttpConn *conn, int type, cchar *buf, ssize len, int
         return MPR_ERR_BAD_ARGS;
     }
     q = conn->writeq;
+    control = type & WS_MSG_CONTROL;
     if (flags == 0) {
         flags = HTTP_BUFFER;
     }
@@ -23468,7 +24140,17 @@ PUBLIC ssize httpSendBlock(HttpConn *conn, int type, cchar *buf, ssize len, int
         }
     } while (len > 0);
 
-    httpFlushQueue(q, flags);
+    if ((flags & HTTP_BUFFER) && httpServerConn(conn) && conn->dispatcher && !control) {
+        /*
+            Defer writing buffered data messages until the current callback returns. Messages sent together are then
+            framed and written to the socket by the net connector in a single writev.
+         */
+        if (!ws->flushEvent) {
+            ws->flushEvent = mprCreateEvent(conn->dispatcher, "webSocketFlush", 0, webSockFlush, conn, 0);
+        }
+    } else {
+        httpFlushQueue(q, flags);
+    }
     if (httpClientConn(conn)) {
         httpEnableConnEvents(conn);
     }
@@ -23476,6 +24158,60 @@ PUBLIC ssize httpSendBlock(HttpConn *conn, int type, cchar *buf, ssize len, int
 }
 
 
+/*
+    Write messages buffered by httpSendBlock
+ */
+static void webSockFlush(HttpConn *conn, MprEvent *event)
+{
+    HttpWebSocket   *ws;
+
+    if (conn->destroyed || !conn->rx || (ws = conn->rx->webSocket) == 0) {
+        return;
+    }
+    ws->flushEvent = 0;
+    if (conn->writeq && conn->state < HTTP_STATE_FINALIZED) {
+        httpFlushQueue(conn->writeq, HTTP_NON_BLOCK);
+        if (conn->async) {
+            httpEnableConnEvents(conn);
+        }
+    }
+}
+
+
+/*
+    XOR the data with the 4 byte WebSocket mask, starting at the given mask offset. The bulk of the data is masked
+    a machine word at a time. Returns the mask offset for the next byte.
+ */
+static int maskWebSockData(char *data, ssize len, cuchar *mask, int offset)
+{
+    uchar       *cp, *ep, wide[8];
+    uint64      wmask, word;
+    int         i;
+
+    cp = (uchar*) data;
+    ep = &cp[len];
+    offset &= 0x3;
+    while (cp < ep && ((size_t) cp & (sizeof(uint64) - 1))) {
+        *cp++ ^= mask[offset++ & 0x3];
+    }
+    if ((ep - cp) >= (ssize) sizeof(uint64)) {
+        for (i = 0; i < (int) sizeof(wide); i++) {
+            wide[i] = mask[(offset + i) & 0x3];
+        }
+        memcpy(&wmask, wide, sizeof(wmask));
+        for (; (ep - cp) >= (ssize) sizeof(uint64); cp += sizeof(uint64)) {
+            memcpy(&word, cp, sizeof(word));
+            word ^= wmask;
+            memcpy(cp, &word, sizeof(word));
+        }
+    }
+    while (cp < ep) {
+        *cp++ ^= mask[offset++ & 0x3];
+    }
+    return offset & 0x3;
+}
+
+
 /*
     The reason string is optional
  */
@@ -23525,7 +24261,7 @@ static void outgoingWebSockService(HttpQueue *q)
     HttpConn        *conn;
     HttpPacket      *packet, *tail;
     HttpWebSocket   *ws;
-    char            *ep, *fp, *prefix, dataMask[4];
+    char            *prefix, dataMask[4];
     ssize           len;
     int             i, mask;
 
@@ -23574,11 +24310,7 @@ static void outgoingWebSockService(HttpQueue *q)
                 for (i = 0; i < 4; i++) {
                     *prefix++ = dataMask[i];
                 }
-                fp = packet->content->start;
-                ep = packet->content->end;
-                for (i = 0; fp < ep; fp++) {
-                    *fp = *fp ^ dataMask[i++ & 0x3];
-                }
+                maskWebSockData(packet->content->start, len, (cuchar*) dataMask, 0);
             }
             *prefix = '\0';
             mprAdjustBufEnd(packet->prefix, prefix - packet->prefix->start);
@@ -183,6 +183,15 @@ struct  MprXml;
  */
 #define MPR_EVENT_TIME_SLICE    20          /* 20 msec */
 
+/*
+    Timer wheel. Four levels of 64 slots with a 10 msec tick span about 46 hours.
+ */
+#define MPR_WHEEL_BITS          6           /* Bits of wheel time per level */
+#define MPR_WHEEL_SLOTS         (1 << MPR_WHEEL_BITS)
+#define MPR_WHEEL_MASK          (MPR_WHEEL_SLOTS - 1)
+#define MPR_WHEEL_LEVELS        4           /* Number of wheel levels */
+#define MPR_WHEEL_RESOLUTION    10          /* Wheel tick in msec */
+
 /**
     Maximum number of files to close when forking
  */
@@ -195,6 +204,7 @@ struct  MprXml;
 #define MPR_EVENT_EPOLL         2           /**< epoll_wait */
 #define MPR_EVENT_KQUEUE        3           /**< BSD kqueue */
 #define MPR_EVENT_SELECT        4           /**< traditional select() */
+#define MPR_EVENT_URING         5           /**< Linux io_uring. Must be selected explicitly via ME_EVENT_NOTIFIER */
 
 #ifndef ME_EVENT_NOTIFIER
     #if MACOSX || SOLARIS
@@ -5788,6 +5798,8 @@ PUBLIC int mprUnloadModule(MprModule *mp);
 #define MPR_EVENT_STATIC_DATA       0x8     /**< Event data is permanent and should not be marked by GC */
 #define MPR_EVENT_RUNNING           0x10    /**< Event currently executing */
 #define MPR_EVENT_BLOCK             0x20    /**< Blocking flag for mprCreateEventOutside */
+#define MPR_EVENT_WHEEL             0x40    /**< Hold on the timer wheel until due. O(1) queue and remove */
+#define MPR_EVENT_WHEELED           0x80    /**< Event is currently held on the timer wheel */
 
 #define MPR_EVENT_MAGIC             0x12348765
 
@@ -5857,6 +5869,21 @@ typedef struct MprDispatcher {
 } MprDispatcher;
 
 
+/**
+    Hierarchical timer wheel
+    @description Events created with MPR_EVENT_WHEEL are held on the timer wheel until due rather than being inserted
+        into the time-sorted dispatcher event queue. Level N slots each span MPR_WHEEL_SLOTS^N wheel ticks. When a
+        level wraps, the current slot of the next level is cascaded down. Queueing and removing events is O(1).
+        Due events are transferred to their dispatcher event queue by the event service.
+    @defgroup MprEvent MprEvent
+    @stability Internal
+ */
+typedef struct MprWheel {
+    MprEvent        slots[MPR_WHEEL_LEVELS][MPR_WHEEL_SLOTS];   /**< Slot event queue heads */
+    int64           ticks;              /**< Current wheel time in wheel ticks */
+    int             count;              /**< Number of events on the wheel */
+} MprWheel;
+
 /**
     Event Service
     @defgroup MprEvent MprEvent
@@ -5870,6 +5897,7 @@ typedef struct MprEventService {
     MprDispatcher   *waitQ;             /**< Queue of waiting (future) events */
     MprDispatcher   *idleQ;             /**< Queue of idle dispatchers */
     MprDispatcher   *pendingQ;          /**< Queue of pending dispatchers (waiting for resources) */
+    MprWheel        *wheel;             /**< Timer wheel for MPR_EVENT_WHEEL events */
     MprOsThread     serviceThread;      /**< Thread running the dispatcher service */
     MprTicks        delay;              /**< Maximum sleep time before awaking */
     int             eventCount;         /**< Count of events */
@@ -6027,6 +6055,8 @@ PUBLIC void mprSignalDispatcher(MprDispatcher *dispatcher);
     @param flags Flags to modify the behavior of the event. Valid values are: MPR_EVENT_CONTINUOUS to create an
         event which will be automatically rescheduled accoring to the specified period.
         Use MPR_EVENT_STATIC_DATA if the data argument does not point to an allocated memory object.
+        Use MPR_EVENT_WHEEL for timeouts that are frequently rescheduled or removed before they fire. These are held
+        on the event service timer wheel and may run up to MPR_WHEEL_RESOLUTION msec late.
     @return Returns the event object if successful.
     @ingroup MprEvent
     @stability Stable
@@ -6167,17 +6197,20 @@ PUBLIC int mprStopDispatcher(MprDispatcher *dispatcher);
 /* Internal API */
 PUBLIC MprEvent *mprCreateEventQueue();
 PUBLIC MprEventService *mprCreateEventService();
+PUBLIC MprWheel *mprCreateWheel();
 PUBLIC void mprDedicateWorkerToDispatcher(MprDispatcher *dispatcher, struct MprWorker *worker);
 PUBLIC void mprDequeueEvent(MprEvent *event);
 PUBLIC bool mprDispatcherHasEvents(MprDispatcher *dispatcher);
 PUBLIC int mprDispatchersAreIdle();
 PUBLIC int mprGetEventCount(MprDispatcher *dispatcher);
 PUBLIC MprEvent *mprGetNextEvent(MprDispatcher *dispatcher);
+PUBLIC MprTicks mprGetWheelDelay(MprEventService *es);
 PUBLIC MprDispatcher *mprGetNonBlockDispatcher();
 PUBLIC void mprInitEventQ(MprEvent *q);
 PUBLIC void mprQueueTimerEvent(MprDispatcher *dispatcher, MprEvent *event);
 PUBLIC void mprReleaseWorkerFromDispatcher(MprDispatcher *dispatcher, struct MprWorker *worker);
 PUBLIC void mprScheduleDispatcher(MprDispatcher *dispatcher);
+PUBLIC void mprServiceWheel(MprEventService *es);
 PUBLIC void mprRescheduleDispatcher(MprDispatcher *dispatcher);
 PUBLIC void mprSetDispatcherImmediate(MprDispatcher *dispatcher);
 PUBLIC void mprStopEventService();
@@ -7156,6 +7189,9 @@ typedef struct MprWaitService {
     int             breakFd[2];             /* Event or pipe to wakeup */
 #elif ME_EVENT_NOTIFIER == MPR_EVENT_KQUEUE
     int             kq;                     /* Kqueue() return descriptor */
+#elif ME_EVENT_NOTIFIER == MPR_EVENT_URING
+    struct MprRing  *ring;                  /* io_uring submission and completion rings */
+    int             breakFd[2];             /* Event to wakeup */
 #elif ME_EVENT_NOTIFIER == MPR_EVENT_SELECT
     fd_set          readMask;               /* Current read events mask */
     fd_set          writeMask;              /* Current write events mask */
@@ -7187,6 +7223,9 @@ PUBLIC void mprWakeNotifier();
 #if MPR_EVENT_SELECT
     PUBLIC void mprManageSelect(MprWaitService *ws, int flags);
 #endif
+#if MPR_EVENT_URING
+    PUBLIC void mprManageUring(MprWaitService *ws, int flags);
+#endif
 #if ME_WIN_LIKE
     PUBLIC void mprSetWinMsgCallback(MprMsgCallback callback);
     PUBLIC void mprServiceWinIO(MprWaitService *ws, int sockFd, int winMask);
@@ -7531,6 +7570,7 @@ PUBLIC void mprAddSocketProvider(cchar *name, MprSocketProvider *provider);
 #define MPR_SOCKET_CHECKED          0x2000  /**< Peer certificate has been checked */
 #define MPR_SOCKET_DISCONNECTED     0x4000  /**< The mprDisconnectSocket has been called */
 #define MPR_SOCKET_HANDSHAKING      0x8000  /**< Doing an SSL handshake */
+#define MPR_SOCKET_REUSE_PORT       0x10000 /**< Set SO_REUSEPORT so multiple listeners may share the endpoint */
 
 /**
     Socket Service
@@ -7644,6 +7684,8 @@ PUBLIC void mprCloseSocket(MprSocket *sp, bool graceful);
         @li MPR_SOCKET_DATAGRAM - Use IPv4 datagrams
         @li MPR_SOCKET_NOREUSE - Set NOREUSE flag on the socket
         @li MPR_SOCKET_NODELAY - Set NODELAY on the socket
+        @li MPR_SOCKET_REUSE_PORT - Set SO_REUSEPORT so that several sockets may listen on the same endpoint and
+            the O/S will distribute incoming connections between them. Ignored if not supported.
         @li MPR_SOCKET_THREAD - Process callbacks on a separate thread.
     @return Zero if the connection is successful. Otherwise a negative MPR error code.
     @ingroup MprSocket
@@ -7833,6 +7875,8 @@ PUBLIC bool mprIsSocketEof(MprSocket *sp);
         @li MPR_SOCKET_DATAGRAM - Use IPv4 datagrams
         @li MPR_SOCKET_NOREUSE - Set NOREUSE flag on the socket
         @li MPR_SOCKET_NODELAY - Set NODELAY on the socket
+        @li MPR_SOCKET_REUSE_PORT - Set SO_REUSEPORT so that several sockets may listen on the same endpoint and
+            the O/S will distribute incoming connections between them. Ignored if not supported.
         @li MPR_SOCKET_THREAD - Process callbacks on a separate thread.
     @return Zero if the connection is successful. Otherwise a negative MPR error code.
     @ingroup MprSocket
@@ -8051,6 +8095,19 @@ PUBLIC ssize mprWriteSocketVector(MprSocket *sp, MprIOVec *iovec, int count);
 
 #define MPR_CA_CERT "ca.crt"
 
+#ifndef ME_MPR_SSL_CACHE
+    #define ME_MPR_SSL_CACHE        1024            /**< Maximum number of cached server-side TLS sessions */
+#endif
+#ifndef ME_MPR_SSL_CACHE_SHARDS
+    #define ME_MPR_SSL_CACHE_SHARDS 16              /**< Number of separately locked TLS session cache shards */
+#endif
+#ifndef ME_MPR_SSL_TIMEOUT
+    #define ME_MPR_SSL_TIMEOUT      (300 * 1000)    /**< Lifespan of cached TLS sessions and tickets (msec) */
+#endif
+#ifndef ME_MPR_SSL_TICKET_ROTATE
+    #define ME_MPR_SSL_TICKET_ROTATE (3600 * 1000)  /**< Period to rotate TLS session ticket keys (msec) */
+#endif
+
 /**
     SSL control structure
     @defgroup MprSsl MprSsl
@@ -8129,6 +8186,44 @@ PUBLIC cchar *mprGetSslCipherName(int cipher);
  */
 PUBLIC int mprGetSslCipherCode(cchar *cipher);
 
+/**
+    Lookup a TLS session in the process-wide session cache
+    @description The session cache is shared by all SSL configurations and threads. It is sharded by session ID so
+        concurrent handshakes rarely contend for the same lock. Used by SSL providers to resume sessions.
+    @param id Session ID
+    @param idLen Length of the session ID
+    @param buf Buffer to receive the session data
+    @param bufsize Size of buf
+    @return The length of the session data copied into buf. Returns MPR_ERR_CANT_FIND if the session is not
+        cached or has expired, and MPR_ERR_WONT_FIT if buf is too small.
+    @ingroup MprSsl
+    @stability Internal
+ */
+PUBLIC ssize mprGetSslSession(cvoid *id, ssize idLen, void *buf, ssize bufsize);
+
+/**
+    Save a TLS session in the process-wide session cache
+    @description The session expires after ME_MPR_SSL_TIMEOUT. If the cache shard is full, expired sessions are
+        pruned and then the session closest to expiry is replaced.
+    @param id Session ID
+    @param idLen Length of the session ID
+    @param data Session data to save. The data is copied.
+    @param len Length of the session data
+    @return Zero if successful. Otherwise a negative MPR error code.
+    @ingroup MprSsl
+    @stability Internal
+ */
+PUBLIC int mprPutSslSession(cvoid *id, ssize idLen, cvoid *data, ssize len);
+
+/**
+    Remove a TLS session from the process-wide session cache
+    @param id Session ID
+    @param idLen Length of the session ID
+    @ingroup MprSsl
+    @stability Internal
+ */
+PUBLIC void mprRemoveSslSession(cvoid *id, ssize idLen);
+
  /**
     Load the SSL module.
     @ingroup MprSsl
@@ -9417,6 +9417,7 @@ PUBLIC MprEventService *mprCreateEventService()
     es->idleQ = createQhead("idle");
     es->pendingQ = createQhead("pending");
     es->waitQ = createQhead("waiting");
+    es->wheel = mprCreateWheel();
     return es;
 }
 
@@ -9431,6 +9432,7 @@ static void manageEventService(MprEventService *es, int flags)
         mprMark(es->waitQ);
         mprMark(es->idleQ);
         mprMark(es->pendingQ);
+        mprMark(es->wheel);
         mprMark(es->waitCond);
         mprMark(es->mutex);
 
@@ -9613,6 +9615,7 @@ PUBLIC int mprServiceEvents(MprTicks timeout, int flags)
     while (es->now <= expires) {
         eventCount = es->eventCount;
         mprServiceSignals();
+        mprServiceWheel(es);
 
         while ((dp = getNextReadyDispatcher(es)) != NULL) {
             assert(!isRunning(dp));
@@ -10088,6 +10091,7 @@ static MprTicks getIdleTicks(MprEventService *es, MprTicks timeout)
                 }
             }
         }
+        delay = min(delay, mprGetWheelDelay(es));
         delay = min(delay, timeout);
         es->delay = 0;
     }
@@ -10562,6 +10566,7 @@ PUBLIC char *mprEscapeSQL(cchar *cmd)
 #if ME_EVENT_NOTIFIER == MPR_EVENT_EPOLL
 /********************************** Forwards **********************************/
 
+static int getEpollEvents(MprWaitHandler *wp, int mask);
 static void serviceIO(MprWaitService *ws, struct epoll_event *events, int count);
 
 /************************************ Code ************************************/
@@ -10622,6 +10627,11 @@ PUBLIC void mprManageEpoll(MprWaitService *ws, int flags)
 }
 
 
+/*
+    Handlers that are not serviced immediately are registered as one-shot. The kernel disarms the descriptor when it
+    reports an event, so suppressing further events while the event is serviced costs no system call and re-enabling
+    is a single EPOLL_CTL_MOD. The wp->notifierIndex is set to the fd while the descriptor is registered with epoll.
+ */
 PUBLIC int mprNotifyOn(MprWaitHandler *wp, int mask)
 {
     MprWaitService      *ws;
@@ -10636,31 +10646,25 @@ PUBLIC int mprNotifyOn(MprWaitHandler *wp, int mask)
     if (wp->desiredMask != mask) {
         memset(&ev, 0, sizeof(ev));
         ev.data.fd = fd;
-        if (wp->desiredMask & MPR_READABLE) {
-            ev.events |= EPOLLIN | EPOLLHUP;
-        }
-        if (wp->desiredMask & MPR_WRITABLE) {
-            ev.events |= EPOLLOUT;
-        }
-        if (wp->desiredMask == (MPR_READABLE | MPR_WRITABLE)) {
-            ev.events |= EPOLLHUP;
-        }
-        if (ev.events) {
-            if ((rc = epoll_ctl(ws->epoll, EPOLL_CTL_DEL, fd, &ev)) != 0) {
-                mprLog("error mpr event", 0, "Epoll delete error %d on fd %d", errno, fd);
-            }
-        }
-        ev.events = 0;
-        if (mask & MPR_READABLE) {
-            ev.events |= (EPOLLIN | EPOLLHUP);
-        }
-        if (mask & MPR_WRITABLE) {
-            ev.events |= EPOLLOUT | EPOLLHUP;
-        }
+        ev.events = getEpollEvents(wp, mask);
         if (ev.events) {
-            if ((rc = epoll_ctl(ws->epoll, EPOLL_CTL_ADD, fd, &ev)) != 0) {
+            rc = epoll_ctl(ws->epoll, (wp->notifierIndex == fd) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &ev);
+            if (rc != 0 && errno == ENOENT) {
+                rc = epoll_ctl(ws->epoll, EPOLL_CTL_ADD, fd, &ev);
+            } else if (rc != 0 && errno == EEXIST) {
+                /* Still registered by a prior handler on this descriptor */
+                rc = epoll_ctl(ws->epoll, EPOLL_CTL_MOD, fd, &ev);
+            }
+            if (rc != 0) {
                 mprLog("error mpr event", 0, "Epoll add error %d on fd %d", errno, fd);
             }
+            wp->notifierIndex = fd;
+
+        } else if (wp->notifierIndex == fd) {
+            if ((rc = epoll_ctl(ws->epoll, EPOLL_CTL_DEL, fd, &ev)) != 0 && errno != ENOENT && errno != EBADF) {
+                mprLog("error mpr event", 0, "Epoll delete error %d on fd %d", errno, fd);
+            }
+            wp->notifierIndex = -1;
         }
         wp->desiredMask = mask;
         mprSetItem(ws->handlerMap, fd, mask ? wp : 0);
@@ -10670,52 +10674,66 @@ PUBLIC int mprNotifyOn(MprWaitHandler *wp, int mask)
 }
 
 
+/*
+    Map a wait mask to the epoll events to register
+ */
+static int getEpollEvents(MprWaitHandler *wp, int mask)
+{
+    int     events;
+
+    events = 0;
+    if (mask & MPR_READABLE) {
+        events |= (EPOLLIN | EPOLLHUP);
+    }
+    if (mask & MPR_WRITABLE) {
+        events |= EPOLLOUT | EPOLLHUP;
+    }
+    if (events && !(wp->flags & MPR_WAIT_IMMEDIATE)) {
+        events |= EPOLLONESHOT;
+    }
+    return events;
+}
+
+
 /*
     Wait for I/O on a single file descriptor. Return a mask of events found. Mask is the events of interest.
-    timeout is in milliseconds.
+    timeout is in milliseconds. This uses poll() rather than creating and closing a dedicated epoll instance per call.
  */
 PUBLIC int mprWaitForSingleIO(int fd, int mask, MprTicks timeout)
 {
-    struct epoll_event  ev, events[2];
-    int                 epfd, rc, result;
+    struct pollfd   fds[1];
+    int             rc, result;
 
     if (timeout < 0 || timeout > MAXINT) {
         timeout = MAXINT;
     }
-    memset(&ev, 0, sizeof(ev));
-    memset(events, 0, sizeof(events));
-    ev.data.fd = fd;
-    if ((epfd = epoll_create(ME_MAX_EVENTS)) < 0) {
-        mprLog("error mpr event", 0, "Epoll_create failed, errno=%d", errno);
-        return MPR_ERR_CANT_INITIALIZE;
-    }
-    ev.events = 0;
+    fds[0].fd = fd;
+    fds[0].events = 0;
+    fds[0].revents = 0;
     if (mask & MPR_READABLE) {
-        ev.events = EPOLLIN | EPOLLHUP;
+        fds[0].events |= POLLIN;
     }
     if (mask & MPR_WRITABLE) {
-        ev.events = EPOLLOUT | EPOLLHUP;
+        fds[0].events |= POLLOUT;
     }
-    if (ev.events) {
-        epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+    if (timeout > 0) {
+        mprYield(MPR_YIELD_STICKY);
+    }
+    rc = poll(fds, 1, (int) timeout);
+    if (timeout > 0) {
+        mprResetYield();
     }
-    mprYield(MPR_YIELD_STICKY);
-    rc = epoll_wait(epfd, events, sizeof(events) / sizeof(struct epoll_event), timeout);
-    mprResetYield();
-    close(epfd);
-
     result = 0;
     if (rc < 0) {
-        mprLog("error mpr event", 0, "Epoll returned %d, errno %d", rc, errno);
-
+        if (errno != EINTR) {
+            mprLog("error mpr event", 0, "Poll returned %d, errno %d", rc, errno);
+        }
     } else if (rc > 0) {
-        if (rc > 0) {
-            if ((events[0].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) && (mask & MPR_READABLE)) {
-                result |= MPR_READABLE;
-            }
-            if ((events[0].events & (EPOLLOUT | EPOLLHUP)) && (mask & MPR_WRITABLE)) {
-                result |= MPR_WRITABLE;
-            }
+        if ((fds[0].revents & (POLLIN | POLLERR | POLLHUP)) && (mask & MPR_READABLE)) {
+            result |= MPR_READABLE;
+        }
+        if ((fds[0].revents & (POLLOUT | POLLHUP)) && (mask & MPR_WRITABLE)) {
+            result |= MPR_WRITABLE;
         }
     }
     return result;
@@ -10762,7 +10780,7 @@ PUBLIC void mprWaitForIO(MprWaitService *ws, MprTicks timeout)
 static void serviceIO(MprWaitService *ws, struct epoll_event *events, int count)
 {
     MprWaitHandler      *wp;
-    struct epoll_event  *ev;
+    struct epoll_event  *ev, rearm;
     int                 fd, i, mask;
 
     lock(ws);
@@ -10787,7 +10805,8 @@ static void serviceIO(MprWaitService *ws, struct epoll_event *events, int count)
         if (ev->events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
             mask |= MPR_READABLE;
         }
-        if (ev->events & (EPOLLOUT | EPOLLHUP)) {
+        if (ev->events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+            /* Errors are always reported by epoll. Let a handler waiting only for writable see the failure. */
             mask |= MPR_WRITABLE;
         }
         wp->presentMask = mask & wp->desiredMask;
@@ -10797,10 +10816,23 @@ static void serviceIO(MprWaitService *ws, struct epoll_event *events, int count)
             } else {
                 /*
                     Suppress further events while this event is being serviced. User must re-enable.
+                    The one-shot registration has already been disarmed by the kernel.
                  */
-                mprNotifyOn(wp, 0);
+                wp->desiredMask = 0;
+                mprSetItem(ws->handlerMap, fd, 0);
                 mprQueueIOEvent(wp);
             }
+        } else if (wp->desiredMask && !(wp->flags & MPR_WAIT_IMMEDIATE)) {
+            /*
+                The kernel disarmed the one-shot registration for an event that is not of interest. Re-arm, otherwise
+                desiredMask is unchanged and a subsequent mprNotifyOn with the same mask would not re-enable events.
+             */
+            memset(&rearm, 0, sizeof(rearm));
+            rearm.data.fd = fd;
+            rearm.events = getEpollEvents(wp, wp->desiredMask);
+            if (epoll_ctl(ws->epoll, EPOLL_CTL_MOD, fd, &rearm) != 0) {
+                mprLog("error mpr event", 0, "Epoll rearm error %d on fd %d", errno, fd);
+            }
         }
     }
     unlock(ws);
@@ -10878,9 +10910,13 @@ void epollDummy() {}
 
 static void initEvent(MprDispatcher *dispatcher, MprEvent *event, cchar *name, MprTicks period, void *proc, 
         void *data, int flgs);
+static void cascadeWheel(MprWheel *wheel, int level, int slot);
+static int64 getWheelTicks(MprTicks due);
 static void initEventQ(MprEvent *q, cchar *name);
 static void manageEvent(MprEvent *event, int flags);
+static void manageWheel(MprWheel *wheel, int flags);
 static void queueEvent(MprEvent *prior, MprEvent *event);
+static void queueWheelEvent(MprWheel *wheel, MprEvent *event);
 
 /************************************* Code ***********************************/
 /*
@@ -10971,6 +11007,7 @@ PUBLIC void mprQueueEvent(MprDispatcher *dispatcher, MprEvent *event)
 {
     MprEventService     *es;
     MprEvent            *prior, *q;
+    MprWheel            *wheel;
 
     assert(dispatcher);
     assert(event);
@@ -10979,6 +11016,22 @@ PUBLIC void mprQueueEvent(MprDispatcher *dispatcher, MprEvent *event)
     es = dispatcher->service;
 
     lock(es);
+    if (event->flags & MPR_EVENT_WHEEL) {
+        wheel = es->wheel;
+        if (wheel->count == 0) {
+            /* Resynchronize an empty wheel that may not have been advanced while the event service slept */
+            wheel->ticks = mprGetTicks() / MPR_WHEEL_RESOLUTION;
+        }
+        if (getWheelTicks(event->due) > wheel->ticks) {
+            event->dispatcher = dispatcher;
+            queueWheelEvent(wheel, event);
+            if (event->due < es->willAwake) {
+                mprWakeEventService();
+            }
+            unlock(es);
+            return;
+        }
+    }
     q = dispatcher->eventQ;
     for (prior = q->prev; prior != q; prior = prior->prev) {
         if (event->due > prior->due) {
@@ -11154,6 +11207,10 @@ PUBLIC void mprDequeueEvent(MprEvent *event)
 
     /* If a continuous event is removed, next may already be null */
     if (event->next) {
+        if (event->flags & MPR_EVENT_WHEELED) {
+            event->flags &= ~MPR_EVENT_WHEELED;
+            MPR->eventService->wheel->count--;
+        }
         event->next->prev = event->prev;
         event->prev->next = event->next;
         event->next = 0;
@@ -11162,6 +11219,162 @@ PUBLIC void mprDequeueEvent(MprEvent *event)
 }
 
 
+PUBLIC MprWheel *mprCreateWheel()
+{
+    MprWheel    *wheel;
+    MprEvent    *head;
+    int         level, slot;
+
+    if ((wheel = mprAllocObj(MprWheel, manageWheel)) == 0) {
+        return 0;
+    }
+    for (level = 0; level < MPR_WHEEL_LEVELS; level++) {
+        for (slot = 0; slot < MPR_WHEEL_SLOTS; slot++) {
+            head = &wheel->slots[level][slot];
+            head->next = head->prev = head;
+        }
+    }
+    wheel->ticks = mprGetTicks() / MPR_WHEEL_RESOLUTION;
+    return wheel;
+}
+
+
+static void manageWheel(MprWheel *wheel, int flags)
+{
+    MprEvent    *head, *event;
+    int         level, slot;
+
+    if (flags & MPR_MANAGE_MARK) {
+        for (level = 0; level < MPR_WHEEL_LEVELS; level++) {
+            for (slot = 0; slot < MPR_WHEEL_SLOTS; slot++) {
+                head = &wheel->slots[level][slot];
+                for (event = head->next; event != head; event = event->next) {
+                    mprMark(event);
+                }
+            }
+        }
+    }
+}
+
+
+/*
+    Convert a due time to wheel ticks. Round up so wheel events never run early.
+ */
+static int64 getWheelTicks(MprTicks due)
+{
+    return (due / MPR_WHEEL_RESOLUTION) + ((due % MPR_WHEEL_RESOLUTION) ? 1 : 0);
+}
+
+
+/*
+    Put an event into the wheel slot for its due time. The level is selected by the distance to the due time.
+    Must be locked when called.
+ */
+static void queueWheelEvent(MprWheel *wheel, MprEvent *event)
+{
+    int64   due, delta, span;
+    int     level;
+
+    due = max(getWheelTicks(event->due), wheel->ticks);
+    delta = due - wheel->ticks;
+    for (level = 0; level < MPR_WHEEL_LEVELS - 1; level++) {
+        if (delta < ((int64) 1 << ((level + 1) * MPR_WHEEL_BITS))) {
+            break;
+        }
+    }
+    span = (int64) 1 << (MPR_WHEEL_LEVELS * MPR_WHEEL_BITS);
+    if (delta >= span) {
+        /* Beyond the span of the wheel. Park in the furthest slot and reinsert when cascaded */
+        due = wheel->ticks + span - 1;
+    }
+    /* Insert at the front so a slot being cascaded will not revisit the event */
+    queueEvent(&wheel->slots[level][(due >> (level * MPR_WHEEL_BITS)) & MPR_WHEEL_MASK], event);
+    event->flags |= MPR_EVENT_WHEELED;
+    wheel->count++;
+}
+
+
+/*
+    Redistribute the events of a higher level slot into lower levels. Must be locked when called.
+ */
+static void cascadeWheel(MprWheel *wheel, int level, int slot)
+{
+    MprEvent    *head, *event, *next;
+
+    head = &wheel->slots[level][slot];
+    for (event = head->next; event != head; event = next) {
+        next = event->next;
+        queueWheelEvent(wheel, event);
+    }
+}
+
+
+/*
+    Advance the wheel to the current time. Due events are transferred to their dispatcher event queues.
+    Called by the event service before selecting ready dispatchers.
+ */
+PUBLIC void mprServiceWheel(MprEventService *es)
+{
+    MprWheel        *wheel;
+    MprDispatcher   *dispatcher;
+    MprEvent        *head, *event, *next;
+    int64           now;
+    int             level;
+
+    wheel = es->wheel;
+    now = mprGetTicks() / MPR_WHEEL_RESOLUTION;
+
+    lock(es);
+    if (wheel->count == 0) {
+        wheel->ticks = now;
+    }
+    while (wheel->ticks < now) {
+        wheel->ticks++;
+        for (level = 1; level < MPR_WHEEL_LEVELS; level++) {
+            if ((wheel->ticks >> ((level - 1) * MPR_WHEEL_BITS)) & MPR_WHEEL_MASK) {
+                break;
+            }
+            cascadeWheel(wheel, level, (wheel->ticks >> (level * MPR_WHEEL_BITS)) & MPR_WHEEL_MASK);
+        }
+        head = &wheel->slots[0][wheel->ticks & MPR_WHEEL_MASK];
+        for (event = head->next; event != head; event = next) {
+            next = event->next;
+            mprDequeueEvent(event);
+            dispatcher = event->dispatcher;
+            if (dispatcher && !(dispatcher->flags & MPR_DISPATCHER_DESTROYED)) {
+                mprQueueEvent(dispatcher, event);
+            }
+        }
+    }
+    unlock(es);
+}
+
+
+/*
+    Get the time till the wheel next needs servicing, either for a due event or to cascade a higher level slot.
+    Must be called locked.
+ */
+PUBLIC MprTicks mprGetWheelDelay(MprEventService *es)
+{
+    MprWheel    *wheel;
+    MprEvent    *head;
+    int64       when, wrap;
+
+    wheel = es->wheel;
+    if (wheel->count == 0) {
+        return MPR_MAX_TIMEOUT;
+    }
+    wrap = (wheel->ticks | MPR_WHEEL_MASK) + 1;
+    for (when = wheel->ticks + 1; when < wrap; when++) {
+        head = &wheel->slots[0][when & MPR_WHEEL_MASK];
+        if (head->next != head) {
+            break;
+        }
+    }
+    return (when * MPR_WHEEL_RESOLUTION) - es->now;
+}
+
+
 /*
     @copy   default
 
@@ -22071,7 +22284,7 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
     sp->fd = INVALID_SOCKET;
     sp->port = port;
     sp->flags = (flags & (MPR_SOCKET_BROADCAST | MPR_SOCKET_DATAGRAM | MPR_SOCKET_BLOCK |
-         MPR_SOCKET_NOREUSE | MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD));
+         MPR_SOCKET_NOREUSE | MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD | MPR_SOCKET_REUSE_PORT));
     datagram = sp->flags & MPR_SOCKET_DATAGRAM;
 
     /*
@@ -22103,11 +22316,12 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
         if (setsockopt(sp->fd, SOL_SOCKET, SO_REUSEADDR, (char*) &enable, sizeof(enable)) != 0) {
             mprLog("error mpr socket", 3, "Cannot set reuseaddr, errno %d", errno);
         }
-#if defined(SO_REUSEPORT) && KEEP
+#if defined(SO_REUSEPORT)
         /*
-            This permits multiple servers listening on the same endpoint
+            This permits multiple listeners on the same endpoint. The O/S distributes new connections between them.
          */
-        if (setsockopt(sp->fd, SOL_SOCKET, SO_REUSEPORT, (char*) &enable, sizeof(enable)) != 0) {
+        if ((sp->flags & MPR_SOCKET_REUSE_PORT) &&
+                setsockopt(sp->fd, SOL_SOCKET, SO_REUSEPORT, (char*) &enable, sizeof(enable)) != 0) {
             mprLog("error mpr socket", 3, "Cannot set reuseport, errno %d", errno);
         }
 #endif
@@ -27787,6 +28001,525 @@ PUBLIC int gettimeofday(struct timeval *tv, struct timezone *tz)
 
 
 
+/********* Start of file src/uring.c ************/
+
+
+/**
+    uring.c - Wait for I/O by using io_uring on Linux.
+
+    This module augments the mprWait wait services module by providing io_uring based waiting support. Interest in a
+    file descriptor is expressed by submitting a one-shot poll request. Poll requests are batched and submitted with
+    the call that waits for completions, so the service thread uses one system call per wait. This module is
+    thread-safe. Select it by defining ME_EVENT_NOTIFIER to be MPR_EVENT_URING.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+
+
+#if ME_EVENT_NOTIFIER == MPR_EVENT_URING
+#include    <linux/io_uring.h>
+#include    <sys/syscall.h>
+
+/*********************************** Locals ***********************************/
+
+#define URING_ENTRIES       256                 /* Submission queue size */
+#define URING_BREAK         ((uint64) -1)       /* User data for the wakeup descriptor poll */
+#define URING_REMOVE        ((uint64) -2)       /* User data for poll removal requests */
+
+/*
+    Submission and completion rings mapped from the kernel
+ */
+typedef struct MprRing {
+    int                 fd;                     /* io_uring descriptor */
+    uint                pending;                /* Queued submissions not yet passed to the kernel */
+    int                 deferSubmit;            /* Defer submission to the next wait */
+    int                 seq;                    /* Poll request generation */
+    void                *sqMap;                 /* Submission ring mapping */
+    void                *cqMap;                 /* Completion ring mapping */
+    size_t              sqMapSize;
+    size_t              cqMapSize;
+    struct io_uring_sqe *sqes;                  /* Submission queue entries */
+    size_t              sqesSize;
+    uint                *sqHead;
+    uint                *sqTail;
+    uint                *sqMask;
+    uint                *sqArray;
+    uint                sqEntries;
+    uint                *cqHead;
+    uint                *cqTail;
+    uint                *cqMask;
+    struct io_uring_cqe *cqes;
+} MprRing;
+
+/********************************** Forwards **********************************/
+
+static void armPoll(MprWaitService *ws, MprWaitHandler *wp, int mask);
+static int enterRing(MprRing *ring, uint submit, uint wait, MprTicks timeout);
+static struct io_uring_sqe *getSqe(MprWaitService *ws);
+static void serviceIO(MprWaitService *ws);
+static void submitRing(MprWaitService *ws);
+
+/************************************ Code ************************************/
+
+PUBLIC int mprCreateNotifierService(MprWaitService *ws)
+{
+    struct io_uring_params  params;
+    struct io_uring_sqe     *sqe;
+    MprRing                 *ring;
+    char                    *sq, *cq;
+
+    if ((ws->handlerMap = mprCreateList(MPR_FD_MIN, 0)) == 0) {
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    if ((ring = mprAllocZeroed(sizeof(MprRing))) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    ws->ring = ring;
+    ring->fd = -1;
+    ws->breakFd[0] = ws->breakFd[1] = -1;
+
+    memset(&params, 0, sizeof(params));
+    if ((ring->fd = (int) syscall(__NR_io_uring_setup, URING_ENTRIES, &params)) < 0) {
+        mprLog("critical mpr event", 0, "Call to io_uring_setup failed, errno %d", errno);
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    if (!(params.features & IORING_FEAT_EXT_ARG)) {
+        mprLog("critical mpr event", 0, "io_uring does not support wait timeouts");
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    ring->sqMapSize = params.sq_off.array + params.sq_entries * sizeof(uint);
+    ring->cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->sqMapSize = ring->cqMapSize = max(ring->sqMapSize, ring->cqMapSize);
+    }
+    ring->sqMap = mmap(0, ring->sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, 
+        IORING_OFF_SQ_RING);
+    if (ring->sqMap == MAP_FAILED) {
+        ring->sqMap = 0;
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cqMap = ring->sqMap;
+    } else {
+        ring->cqMap = mmap(0, ring->cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+            IORING_OFF_CQ_RING);
+        if (ring->cqMap == MAP_FAILED) {
+            ring->cqMap = 0;
+            return MPR_ERR_CANT_INITIALIZE;
+        }
+    }
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(0, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, 
+        IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = 0;
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    sq = ring->sqMap;
+    ring->sqHead = (uint*) (sq + params.sq_off.head);
+    ring->sqTail = (uint*) (sq + params.sq_off.tail);
+    ring->sqMask = (uint*) (sq + params.sq_off.ring_mask);
+    ring->sqArray = (uint*) (sq + params.sq_off.array);
+    ring->sqEntries = params.sq_entries;
+    cq = ring->cqMap;
+    ring->cqHead = (uint*) (cq + params.cq_off.head);
+    ring->cqTail = (uint*) (cq + params.cq_off.tail);
+    ring->cqMask = (uint*) (cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*) (cq + params.cq_off.cqes);
+
+    if ((ws->breakFd[MPR_READ_PIPE] = eventfd(0, EFD_NONBLOCK)) < 0) {
+        mprLog("critical mpr event", 0, "Cannot open breakout event");
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    lock(ws);
+    if ((sqe = getSqe(ws)) != 0) {
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = ws->breakFd[MPR_READ_PIPE];
+        sqe->poll32_events = POLLIN;
+        sqe->user_data = URING_BREAK;
+    }
+    submitRing(ws);
+    unlock(ws);
+    return 0;
+}
+
+
+PUBLIC void mprManageUring(MprWaitService *ws, int flags)
+{
+    MprRing     *ring;
+
+    if (flags & MPR_MANAGE_MARK) {
+        /* Handlers are not marked here so they will auto-remove from the list */
+        mprMark(ws->handlerMap);
+        mprMark(ws->ring);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if ((ring = ws->ring) != 0) {
+            if (ring->sqes) {
+                munmap(ring->sqes, ring->sqesSize);
+            }
+            if (ring->cqMap && ring->cqMap != ring->sqMap) {
+                munmap(ring->cqMap, ring->cqMapSize);
+            }
+            if (ring->sqMap) {
+                munmap(ring->sqMap, ring->sqMapSize);
+            }
+            if (ring->fd >= 0) {
+                close(ring->fd);
+            }
+        }
+        if (ws->breakFd[0] >= 0) {
+            close(ws->breakFd[0]);
+        }
+    }
+}
+
+
+/*
+    Poll requests are one-shot. A handler is armed while wp->notifierIndex holds the generation of its outstanding poll 
+    request. Changing the mask removes the outstanding request and submits a new one.
+ */
+PUBLIC int mprNotifyOn(MprWaitHandler *wp, int mask)
+{
+    MprWaitService      *ws;
+    struct io_uring_sqe *sqe;
+
+    assert(wp);
+    ws = wp->service;
+
+    lock(ws);
+    if (wp->desiredMask != mask) {
+        if (wp->notifierIndex > 0) {
+            if ((sqe = getSqe(ws)) != 0) {
+                sqe->opcode = IORING_OP_POLL_REMOVE;
+                sqe->fd = -1;
+                sqe->addr = ((uint64) wp->notifierIndex << 32) | (uint) wp->fd;
+                sqe->user_data = URING_REMOVE;
+            }
+            wp->notifierIndex = 0;
+        }
+        if (mask) {
+            armPoll(ws, wp, mask);
+        }
+        wp->desiredMask = mask;
+        mprSetItem(ws->handlerMap, wp->fd, mask ? wp : 0);
+        if (!ws->ring->deferSubmit) {
+            submitRing(ws);
+        }
+    }
+    unlock(ws);
+    return 0;
+}
+
+
+static void armPoll(MprWaitService *ws, MprWaitHandler *wp, int mask)
+{
+    MprRing             *ring;
+    struct io_uring_sqe *sqe;
+    uint                events;
+
+    ring = ws->ring;
+    events = 0;
+    if (mask & MPR_READABLE) {
+        events |= POLLIN | POLLHUP;
+    }
+    if (mask & MPR_WRITABLE) {
+        events |= POLLOUT | POLLHUP;
+    }
+    if ((sqe = getSqe(ws)) != 0) {
+        ring->seq = (ring->seq >= MAXINT - 1) ? 1 : ring->seq + 1;
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = wp->fd;
+        sqe->poll32_events = events;
+        sqe->user_data = ((uint64) ring->seq << 32) | (uint) wp->fd;
+        wp->notifierIndex = ring->seq;
+    }
+}
+
+
+/*
+    Get a free submission queue entry. Must be called locked. If the queue is full, pending entries are submitted first.
+ */
+static struct io_uring_sqe *getSqe(MprWaitService *ws)
+{
+    MprRing             *ring;
+    struct io_uring_sqe *sqe;
+    uint                head, tail, index;
+
+    ring = ws->ring;
+    tail = *ring->sqTail;
+    head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    if (tail - head >= ring->sqEntries) {
+        submitRing(ws);
+        head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+        if (tail - head >= ring->sqEntries) {
+            mprLog("error mpr event", 0, "io_uring submission queue is full");
+            return 0;
+        }
+    }
+    index = tail & *ring->sqMask;
+    sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sqArray[index] = index;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    ring->pending++;
+    return sqe;
+}
+
+
+/*
+    Pass pending submissions to the kernel. Must be called locked.
+ */
+static void submitRing(MprWaitService *ws)
+{
+    MprRing     *ring;
+    uint        pending;
+
+    ring = ws->ring;
+    if ((pending = ring->pending) > 0) {
+        ring->pending = 0;
+        if (enterRing(ring, pending, 0, 0) < 0) {
+            mprLog("error mpr event", 0, "io_uring submit failed, errno %d", errno);
+        }
+    }
+}
+
+
+static int enterRing(MprRing *ring, uint submit, uint wait, MprTicks timeout)
+{
+    struct io_uring_getevents_arg   arg;
+    struct __kernel_timespec        ts;
+    int                             rc;
+
+    if (wait == 0) {
+        return (int) syscall(__NR_io_uring_enter, ring->fd, submit, 0, 0, NULL, 0);
+    }
+    ts.tv_sec = timeout / 1000;
+    ts.tv_nsec = (timeout % 1000) * 1000000;
+    memset(&arg, 0, sizeof(arg));
+    arg.ts = (uint64) (size_t) &ts;
+    rc = (int) syscall(__NR_io_uring_enter, ring->fd, submit, wait, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+        &arg, sizeof(arg));
+    return rc;
+}
+
+
+/*
+    Wait for I/O on a single file descriptor. Return a mask of events found. Mask is the events of interest.
+    timeout is in milliseconds.
+ */
+PUBLIC int mprWaitForSingleIO(int fd, int mask, MprTicks timeout)
+{
+    struct pollfd   fds[1];
+    int             rc, result;
+
+    if (timeout < 0 || timeout > MAXINT) {
+        timeout = MAXINT;
+    }
+    fds[0].fd = fd;
+    fds[0].events = 0;
+    fds[0].revents = 0;
+    if (mask & MPR_READABLE) {
+        fds[0].events |= POLLIN;
+    }
+    if (mask & MPR_WRITABLE) {
+        fds[0].events |= POLLOUT;
+    }
+    if (timeout > 0) {
+        mprYield(MPR_YIELD_STICKY);
+    }
+    rc = poll(fds, 1, (int) timeout);
+    if (timeout > 0) {
+        mprResetYield();
+    }
+    result = 0;
+    if (rc < 0) {
+        if (errno != EINTR) {
+            mprLog("error mpr event", 0, "Poll returned %d, errno %d", rc, errno);
+        }
+    } else if (rc > 0) {
+        if ((fds[0].revents & (POLLIN | POLLERR | POLLHUP)) && (mask & MPR_READABLE)) {
+            result |= MPR_READABLE;
+        }
+        if ((fds[0].revents & (POLLOUT | POLLHUP)) && (mask & MPR_WRITABLE)) {
+            result |= MPR_WRITABLE;
+        }
+    }
+    return result;
+}
+
+
+/*
+    Wait for I/O on all registered file descriptors. Timeout is in milliseconds. Pending poll requests are submitted 
+    by the same system call that waits.
+ */
+PUBLIC void mprWaitForIO(MprWaitService *ws, MprTicks timeout)
+{
+    MprRing     *ring;
+    uint        pending;
+    int         rc;
+
+    if (timeout < 0 || timeout > MAXINT) {
+        timeout = MAXINT;
+    }
+#if ME_DEBUG
+    if (mprGetDebugMode() && timeout > 30000) {
+        timeout = 30000;
+    }
+#endif
+    if (ws->needRecall) {
+        mprDoWaitRecall(ws);
+        return;
+    }
+    ring = ws->ring;
+    lock(ws);
+    pending = ring->pending;
+    ring->pending = 0;
+    unlock(ws);
+
+    mprYield(MPR_YIELD_STICKY);
+    if ((rc = enterRing(ring, pending, 1, timeout)) < 0) {
+        if (errno != EINTR && errno != ETIME && errno != EAGAIN) {
+            mprLog("error mpr event", 0, "io_uring_enter returned %d, errno %d", rc, mprGetOsError());
+        }
+    }
+    mprClearWaiting();
+    mprResetYield();
+
+    serviceIO(ws);
+    ws->wakeRequested = 0;
+}
+
+
+static void serviceIO(MprWaitService *ws)
+{
+    MprWaitHandler      *wp;
+    MprRing             *ring;
+    struct io_uring_cqe *cqe;
+    struct io_uring_sqe *sqe;
+    uint64              data, value;
+    uint                head, tail;
+    int                 fd, mask, res, seq;
+
+    ring = ws->ring;
+    lock(ws);
+    ring->deferSubmit = 1;
+    head = *ring->cqHead;
+    tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+        cqe = &ring->cqes[head & *ring->cqMask];
+        data = cqe->user_data;
+        res = cqe->res;
+        if (data == URING_REMOVE) {
+            continue;
+        }
+        if (data == URING_BREAK) {
+            if (read(ws->breakFd[MPR_READ_PIPE], &value, sizeof(value)) < 0) {}
+            if ((sqe = getSqe(ws)) != 0) {
+                sqe->opcode = IORING_OP_POLL_ADD;
+                sqe->fd = ws->breakFd[MPR_READ_PIPE];
+                sqe->poll32_events = POLLIN;
+                sqe->user_data = URING_BREAK;
+            }
+            continue;
+        }
+        fd = (int) (data & 0xFFFFFFFF);
+        seq = (int) (data >> 32);
+        if ((wp = mprGetItem(ws->handlerMap, fd)) == 0 || wp->notifierIndex != seq) {
+            /* Stale completion for a removed or re-armed poll request */
+            continue;
+        }
+        wp->notifierIndex = 0;
+        if (res < 0) {
+            /* Poll failed. Re-arm so errors surface to the handler on the next I/O attempt */
+            if (res != -ECANCELED && wp->desiredMask) {
+                wp->presentMask = wp->desiredMask;
+            } else {
+                continue;
+            }
+        } else {
+            mask = 0;
+            if (res & (POLLIN | POLLHUP | POLLERR)) {
+                mask |= MPR_READABLE;
+            }
+            if (res & (POLLOUT | POLLHUP)) {
+                mask |= MPR_WRITABLE;
+            }
+            wp->presentMask = mask & wp->desiredMask;
+        }
+        if (wp->presentMask) {
+            if (wp->flags & MPR_WAIT_IMMEDIATE) {
+                (wp->proc)(wp->handlerData, NULL);
+                if (wp->fd == fd && wp->desiredMask && wp->notifierIndex == 0) {
+                    armPoll(ws, wp, wp->desiredMask);
+                }
+            } else {
+                /*
+                    Suppress further events while this event is being serviced. User must re-enable.
+                    The one-shot poll request has completed so there is nothing to cancel.
+                 */
+                wp->desiredMask = 0;
+                mprSetItem(ws->handlerMap, fd, 0);
+                mprQueueIOEvent(wp);
+            }
+        } else if (wp->desiredMask) {
+            armPoll(ws, wp, wp->desiredMask);
+        }
+    }
+    __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+    ring->deferSubmit = 0;
+    unlock(ws);
+}
+
+
+/*
+    Wake the wait service. WARNING: This routine must not require locking. MprEvents in scheduleDispatcher depends on this.
+    Must be async-safe.
+ */
+PUBLIC void mprWakeNotifier()
+{
+    MprWaitService  *ws;
+    uint64          c;
+
+    ws = MPR->waitService;
+    if (!ws->wakeRequested) {
+        ws->wakeRequested = 1;
+        c = 1;
+        if (write(ws->breakFd[MPR_READ_PIPE], &c, sizeof(c)) != sizeof(c)) {
+            mprLog("error mpr event", 0, "Cannot write to break port errno=%d", errno);
+        }
+    }
+}
+
+#else
+void uringDummy() {}
+#endif /* MPR_EVENT_URING */
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a 
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
+
+
+
 /********* Start of file src/vxworks.c ************/
 
 
@@ -28103,6 +28836,9 @@ static void manageWaitService(MprWaitService *ws, int flags)
 #if ME_EVENT_NOTIFIER == MPR_EVENT_SELECT
     mprManageSelect(ws, flags);
 #endif
+#if ME_EVENT_NOTIFIER == MPR_EVENT_URING
+    mprManageUring(ws, flags);
+#endif
 }
 
 
@@ -66,11 +66,6 @@ static char *dhKey =
     "01F76949A60BB7F00A40B1EAB64BDD48" 
     "E8A700D60B7F1200FA8E77B0A979DABF";
 
-/*
-    Thread-safe session list
- */
-static MprList *sessions;
-
 /***************************** Forward Declarations ***************************/
 
 static void     closeEst(MprSocket *sp, bool gracefully);
@@ -104,7 +99,6 @@ PUBLIC int mprCreateEstModule()
     estProvider->writeSocket = writeEst;
     estProvider->socketState = getEstState;
     mprAddSocketProvider("est", estProvider);
-    sessions = mprCreateList(0, 0);
 
     if ((defaultEstConfig = mprAllocObj(EstConfig, manageEstConfig)) == 0) {
         return MPR_ERR_MEMORY;
@@ -119,11 +113,9 @@ static void manageEstProvider(MprSocketProvider *provider, int flags)
     if (flags & MPR_MANAGE_MARK) {
         mprMark(provider->name);
         mprMark(defaultEstConfig);
-        mprMark(sessions);
 
     } else if (flags & MPR_MANAGE_FREE) {
         defaultEstConfig = 0;
-        sessions = 0;
     }
 }
 
@@ -514,60 +506,41 @@ static char *getEstState(MprSocket *sp)
 
 
 /*
-    Thread-safe session management
+    Session management via the process-wide, sharded session cache. Safe to call from any dispatcher thread.
  */
 static int getSession(ssl_context *ssl)
 {
-    ssl_session     *session;
+    ssl_session     session;
     time_t          t;
-    int             next;
 
+    if (!ssl->resume || ssl->session->length <= 0) {
+        return 1;
+    }
+    if (mprGetSslSession(ssl->session->id, ssl->session->length, &session, sizeof(session)) != sizeof(session)) {
+        return 1;
+    }
     t = time(NULL);
-    if (!ssl->resume) {
+    if (ssl->timeout && (t - session.start) > ssl->timeout) {
         return 1;
     }
-    for (ITERATE_ITEMS(sessions, session, next)) {
-        if (ssl->timeout && (t - session->start) > ssl->timeout) {
-            continue;
-        }
-        if (ssl->session->cipher != session->cipher || ssl->session->length != session->length) {
-            continue;
-        }
-        if (memcmp(ssl->session->id, session->id, session->length) != 0) {
-            continue;
-        }
-        memcpy(ssl->session->master, session->master, sizeof(ssl->session->master));
-        return 0;
+    if (ssl->session->cipher != session.cipher || ssl->session->length != session.length) {
+        return 1;
     }
-    return 1;
+    memcpy(ssl->session->master, session.master, sizeof(ssl->session->master));
+    return 0;
 }
 
 
 static int setSession(ssl_context *ssl)
 {
-    time_t          t;
-    ssl_session     *session;
-    int             next;
+    ssl_session     session;
 
-    t = time(NULL);
-    for (ITERATE_ITEMS(sessions, session, next)) {
-        if (ssl->timeout != 0 && (t - session->start) > ssl->timeout) {
-            /* expired, reuse this slot */
-            break;  
-        }
-        if (memcmp(ssl->session->id, session->id, session->length) == 0) {
-            /* client reconnected */
-            break;  
-        }
-    }
-    if (session == NULL) {
-        if ((session = mprAlloc(sizeof(ssl_session))) == 0) {
-            return 1;
-        }
-        mprAddItem(sessions, session);
+    if (ssl->session->length <= 0) {
+        return 1;
     }
-    memcpy(session, ssl->session, sizeof(ssl_session));
-    return 0;
+    memcpy(&session, ssl->session, sizeof(ssl_session));
+    session.next = 0;
+    return mprPutSslSession(session.id, session.length, &session, sizeof(session)) < 0;
 }
 
 
@@ -631,6 +604,11 @@ void estDummy() {}
  #include    <openssl/rand.h>
  #include    <openssl/err.h>
  #include    <openssl/dh.h>
+ #include    <openssl/hmac.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+ #include    <openssl/core_names.h>
+ #include    <openssl/params.h>
+#endif
 
 /************************************* Defines ********************************/
 
@@ -655,6 +633,40 @@ typedef struct RandBuf {
     int         pid;
 } RandBuf;
 
+/*
+    Session ticket keys. These are process-wide so tickets issued on one thread or SSL configuration can be
+    decrypted on any other. The previous key is retained so tickets survive one rotation.
+ */
+typedef struct TicketKey {
+    uchar       name[16];
+    uchar       aes[32];
+    uchar       hmac[32];
+    MprTicks    created;
+} TicketKey;
+
+static TicketKey ticketKeys[2];         /* Current and previous key */
+static MprMutex *ticketLock;
+
+/*
+    Maximum size of a DER encoded session saved in the session cache
+ */
+#define OSS_MAX_SESSION (ME_MAX_BUFFER * 2)
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+    #define OSS_SESSION_ID const uchar
+#else
+    #define OSS_SESSION_ID uchar
+#endif
+
+/*
+    OpenSSL 3.0 deprecates HMAC_CTX. Session ticket MACs then use EVP_MAC via SSL_CTX_set_tlsext_ticket_key_evp_cb.
+ */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    #define OSS_TICKET_MAC EVP_MAC_CTX
+#else
+    #define OSS_TICKET_MAC HMAC_CTX
+#endif
+
 static int      numLocks;
 static MprMutex **olocks;
 static MprSocketProvider *openProvider;
@@ -674,13 +686,19 @@ static OpenConfig *createOpenSslConfig(MprSocket *sp);
 static DH       *dhCallback(SSL *ssl, int isExport, int keyLength);
 static void     disconnectOss(MprSocket *sp);
 static ssize    flushOss(MprSocket *sp);
+static SSL_SESSION *getOssSession(SSL *handle, OSS_SESSION_ID *id, int idLen, int *copy);
 static char     *getOssState(MprSocket *sp);
 static char     *getOssError(MprSocket *sp);
 static void     manageOpenConfig(OpenConfig *cfg, int flags);
 static void     manageOpenProvider(MprSocketProvider *provider, int flags);
 static void     manageOpenSocket(OpenSocket *ssp, int flags);
 static ssize    readOss(MprSocket *sp, void *buf, ssize len);
+static void     removeOssSession(SSL_CTX *context, SSL_SESSION *session);
 static RSA      *rsaCallback(SSL *ssl, int isExport, int keyLength);
+static int      setOssSession(SSL *handle, SSL_SESSION *session);
+static int      initTicketMac(OSS_TICKET_MAC *hctx, uchar *key, int keyLen);
+static int      rotateTicketKeys();
+static int      ticketCallback(SSL *handle, uchar *name, uchar *iv, EVP_CIPHER_CTX *ectx, OSS_TICKET_MAC *hctx, int enc);
 static int      upgradeOss(MprSocket *sp, MprSsl *ssl, cchar *requiredPeerName);
 static int      verifyX509Certificate(int ok, X509_STORE_CTX *ctx);
 static ssize    writeOss(MprSocket *sp, cvoid *buf, ssize len);
@@ -721,6 +739,7 @@ PUBLIC int mprCreateOpenSslModule()
     openProvider->readSocket = readOss;
     openProvider->writeSocket = writeOss;
     mprAddSocketProvider("openssl", openProvider);
+    ticketLock = mprCreateLock();
 
     /*
         Pre-create expensive keys
@@ -810,9 +829,11 @@ static void manageOpenProvider(MprSocketProvider *provider, int flags)
         }
         mprMark(defaultOpenConfig);
         mprMark(provider->name);
+        mprMark(ticketLock);
 
     } else if (flags & MPR_MANAGE_FREE) {
         olocks = 0;
+        ticketLock = 0;
     }
 }
 
@@ -850,10 +871,18 @@ static OpenConfig *createOpenSslConfig(MprSocket *sp)
         return 0;
     }
     SSL_CTX_set_app_data(context, (void*) ssl);
-    SSL_CTX_sess_set_cache_size(context, 512);
     RAND_bytes(resume, sizeof(resume));
     SSL_CTX_set_session_id_context(context, resume, sizeof(resume));
 
+    /*
+        Use the process-wide, sharded MPR session cache instead of the per-context OpenSSL cache
+     */
+    SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+    SSL_CTX_sess_set_new_cb(context, setOssSession);
+    SSL_CTX_sess_set_get_cb(context, getOssSession);
+    SSL_CTX_sess_set_remove_cb(context, removeOssSession);
+    SSL_CTX_set_timeout(context, ME_MPR_SSL_TIMEOUT / TPS);
+
     if (ssl->verifyPeer && !(ssl->caFile || ssl->caPath)) {
         sp->errorMsg = sfmt("Cannot verify peer due to undefined CA certificates");
         SSL_CTX_free(context);
@@ -913,9 +942,18 @@ static OpenConfig *createOpenSslConfig(MprSocket *sp)
     SSL_CTX_set_tmp_dh_callback(context, dhCallback);
 
     SSL_CTX_set_options(context, SSL_OP_ALL);
+    if (sp->flags & MPR_SOCKET_SERVER) {
+        /* Issue session tickets using the shared, rotating ticket keys */
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+        SSL_CTX_set_tlsext_ticket_key_evp_cb(context, ticketCallback);
+#else
+        SSL_CTX_set_tlsext_ticket_key_cb(context, ticketCallback);
+#endif
+    } else {
 #ifdef SSL_OP_NO_TICKET
-    SSL_CTX_set_options(context, SSL_OP_NO_TICKET);
+        SSL_CTX_set_options(context, SSL_OP_NO_TICKET);
 #endif
+    }
 #ifdef SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION
     SSL_CTX_set_options(context, SSL_OP_NO_SESSION_RESUMPTION_ON_RENEGOTIATION);
 #endif
@@ -1468,6 +1506,146 @@ static ssize flushOss(MprSocket *sp)
 }
 
  
+/*
+    Save a new server session in the MPR session cache
+ */
+static int setOssSession(SSL *handle, SSL_SESSION *session)
+{
+    uchar       buf[OSS_MAX_SESSION], *bp;
+    cuchar      *id;
+    uint        idLen;
+    int         len;
+
+    id = SSL_SESSION_get_id(session, &idLen);
+    if ((len = i2d_SSL_SESSION(session, NULL)) <= 0 || len > sizeof(buf)) {
+        return 0;
+    }
+    bp = buf;
+    i2d_SSL_SESSION(session, &bp);
+    mprPutSslSession(id, idLen, buf, len);
+    /* Zero indicates the session reference was not retained */
+    return 0;
+}
+
+
+static SSL_SESSION *getOssSession(SSL *handle, OSS_SESSION_ID *id, int idLen, int *copy)
+{
+    uchar       buf[OSS_MAX_SESSION];
+    cuchar      *bp;
+    ssize       len;
+
+    *copy = 0;
+    if ((len = mprGetSslSession(id, idLen, buf, sizeof(buf))) <= 0) {
+        return 0;
+    }
+    bp = buf;
+    return d2i_SSL_SESSION(NULL, &bp, (long) len);
+}
+
+
+static void removeOssSession(SSL_CTX *context, SSL_SESSION *session)
+{
+    cuchar      *id;
+    uint        idLen;
+
+    id = SSL_SESSION_get_id(session, &idLen);
+    mprRemoveSslSession(id, idLen);
+}
+
+
+/*
+    Rotate the session ticket keys when the current key is older than ME_MPR_SSL_TICKET_ROTATE.
+    Must be called with ticketLock held.
+ */
+static int rotateTicketKeys()
+{
+    TicketKey   *key;
+    MprTicks    now;
+
+    now = mprGetTicks();
+    key = &ticketKeys[0];
+    if (key->created && (now - key->created) < ME_MPR_SSL_TICKET_ROTATE) {
+        return 0;
+    }
+    ticketKeys[1] = ticketKeys[0];
+    if (RAND_bytes(key->name, sizeof(key->name)) <= 0 || RAND_bytes(key->aes, sizeof(key->aes)) <= 0 ||
+            RAND_bytes(key->hmac, sizeof(key->hmac)) <= 0) {
+        key->created = 0;
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    key->created = now;
+    return 0;
+}
+
+
+/*
+    Initialize the ticket MAC with a SHA256 HMAC key
+ */
+static int initTicketMac(OSS_TICKET_MAC *hctx, uchar *key, int keyLen)
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    OSSL_PARAM  params[2];
+
+    params[0] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, (char*) "SHA256", 0);
+    params[1] = OSSL_PARAM_construct_end();
+    return EVP_MAC_init(hctx, key, keyLen, params) ? 0 : MPR_ERR_CANT_INITIALIZE;
+#else
+    return HMAC_Init_ex(hctx, key, keyLen, EVP_sha256(), NULL) ? 0 : MPR_ERR_CANT_INITIALIZE;
+#endif
+}
+
+
+/*
+    Encrypt or decrypt session tickets. Return 1 for success, 2 if the ticket should be renewed with the current key,
+    0 if the ticket key is unknown (full handshake) and -1 for errors.
+ */
+static int ticketCallback(SSL *handle, uchar *name, uchar *iv, EVP_CIPHER_CTX *ectx, OSS_TICKET_MAC *hctx, int enc)
+{
+    TicketKey   key;
+    int         i, rc;
+
+    mprLock(ticketLock);
+    if (rotateTicketKeys() < 0) {
+        mprUnlock(ticketLock);
+        return -1;
+    }
+    if (enc) {
+        key = ticketKeys[0];
+        mprUnlock(ticketLock);
+        if (RAND_bytes(iv, EVP_MAX_IV_LENGTH) <= 0) {
+            return -1;
+        }
+        memcpy(name, key.name, sizeof(key.name));
+        if (!EVP_EncryptInit_ex(ectx, EVP_aes_256_cbc(), NULL, key.aes, iv) ||
+                initTicketMac(hctx, key.hmac, sizeof(key.hmac)) < 0) {
+            rc = -1;
+        } else {
+            rc = 1;
+        }
+    } else {
+        for (i = 0; i < 2; i++) {
+            if (ticketKeys[i].created && memcmp(name, ticketKeys[i].name, sizeof(ticketKeys[i].name)) == 0) {
+                break;
+            }
+        }
+        if (i >= 2) {
+            mprUnlock(ticketLock);
+            return 0;
+        }
+        key = ticketKeys[i];
+        mprUnlock(ticketLock);
+        if (initTicketMac(hctx, key.hmac, sizeof(key.hmac)) < 0 ||
+                !EVP_DecryptInit_ex(ectx, EVP_aes_256_cbc(), NULL, key.aes, iv)) {
+            rc = -1;
+        } else {
+            rc = (i == 0) ? 1 : 2;
+        }
+    }
+    memset(&key, 0, sizeof(key));
+    return rc;
+}
+
+
 static ulong sslThreadId()
 {
     return (long) mprGetCurrentOsThread();
@@ -1772,6 +1950,36 @@ MprCipher mprCiphers[] = {
     { 0x0, 0 },
 };
 
+/*
+    Process-wide TLS session cache shared by all SSL configurations and dispatcher threads.
+    Sessions are sharded by session ID and each shard has its own lock.
+ */
+typedef struct SslShard {
+    MprMutex    *mutex;
+    MprHash     *sessions;              /* Hex session ID => SslSession */
+} SslShard;
+
+typedef struct SslCache {
+    SslShard    shards[ME_MPR_SSL_CACHE_SHARDS];
+    int         limit;                  /* Maximum sessions per shard */
+} SslCache;
+
+typedef struct SslSession {
+    MprTicks    expires;                /* When the session expires */
+    ssize       len;                    /* Length of data */
+    char        *data;                  /* Provider session state */
+} SslSession;
+
+static SslCache *sessionCache;
+
+/********************************** Forwards **********************************/
+
+static SslShard *getShard(cvoid *id, ssize idLen, char *key, ssize keySize);
+#if ME_COM_SSL
+static void manageSslCache(SslCache *cache, int flags);
+#endif
+static void manageSslSession(SslSession *session, int flags);
+
 /************************************ Code ************************************/
 /*
     Module initialization entry point
@@ -1779,8 +1987,22 @@ MprCipher mprCiphers[] = {
 PUBLIC int mprSslInit(void *unused, MprModule *module)
 {
 #if ME_COM_SSL
+    SslShard    *shard;
+    int         i;
+
     assert(module);
 
+    if ((sessionCache = mprAllocObj(SslCache, manageSslCache)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    sessionCache->limit = max(ME_MPR_SSL_CACHE / ME_MPR_SSL_CACHE_SHARDS, 1);
+    for (i = 0; i < ME_MPR_SSL_CACHE_SHARDS; i++) {
+        shard = &sessionCache->shards[i];
+        shard->mutex = mprCreateLock();
+        shard->sessions = mprCreateHash(0, 0);
+    }
+    mprAddRoot(sessionCache);
+
     /*
         Order matters. The last enabled stack becomes the default.
      */
@@ -1840,6 +2062,143 @@ PUBLIC int mprGetSslCipherCode(cchar *cipher)
     return 0;
 }
 
+
+#if ME_COM_SSL
+static void manageSslCache(SslCache *cache, int flags)
+{
+    int     i;
+
+    if (flags & MPR_MANAGE_MARK) {
+        for (i = 0; i < ME_MPR_SSL_CACHE_SHARDS; i++) {
+            mprMark(cache->shards[i].mutex);
+            mprMark(cache->shards[i].sessions);
+        }
+    }
+}
+#endif
+
+
+static void manageSslSession(SslSession *session, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(session->data);
+    }
+}
+
+
+/*
+    Select the shard for a session ID and format the ID as a hash key
+ */
+static SslShard *getShard(cvoid *id, ssize idLen, char *key, ssize keySize)
+{
+    static cchar    hex[] = "0123456789abcdef";
+    cuchar          *cp;
+    uint            hash;
+    ssize           i;
+
+    if (!sessionCache || !id || idLen <= 0 || (idLen * 2) >= keySize) {
+        return 0;
+    }
+    /* FNV-1a */
+    hash = 2166136261U;
+    for (i = 0, cp = id; i < idLen; i++) {
+        hash = (hash ^ cp[i]) * 16777619U;
+        key[i * 2] = hex[cp[i] >> 4];
+        key[i * 2 + 1] = hex[cp[i] & 0xf];
+    }
+    key[idLen * 2] = '\0';
+    return &sessionCache->shards[hash % ME_MPR_SSL_CACHE_SHARDS];
+}
+
+
+PUBLIC ssize mprGetSslSession(cvoid *id, ssize idLen, void *buf, ssize bufsize)
+{
+    SslShard    *shard;
+    SslSession  *session;
+    char        key[ME_MAX_BUFFER / 16];
+    ssize       len;
+
+    if ((shard = getShard(id, idLen, key, sizeof(key))) == 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    len = MPR_ERR_CANT_FIND;
+    lock(shard);
+    if ((session = mprLookupKey(shard->sessions, key)) != 0) {
+        if (session->expires <= mprGetTicks()) {
+            mprRemoveKey(shard->sessions, key);
+        } else if (session->len > bufsize) {
+            len = MPR_ERR_WONT_FIT;
+        } else {
+            memcpy(buf, session->data, session->len);
+            len = session->len;
+        }
+    }
+    unlock(shard);
+    return len;
+}
+
+
+PUBLIC int mprPutSslSession(cvoid *id, ssize idLen, cvoid *data, ssize len)
+{
+    SslShard    *shard;
+    SslSession  *session, *sp, *oldest;
+    MprKey      *kp, *victim;
+    MprTicks    now;
+    char        key[ME_MAX_BUFFER / 16];
+
+    if ((shard = getShard(id, idLen, key, sizeof(key))) == 0 || !data || len <= 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    if ((session = mprAllocObj(SslSession, manageSslSession)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    if ((session->data = mprMemdup(data, len)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    now = mprGetTicks();
+    session->len = len;
+    session->expires = now + ME_MPR_SSL_TIMEOUT;
+
+    lock(shard);
+    if (!mprLookupKey(shard->sessions, key) && mprGetHashLength(shard->sessions) >= sessionCache->limit) {
+        /*
+            Shard is full. Prune expired sessions, or failing that, the session closest to expiry.
+         */
+        oldest = 0;
+        victim = 0;
+        for (ITERATE_KEYS(shard->sessions, kp)) {
+            sp = (SslSession*) kp->data;
+            if (sp->expires <= now) {
+                victim = kp;
+                break;
+            }
+            if (!oldest || sp->expires < oldest->expires) {
+                oldest = sp;
+                victim = kp;
+            }
+        }
+        if (victim) {
+            mprRemoveKey(shard->sessions, victim->key);
+        }
+    }
+    mprAddKey(shard->sessions, key, session);
+    unlock(shard);
+    return 0;
+}
+
+
+PUBLIC void mprRemoveSslSession(cvoid *id, ssize idLen)
+{
+    SslShard    *shard;
+    char        key[ME_MAX_BUFFER / 16];
+
+    if ((shard = getShard(id, idLen, key, sizeof(key))) != 0) {
+        lock(shard);
+        mprRemoveKey(shard->sessions, key);
+        unlock(shard);
+    }
+}
+
 /*
     @copy   default
 
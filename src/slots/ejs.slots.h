@@ -150,26 +150,29 @@
 #define ES_setTimeout                                                  126
 #define ES_clearTimeout                                                127
 #define ES_Type                                                        128
-#define ES_Uri                                                         129
-#define ES_decodeURI                                                   130
-#define ES_decodeURIComponent                                          131
-#define ES_encodeURI                                                   132
-#define ES_encodeURIComponent                                          133
-#define ES_encodeObjects                                               134
-#define ES_Void                                                        135
-#define ES_WebSocket                                                   136
-#define ES_Worker                                                      137
-#define ES_Event                                                       138
-#define ES_ErrorEvent                                                  139
-#define ES_ejs_worker_self                                             140
-#define ES_ejs_worker_exit                                             141
-#define ES_ejs_worker_postMessage                                      142
-#define ES_ejs_worker_onerror                                          143
-#define ES_ejs_worker_onmessage                                        144
-#define ES_XML                                                         145
-#define ES_XMLHttp                                                     146
-#define ES_XMLList                                                     147
-#define ES_global_NUM_CLASS_PROP                                       148
+#define ES_Float64Array                                                129
+#define ES_Int32Array                                                  130
+#define ES_Uint8Array                                                  131
+#define ES_Uri                                                         132
+#define ES_decodeURI                                                   133
+#define ES_decodeURIComponent                                          134
+#define ES_encodeURI                                                   135
+#define ES_encodeURIComponent                                          136
+#define ES_encodeObjects                                               137
+#define ES_Void                                                        138
+#define ES_WebSocket                                                   139
+#define ES_Worker                                                      140
+#define ES_Event                                                       141
+#define ES_ErrorEvent                                                  142
+#define ES_ejs_worker_self                                             143
+#define ES_ejs_worker_exit                                             144
+#define ES_ejs_worker_postMessage                                      145
+#define ES_ejs_worker_onerror                                          146
+#define ES_ejs_worker_onmessage                                        147
+#define ES_XML                                                         148
+#define ES_XMLHttp                                                     149
+#define ES_XMLList                                                     150
+#define ES_global_NUM_CLASS_PROP                                       151
 
 /*
    Prototype (instance) slots for "global" type 
@@ -2123,6 +2126,90 @@
 #define ES_Type_NUM_INHERITED_PROP                                     0
 
 
+/*
+    Class property slots for the "Float64Array" type 
+ */
+#define ES_Float64Array__initializer___Float64Array_                   0
+#define ES_Float64Array_BYTES_PER_ELEMENT                              1
+#define ES_Float64Array_NUM_CLASS_PROP                                 2
+
+/*
+   Prototype (instance) slots for "Float64Array" type 
+ */
+#define ES_Float64Array_buffer                                         0
+#define ES_Float64Array_byteLength                                     1
+#define ES_Float64Array_byteOffset                                     2
+#define ES_Float64Array_copyWithin                                     3
+#define ES_Float64Array_fill                                           4
+#define ES_Float64Array_iterator_get                                   5
+#define ES_Float64Array_iterator_getValues                             6
+#define ES_Float64Array_length                                         7
+#define ES_Float64Array_map                                            8
+#define ES_Float64Array_max                                            9
+#define ES_Float64Array_min                                            10
+#define ES_Float64Array_sum                                            11
+#define ES_Float64Array_toArray                                        12
+#define ES_Float64Array_toString                                       13
+#define ES_Float64Array_NUM_INSTANCE_PROP                              14
+#define ES_Float64Array_NUM_INHERITED_PROP                             0
+
+
+/*
+    Class property slots for the "Int32Array" type 
+ */
+#define ES_Int32Array__initializer___Int32Array_                       0
+#define ES_Int32Array_BYTES_PER_ELEMENT                                1
+#define ES_Int32Array_NUM_CLASS_PROP                                   2
+
+/*
+   Prototype (instance) slots for "Int32Array" type 
+ */
+#define ES_Int32Array_buffer                                           0
+#define ES_Int32Array_byteLength                                       1
+#define ES_Int32Array_byteOffset                                       2
+#define ES_Int32Array_copyWithin                                       3
+#define ES_Int32Array_fill                                             4
+#define ES_Int32Array_iterator_get                                     5
+#define ES_Int32Array_iterator_getValues                               6
+#define ES_Int32Array_length                                           7
+#define ES_Int32Array_map                                              8
+#define ES_Int32Array_max                                              9
+#define ES_Int32Array_min                                              10
+#define ES_Int32Array_sum                                              11
+#define ES_Int32Array_toArray                                          12
+#define ES_Int32Array_toString                                         13
+#define ES_Int32Array_NUM_INSTANCE_PROP                                14
+#define ES_Int32Array_NUM_INHERITED_PROP                               0
+
+
+/*
+    Class property slots for the "Uint8Array" type 
+ */
+#define ES_Uint8Array__initializer___Uint8Array_                       0
+#define ES_Uint8Array_BYTES_PER_ELEMENT                                1
+#define ES_Uint8Array_NUM_CLASS_PROP                                   2
+
+/*
+   Prototype (instance) slots for "Uint8Array" type 
+ */
+#define ES_Uint8Array_buffer                                           0
+#define ES_Uint8Array_byteLength                                       1
+#define ES_Uint8Array_byteOffset                                       2
+#define ES_Uint8Array_copyWithin                                       3
+#define ES_Uint8Array_fill                                             4
+#define ES_Uint8Array_iterator_get                                     5
+#define ES_Uint8Array_iterator_getValues                               6
+#define ES_Uint8Array_length                                           7
+#define ES_Uint8Array_map                                              8
+#define ES_Uint8Array_max                                              9
+#define ES_Uint8Array_min                                              10
+#define ES_Uint8Array_sum                                              11
+#define ES_Uint8Array_toArray                                          12
+#define ES_Uint8Array_toString                                         13
+#define ES_Uint8Array_NUM_INSTANCE_PROP                                14
+#define ES_Uint8Array_NUM_INHERITED_PROP                               0
+
+
 /*
     Class property slots for the "Uri" type 
  */
@@ -2426,6 +2513,6 @@
 #define ES_XMLList_NUM_INSTANCE_PROP                                   20
 #define ES_XMLList_NUM_INHERITED_PROP                                  0
 
-#define _ES_CHECKSUM_ejs   1547590
+#define _ES_CHECKSUM_ejs   1607333
 
 #endif
@@ -3,7 +3,7 @@
   
    This file is generated by ejsmod
   
-   Slot definitions. Version 2.5.0.
+   Slot definitions. Version 2.5.2.
  */
 
 #ifndef _h_SLOTS_EjsWebSlots
@@ -92,54 +92,53 @@
 #define ES_ejs_web_Controller_ejs_web_cacheIndex                       8
 #define ES_ejs_web_Controller_ejs_web_cacheOptions                     9
 #define ES_ejs_web_Controller_ejs_web_cacheName                        10
-#define ES_ejs_web_Controller_ejs_web_cacheItem                        11
-#define ES_ejs_web_Controller_ejs_web_absHome                          12
-#define ES_ejs_web_Controller_ejs_web_home                             13
-#define ES_ejs_web_Controller_ejs_web_pathInfo                         14
-#define ES_ejs_web_Controller_ejs_web_session                          15
-#define ES_ejs_web_Controller_ejs_web_uri                              16
-#define ES_ejs_web_Controller_ejs_web_after                            17
-#define ES_ejs_web_Controller_cacheTag                                 18
-#define ES_ejs_web_Controller_fetchCachedResponse                      19
-#define ES_ejs_web_Controller_saveCachedResponse                       20
-#define ES_ejs_web_Controller_ejs_web_writeCached                      21
-#define ES_ejs_web_Controller_ejs_web_app                              22
-#define ES_ejs_web_Controller_ejs_web_autoFinalize                     23
-#define ES_ejs_web_Controller_ejs_web_autoFinalizing                   24
-#define ES_ejs_web_Controller_ejs_web_before                           25
-#define ES_ejs_web_Controller_ejs_web_clearFlash                       26
-#define ES_ejs_web_Controller_getCacheName                             27
-#define ES_ejs_web_Controller_ejs_web_dontAutoFinalize                 28
-#define ES_ejs_web_Controller_ejs_web_error                            29
-#define ES_ejs_web_Controller_ejs_web_finalize                         30
-#define ES_ejs_web_Controller_ejs_web_finalized                        31
-#define ES_ejs_web_Controller_ejs_web_flash                            32
-#define ES_ejs_web_Controller_ejs_web_flush                            33
-#define ES_ejs_web_Controller_ejs_web_header                           34
-#define ES_ejs_web_Controller_ejs_web_inform                           35
-#define ES_ejs_web_Controller_ejs_web_link                             36
-#define ES_ejs_web_Controller_action_missing                           37
-#define ES_ejs_web_Controller_ejs_web_notify                           38
-#define ES_ejs_web_Controller_ejs_web_on                               39
-#define ES_ejs_web_Controller_ejs_web_read                             40
-#define ES_ejs_web_Controller_ejs_web_redirect                         41
-#define ES_ejs_web_Controller_ejs_web_removeCheckers                   42
-#define ES_ejs_web_Controller_ejs_web_setHeader                        43
-#define ES_ejs_web_Controller_ejs_web_setHeaders                       44
-#define ES_ejs_web_Controller_ejs_web_setStatus                        45
-#define ES_ejs_web_Controller_ejs_web_write                            46
-#define ES_ejs_web_Controller_ejs_web_warn                             47
-#define ES_ejs_web_Controller_ejs_web_writeContent                     48
-#define ES_ejs_web_Controller_ejs_web_writeError                       49
-#define ES_ejs_web_Controller_ejs_web_writeFile                        50
-#define ES_ejs_web_Controller_ejs_web_writePartialTemplate             51
-#define ES_ejs_web_Controller_ejs_web_writeView                        52
-#define ES_ejs_web_Controller_ejs_web_writeTemplate                    53
-#define ES_ejs_web_Controller_ejs_web_writeTemplateLiteral             54
-#define ES_ejs_web_Controller_checkSecurityToken                       55
-#define ES_ejs_web_Controller_runCheckers                              56
-#define ES_ejs_web_Controller_viewExists                               57
-#define ES_ejs_web_Controller_NUM_INSTANCE_PROP                        58
+#define ES_ejs_web_Controller_ejs_web_absHome                          11
+#define ES_ejs_web_Controller_ejs_web_home                             12
+#define ES_ejs_web_Controller_ejs_web_pathInfo                         13
+#define ES_ejs_web_Controller_ejs_web_session                          14
+#define ES_ejs_web_Controller_ejs_web_uri                              15
+#define ES_ejs_web_Controller_ejs_web_after                            16
+#define ES_ejs_web_Controller_directCache                              17
+#define ES_ejs_web_Controller_fetchCachedResponse                      18
+#define ES_ejs_web_Controller_saveCachedResponse                       19
+#define ES_ejs_web_Controller_ejs_web_writeCached                      20
+#define ES_ejs_web_Controller_ejs_web_app                              21
+#define ES_ejs_web_Controller_ejs_web_autoFinalize                     22
+#define ES_ejs_web_Controller_ejs_web_autoFinalizing                   23
+#define ES_ejs_web_Controller_ejs_web_before                           24
+#define ES_ejs_web_Controller_ejs_web_clearFlash                       25
+#define ES_ejs_web_Controller_getCacheName                             26
+#define ES_ejs_web_Controller_ejs_web_dontAutoFinalize                 27
+#define ES_ejs_web_Controller_ejs_web_error                            28
+#define ES_ejs_web_Controller_ejs_web_finalize                         29
+#define ES_ejs_web_Controller_ejs_web_finalized                        30
+#define ES_ejs_web_Controller_ejs_web_flash                            31
+#define ES_ejs_web_Controller_ejs_web_flush                            32
+#define ES_ejs_web_Controller_ejs_web_header                           33
+#define ES_ejs_web_Controller_ejs_web_inform                           34
+#define ES_ejs_web_Controller_ejs_web_link                             35
+#define ES_ejs_web_Controller_action_missing                           36
+#define ES_ejs_web_Controller_ejs_web_notify                           37
+#define ES_ejs_web_Controller_ejs_web_on                               38
+#define ES_ejs_web_Controller_ejs_web_read                             39
+#define ES_ejs_web_Controller_ejs_web_redirect                         40
+#define ES_ejs_web_Controller_ejs_web_removeCheckers                   41
+#define ES_ejs_web_Controller_ejs_web_setHeader                        42
+#define ES_ejs_web_Controller_ejs_web_setHeaders                       43
+#define ES_ejs_web_Controller_ejs_web_setStatus                        44
+#define ES_ejs_web_Controller_ejs_web_write                            45
+#define ES_ejs_web_Controller_ejs_web_warn                             46
+#define ES_ejs_web_Controller_ejs_web_writeContent                     47
+#define ES_ejs_web_Controller_ejs_web_writeError                       48
+#define ES_ejs_web_Controller_ejs_web_writeFile                        49
+#define ES_ejs_web_Controller_ejs_web_writePartialTemplate             50
+#define ES_ejs_web_Controller_ejs_web_writeView                        51
+#define ES_ejs_web_Controller_ejs_web_writeTemplate                    52
+#define ES_ejs_web_Controller_ejs_web_writeTemplateLiteral             53
+#define ES_ejs_web_Controller_checkSecurityToken                       54
+#define ES_ejs_web_Controller_runCheckers                              55
+#define ES_ejs_web_Controller_viewExists                               56
+#define ES_ejs_web_Controller_NUM_INSTANCE_PROP                        57
 #define ES_ejs_web_Controller_NUM_INHERITED_PROP                       0
 
 /*
@@ -229,43 +228,45 @@
 #define ES_ejs_web_HttpServer_idleWorkers                              0
 #define ES_ejs_web_HttpServer_activeWorkers                            1
 #define ES_ejs_web_HttpServer_workerImage                              2
-#define ES_ejs_web_HttpServer_address                                  3
-#define ES_ejs_web_HttpServer_async                                    4
-#define ES_ejs_web_HttpServer_config                                   5
-#define ES_ejs_web_HttpServer_documents                                6
-#define ES_ejs_web_HttpServer_hostedDocuments                          7
-#define ES_ejs_web_HttpServer_hostedHome                               8
-#define ES_ejs_web_HttpServer_isSecure                                 9
-#define ES_ejs_web_HttpServer_hosted                                   10
-#define ES_ejs_web_HttpServer_limits                                   11
-#define ES_ejs_web_HttpServer_name                                     12
-#define ES_ejs_web_HttpServer_options                                  13
-#define ES_ejs_web_HttpServer_port                                     14
-#define ES_ejs_web_HttpServer_onrequest                                15
-#define ES_ejs_web_HttpServer_defaultOnRequest                         16
-#define ES_ejs_web_HttpServer_home                                     17
-#define ES_ejs_web_HttpServer_software                                 18
-#define ES_ejs_web_HttpServer_openSession                              19
-#define ES_ejs_web_HttpServer_accept                                   20
-#define ES_ejs_web_HttpServer_close                                    21
-#define ES_ejs_web_HttpServer_getWorker                                22
-#define ES_ejs_web_HttpServer_listen                                   23
-#define ES_ejs_web_HttpServer_off                                      24
-#define ES_ejs_web_HttpServer_on                                       25
-#define ES_ejs_web_HttpServer_passRequest                              26
-#define ES_ejs_web_HttpServer_process                                  27
-#define ES_ejs_web_HttpServer_processBody                              28
-#define ES_ejs_web_HttpServer_pruneWorkers                             29
-#define ES_ejs_web_HttpServer_releaseWorker                            30
-#define ES_ejs_web_HttpServer_run                                      31
-#define ES_ejs_web_HttpServer_secure                                   32
-#define ES_ejs_web_HttpServer_serve                                    33
-#define ES_ejs_web_HttpServer_setPipeline                              34
-#define ES_ejs_web_HttpServer_setLimits                                35
-#define ES_ejs_web_HttpServer_setWorkerImage                           36
-#define ES_ejs_web_HttpServer_trace                                    37
-#define ES_ejs_web_HttpServer_verifyClients                            38
-#define ES_ejs_web_HttpServer_NUM_INSTANCE_PROP                        39
+#define ES_ejs_web_HttpServer_acceptors                                3
+#define ES_ejs_web_HttpServer_address                                  4
+#define ES_ejs_web_HttpServer_async                                    5
+#define ES_ejs_web_HttpServer_config                                   6
+#define ES_ejs_web_HttpServer_documents                                7
+#define ES_ejs_web_HttpServer_hostedDocuments                          8
+#define ES_ejs_web_HttpServer_hostedHome                               9
+#define ES_ejs_web_HttpServer_isSecure                                 10
+#define ES_ejs_web_HttpServer_hosted                                   11
+#define ES_ejs_web_HttpServer_limits                                   12
+#define ES_ejs_web_HttpServer_name                                     13
+#define ES_ejs_web_HttpServer_options                                  14
+#define ES_ejs_web_HttpServer_port                                     15
+#define ES_ejs_web_HttpServer_onrequest                                16
+#define ES_ejs_web_HttpServer_defaultOnRequest                         17
+#define ES_ejs_web_HttpServer_home                                     18
+#define ES_ejs_web_HttpServer_software                                 19
+#define ES_ejs_web_HttpServer_openSession                              20
+#define ES_ejs_web_HttpServer_openCompression                          21
+#define ES_ejs_web_HttpServer_accept                                   22
+#define ES_ejs_web_HttpServer_close                                    23
+#define ES_ejs_web_HttpServer_getWorker                                24
+#define ES_ejs_web_HttpServer_listen                                   25
+#define ES_ejs_web_HttpServer_off                                      26
+#define ES_ejs_web_HttpServer_on                                       27
+#define ES_ejs_web_HttpServer_passRequest                              28
+#define ES_ejs_web_HttpServer_process                                  29
+#define ES_ejs_web_HttpServer_processBody                              30
+#define ES_ejs_web_HttpServer_pruneWorkers                             31
+#define ES_ejs_web_HttpServer_releaseWorker                            32
+#define ES_ejs_web_HttpServer_run                                      33
+#define ES_ejs_web_HttpServer_secure                                   34
+#define ES_ejs_web_HttpServer_serve                                    35
+#define ES_ejs_web_HttpServer_setPipeline                              36
+#define ES_ejs_web_HttpServer_setLimits                                37
+#define ES_ejs_web_HttpServer_setWorkerImage                           38
+#define ES_ejs_web_HttpServer_trace                                    39
+#define ES_ejs_web_HttpServer_verifyClients                            40
+#define ES_ejs_web_HttpServer_NUM_INSTANCE_PROP                        41
 #define ES_ejs_web_HttpServer_NUM_INHERITED_PROP                       0
 
 /*
@@ -311,8 +312,9 @@
  */
 #define ES_ejs_web_Request__initializer___Request_                     0
 #define ES_ejs_web_Request_SecurityTokenName                           1
-#define ES_ejs_web_Request_jsgi                                        2
-#define ES_ejs_web_Request_NUM_CLASS_PROP                              3
+#define ES_ejs_web_Request_updateCachedOutput                          2
+#define ES_ejs_web_Request_jsgi                                        3
+#define ES_ejs_web_Request_NUM_CLASS_PROP                              4
 
 /*
    Prototype (instance) slots for "Request" type 
@@ -367,53 +369,63 @@
 #define ES_ejs_web_Request_writeBuffer                                 47
 #define ES_ejs_web_Request_async                                       48
 #define ES_ejs_web_Request_autoFinalize                                49
-#define ES_ejs_web_Request_close                                       50
-#define ES_ejs_web_Request_checkSecurityToken                          51
-#define ES_ejs_web_Request_clearFlash                                  52
-#define ES_ejs_web_Request_createSession                               53
-#define ES_ejs_web_Request_dontAutoFinalize                            54
-#define ES_ejs_web_Request_destroySession                              55
-#define ES_ejs_web_Request_error                                       56
-#define ES_ejs_web_Request_extension                                   57
-#define ES_ejs_web_Request_finalize                                    58
-#define ES_ejs_web_Request_finalized                                   59
-#define ES_ejs_web_Request_finalizeFlash                               60
-#define ES_ejs_web_Request_flush                                       61
-#define ES_ejs_web_Request_header                                      62
-#define ES_ejs_web_Request_inform                                      63
-#define ES_ejs_web_Request_link                                        64
-#define ES_ejs_web_Request_matchContent                                65
-#define ES_ejs_web_Request_notify                                      66
-#define ES_ejs_web_Request_off                                         67
-#define ES_ejs_web_Request_on                                          68
-#define ES_ejs_web_Request_read                                        69
-#define ES_ejs_web_Request_redirect                                    70
-#define ES_ejs_web_Request_securityToken                               71
-#define ES_ejs_web_Request_setCookie                                   72
-#define ES_ejs_web_Request_setHeader                                   73
-#define ES_ejs_web_Request_setHeaders                                  74
-#define ES_ejs_web_Request_setLimits                                   75
-#define ES_ejs_web_Request_setLocation                                 76
-#define ES_ejs_web_Request_setStatus                                   77
-#define ES_ejs_web_Request_setupFlash                                  78
-#define ES_ejs_web_Request_show                                        79
-#define ES_ejs_web_Request_showRequest                                 80
-#define ES_ejs_web_Request_trace                                       81
-#define ES_ejs_web_Request_warn                                        82
-#define ES_ejs_web_Request_write                                       83
-#define ES_ejs_web_Request_writeContent                                84
-#define ES_ejs_web_Request_writeError                                  85
-#define ES_ejs_web_Request_writeFile                                   86
-#define ES_ejs_web_Request_writeResponse                               87
-#define ES_ejs_web_Request_writeSafe                                   88
-#define ES_ejs_web_Request_written                                     89
-#define ES_ejs_web_Request_env                                         90
-#define ES_ejs_web_Request_input                                       91
-#define ES_ejs_web_Request_queryString                                 92
-#define ES_ejs_web_Request_serverPort                                  93
-#define ES_ejs_web_Request_NUM_INSTANCE_PROP                           94
+#define ES_ejs_web_Request_cacheOutput                                 50
+#define ES_ejs_web_Request_close                                       51
+#define ES_ejs_web_Request_checkSecurityToken                          52
+#define ES_ejs_web_Request_clearFlash                                  53
+#define ES_ejs_web_Request_createSession                               54
+#define ES_ejs_web_Request_dontAutoFinalize                            55
+#define ES_ejs_web_Request_destroySession                              56
+#define ES_ejs_web_Request_error                                       57
+#define ES_ejs_web_Request_extension                                   58
+#define ES_ejs_web_Request_fileInfo                                    59
+#define ES_ejs_web_Request_finalize                                    60
+#define ES_ejs_web_Request_finalized                                   61
+#define ES_ejs_web_Request_finalizeFlash                               62
+#define ES_ejs_web_Request_flush                                       63
+#define ES_ejs_web_Request_header                                      64
+#define ES_ejs_web_Request_inform                                      65
+#define ES_ejs_web_Request_link                                        66
+#define ES_ejs_web_Request_matchContent                                67
+#define ES_ejs_web_Request_notify                                      68
+#define ES_ejs_web_Request_off                                         69
+#define ES_ejs_web_Request_on                                          70
+#define ES_ejs_web_Request_read                                        71
+#define ES_ejs_web_Request_redirect                                    72
+#define ES_ejs_web_Request_securityToken                               73
+#define ES_ejs_web_Request_setCookie                                   74
+#define ES_ejs_web_Request_setHeader                                   75
+#define ES_ejs_web_Request_setHeaders                                  76
+#define ES_ejs_web_Request_setLimits                                   77
+#define ES_ejs_web_Request_setLocation                                 78
+#define ES_ejs_web_Request_setStatus                                   79
+#define ES_ejs_web_Request_setupFlash                                  80
+#define ES_ejs_web_Request_show                                        81
+#define ES_ejs_web_Request_showRequest                                 82
+#define ES_ejs_web_Request_trace                                       83
+#define ES_ejs_web_Request_warn                                        84
+#define ES_ejs_web_Request_write                                       85
+#define ES_ejs_web_Request_writeContent                                86
+#define ES_ejs_web_Request_writeError                                  87
+#define ES_ejs_web_Request_writeFile                                   88
+#define ES_ejs_web_Request_writeCachedOutput                           89
+#define ES_ejs_web_Request_writeResponse                               90
+#define ES_ejs_web_Request_writeSafe                                   91
+#define ES_ejs_web_Request_written                                     92
+#define ES_ejs_web_Request_env                                         93
+#define ES_ejs_web_Request_input                                       94
+#define ES_ejs_web_Request_queryString                                 95
+#define ES_ejs_web_Request_serverPort                                  96
+#define ES_ejs_web_Request_NUM_INSTANCE_PROP                           97
 #define ES_ejs_web_Request_NUM_INHERITED_PROP                          0
 
+/*
+    Local slots for methods in type "Request" 
+ */
+#define ES_ejs_web_Request_updateCachedOutput_name                     0
+#define ES_ejs_web_Request_updateCachedOutput_data                     1
+#define ES_ejs_web_Request_updateCachedOutput_options                  2
+
 
 /*
     Class property slots for the "Router" type 
@@ -432,25 +444,32 @@
 #define ES_ejs_web_Router_defaultApp                                   0
 #define ES_ejs_web_Router_routerOptions                                1
 #define ES_ejs_web_Router_routes                                       2
-#define ES_ejs_web_Router_addCatchall                                  3
-#define ES_ejs_web_Router_addDefault                                   4
-#define ES_ejs_web_Router_addHandlers                                  5
-#define ES_ejs_web_Router_addHome                                      6
-#define ES_ejs_web_Router_addResource                                  7
-#define ES_ejs_web_Router_addResources                                 8
-#define ES_ejs_web_Router_addRestful                                   9
-#define ES_ejs_web_Router_insertRoute                                  10
-#define ES_ejs_web_Router_add                                          11
-#define ES_ejs_web_Router_lookup                                       12
-#define ES_ejs_web_Router_remove                                       13
-#define ES_ejs_web_Router_reset                                        14
-#define ES_ejs_web_Router_reroute                                      15
-#define ES_ejs_web_Router_secondStageRoute                             16
-#define ES_ejs_web_Router_route                                        17
-#define ES_ejs_web_Router_setDefaultApp                                18
-#define ES_ejs_web_Router_show                                         19
-#define ES_ejs_web_Router_showRoute                                    20
-#define ES_ejs_web_Router_NUM_INSTANCE_PROP                            21
+#define ES_ejs_web_Router_dispatch                                     3
+#define ES_ejs_web_Router_dispatchRoutes                               4
+#define ES_ejs_web_Router_addCatchall                                  5
+#define ES_ejs_web_Router_addDefault                                   6
+#define ES_ejs_web_Router_addHandlers                                  7
+#define ES_ejs_web_Router_addHome                                      8
+#define ES_ejs_web_Router_addResource                                  9
+#define ES_ejs_web_Router_addResources                                 10
+#define ES_ejs_web_Router_addRestful                                   11
+#define ES_ejs_web_Router_insertRoute                                  12
+#define ES_ejs_web_Router_add                                          13
+#define ES_ejs_web_Router_lookup                                       14
+#define ES_ejs_web_Router_remove                                       15
+#define ES_ejs_web_Router_reset                                        16
+#define ES_ejs_web_Router_reroute                                      17
+#define ES_ejs_web_Router_secondStageRoute                             18
+#define ES_ejs_web_Router_route                                        19
+#define ES_ejs_web_Router_compileDispatch                              20
+#define ES_ejs_web_Router_insertSegments                               21
+#define ES_ejs_web_Router_matchTable                                   22
+#define ES_ejs_web_Router_searchTrie                                   23
+#define ES_ejs_web_Router_bestEntry                                    24
+#define ES_ejs_web_Router_setDefaultApp                                25
+#define ES_ejs_web_Router_show                                         26
+#define ES_ejs_web_Router_showRoute                                    27
+#define ES_ejs_web_Router_NUM_INSTANCE_PROP                            28
 #define ES_ejs_web_Router_NUM_INHERITED_PROP                           0
 
 /*
@@ -464,7 +483,9 @@
  */
 #define ES_ejs_web_Route__initializer___Route_                         0
 #define ES_ejs_web_Route_nameSeed                                      1
-#define ES_ejs_web_Route_NUM_CLASS_PROP                                2
+#define ES_ejs_web_Route_MaxVariants                                   2
+#define ES_ejs_web_Route_expandOptional                                3
+#define ES_ejs_web_Route_NUM_CLASS_PROP                                4
 
 /*
    Prototype (instance) slots for "Route" type 
@@ -490,20 +511,45 @@
 #define ES_ejs_web_Route_trace                                         18
 #define ES_ejs_web_Route_match                                         19
 #define ES_ejs_web_Route_pattern                                       20
-#define ES_ejs_web_Route_splitter                                      21
+#define ES_ejs_web_Route_segments                                      21
 #define ES_ejs_web_Route_getTemplate                                   22
 #define ES_ejs_web_Route_inheritRoutes                                 23
 #define ES_ejs_web_Route_compileTemplate                               24
-#define ES_ejs_web_Route_matchAndSplit                                 25
-#define ES_ejs_web_Route_matchRegExp                                   26
-#define ES_ejs_web_Route_makeParams                                    27
-#define ES_ejs_web_Route_parseOptions                                  28
-#define ES_ejs_web_Route_setName                                       29
-#define ES_ejs_web_Route_setRouteSetName                               30
-#define ES_ejs_web_Route_setRouteProperties                            31
-#define ES_ejs_web_Route_NUM_INSTANCE_PROP                             32
+#define ES_ejs_web_Route_compileSegments                               25
+#define ES_ejs_web_Route_matchAndSplit                                 26
+#define ES_ejs_web_Route_matchRegExp                                   27
+#define ES_ejs_web_Route_makeParams                                    28
+#define ES_ejs_web_Route_parseOptions                                  29
+#define ES_ejs_web_Route_setName                                       30
+#define ES_ejs_web_Route_setRouteSetName                               31
+#define ES_ejs_web_Route_setRouteProperties                            32
+#define ES_ejs_web_Route_NUM_INSTANCE_PROP                             33
 #define ES_ejs_web_Route_NUM_INHERITED_PROP                            0
 
+/*
+    Local slots for methods in type "Route" 
+ */
+#define ES_ejs_web_Route_expandOptional_t                              0
+
+
+/*
+    Class property slots for the "RouteNode" type 
+ */
+#define ES_RouteNode_NUM_CLASS_PROP                                    0
+
+/*
+   Prototype (instance) slots for "RouteNode" type 
+ */
+#define ES_RouteNode_literals                                          0
+#define ES_RouteNode_params                                            1
+#define ES_RouteNode_routes                                            2
+#define ES_RouteNode_wild                                              3
+#define ES_RouteNode_methods                                           4
+#define ES_RouteNode_anyMethod                                         5
+#define ES_RouteNode_minOrder                                          6
+#define ES_RouteNode_NUM_INSTANCE_PROP                                 7
+#define ES_RouteNode_NUM_INHERITED_PROP                                0
+
 
 /*
     Class property slots for the "Session" type 
@@ -619,6 +665,6 @@
 #define ES_ejs_web_View_plainFormatter_value                           1
 #define ES_ejs_web_View_plainFormatter_options                         2
 
-#define _ES_CHECKSUM_ejs_web   834053
+#define _ES_CHECKSUM_ejs_web   896986
 
 #endif
@@ -28,7 +28,8 @@
 #define ES_ejs_zlib_Zlib_uncompressBytes                               3
 #define ES_ejs_zlib_Zlib_compressString                                4
 #define ES_ejs_zlib_Zlib_uncompressString                              5
-#define ES_ejs_zlib_Zlib_NUM_CLASS_PROP                                6
+#define ES_ejs_zlib_Zlib_configureFilter                               6
+#define ES_ejs_zlib_Zlib_NUM_CLASS_PROP                                7
 
 /*
    Prototype (instance) slots for "Zlib" type 
@@ -47,7 +48,8 @@
 #define ES_ejs_zlib_Zlib_uncompressBytes_data                          0
 #define ES_ejs_zlib_Zlib_compressString_data                           0
 #define ES_ejs_zlib_Zlib_uncompressString_data                         0
+#define ES_ejs_zlib_Zlib_configureFilter_options                       0
 
-#define _ES_CHECKSUM_ejs_zlib   14504
+#define _ES_CHECKSUM_ejs_zlib   16862
 
 #endif
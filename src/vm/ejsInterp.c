@@ -198,6 +198,8 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
     EjsFunction *f1, *f2;
     EjsNamespace *nsp;
     EjsString   *str;
+    EjsTypedArray *ta;
+    ssize       index;
     int         i, offset, count, opcode, attributes, paused;
 
 #if ME_UNIX_LIKE || (VXWORKS && !ME_DIAB)
@@ -841,6 +843,13 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
                 BREAK;
             }
             if (TYPE(vp)->numericIndicies && ejsIs(ejs, v1, Number)) {
+                ta = (EjsTypedArray*) vp;
+                if (ejsIsTypedArray(ejs, ta) && (index = ejsGetInt(ejs, v1)) >= 0 && index < ta->length && 
+                        (ta->offset + ta->length * ta->elementSize) <= ta->buffer->size) {
+                    /* Typed array fast path: read the element directly without helper dispatch */
+                    push(ejsCreateNumber(ejs, ejsGetTypedArrayElement(ta, index)));
+                    BREAK;
+                }
                 vp = ejsGetProperty(ejs, vp, ejsGetInt(ejs, v1));
                 push(vp == 0 ? ESV(null) : vp);
                 BREAK;
@@ -1058,7 +1067,14 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsAny *otherThis, int argc, int stac
             value = pop(ejs);
             //  TODO -- cleanup this too - push into storeProperty
             if (TYPE(obj)->numericIndicies && ejsIs(ejs, v1, Number)) {
-                ejsSetProperty(ejs, obj, ejsGetInt(ejs, v1), value);
+                ta = (EjsTypedArray*) obj;
+                if (ejsIsTypedArray(ejs, ta) && ejsIs(ejs, value, Number) && (index = ejsGetInt(ejs, v1)) >= 0 && 
+                        index < ta->length && (ta->offset + ta->length * ta->elementSize) <= ta->buffer->size) {
+                    /* Typed array fast path: store the unboxed number directly */
+                    ejsSetTypedArrayElement(ta, index, ((EjsNumber*) value)->value);
+                } else {
+                    ejsSetProperty(ejs, obj, ejsGetInt(ejs, v1), value);
+                }
             } else {
                 qname.name = ejsToString(ejs, v1);
                 if (ejsIs(ejs, v2, Namespace)) {
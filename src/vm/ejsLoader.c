@@ -32,6 +32,7 @@ static int  loadFunctionSection(Ejs *ejs, EjsModule *mp);
 static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int *created, int flags);
 static int  loadNativeLibrary(Ejs *ejs, EjsModule *mp, cchar *path);
 static int  loadSections(Ejs *ejs, MprFile *file, cchar *path, EjsModuleHdr *hdr, int flags);
+static MprFile *openModuleFile(cchar *path);
 static int  loadPropertySection(Ejs *ejs, EjsModule *mp, int sectionType);
 static int  loadScriptModule(Ejs *ejs, cchar *filename, int minVersion, int maxVersion, int flags);
 static char *makeModuleName(cchar *name);
@@ -934,6 +935,201 @@ static int loadNativeLibrary(Ejs *ejs, EjsModule *mp, cchar *modPath)
 }
 
 
+/*
+    Module file images are cached in memory and shared by all interpreters so that pooled interpreters load modules
+    without file I/O. An image is cached when a module file is loaded for the second time. Entries are revalidated via 
+    stat when older than EJS_MODULE_CACHE_CHECK and are removed by the compiler when it rewrites a module file.
+ */
+typedef struct EjsModuleImage {
+    char        *data;              /* Module file contents. Null until the module is loaded a second time */
+    ssize       length;             /* Length of data */
+    MprPath     info;               /* Module file metadata when the image was read */
+    MprTicks    checked;            /* When the metadata was last verified */
+} EjsModuleImage;
+
+/*
+    Read-only file reading from a cached module image
+ */
+typedef struct EjsImageFile {
+    MprFile         file;           /* Must be first */
+    EjsModuleImage  *image;         /* Image to read */
+} EjsImageFile;
+
+static MprHash          *imageCache;
+static MprMutex         *imageLock;
+static MprFileSystem    imageFileSystem;
+
+
+static void manageModuleImage(EjsModuleImage *ip, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(ip->data);
+    }
+}
+
+
+static void manageImageFile(EjsImageFile *fp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(fp->file.buf);
+        mprMark(fp->file.path);
+        mprMark(fp->image);
+    }
+}
+
+
+static ssize readImageFile(MprFile *file, void *buf, ssize size)
+{
+    EjsModuleImage  *ip;
+
+    ip = ((EjsImageFile*) file)->image;
+    size = min(size, (ssize) (ip->length - file->iopos));
+    if (size <= 0) {
+        return 0;
+    }
+    memcpy(buf, &ip->data[file->iopos], size);
+    file->iopos += size;
+    return size;
+}
+
+
+static MprOff seekImageFile(MprFile *file, int seekType, MprOff distance)
+{
+    EjsModuleImage  *ip;
+
+    ip = ((EjsImageFile*) file)->image;
+    if (seekType == SEEK_CUR) {
+        distance += file->iopos;
+    } else if (seekType == SEEK_END) {
+        distance += ip->length;
+    }
+    if (distance < 0 || distance > ip->length) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    file->iopos = distance;
+    return distance;
+}
+
+
+static int closeImageFile(MprFile *file)
+{
+    return 0;
+}
+
+
+static void initImageCache()
+{
+    mprGlobalLock();
+    if (!imageLock) {
+        imageFileSystem.readFile = readImageFile;
+        imageFileSystem.seekFile = seekImageFile;
+        imageFileSystem.closeFile = closeImageFile;
+        imageCache = mprCreateHash(EJS_MODULE_CACHE_MAX / 4, 0);
+        mprAddRoot(imageCache);
+        imageLock = mprCreateLock();
+        mprAddRoot(imageLock);
+    }
+    mprGlobalUnlock();
+}
+
+
+/*
+    Get the cached image for a module file. Return null if the module file should be read directly.
+ */
+static EjsModuleImage *getModuleImage(cchar *path)
+{
+    EjsModuleImage  *ip;
+    MprPath         info;
+    MprTicks        now;
+    char            *data;
+    ssize           len;
+
+    if (!imageLock) {
+        initImageCache();
+    }
+    path = mprGetAbsPath(path);
+    now = mprGetTicks();
+
+    mprLock(imageLock);
+    ip = mprLookupKey(imageCache, path);
+    if (ip && ip->data && (now - ip->checked) < EJS_MODULE_CACHE_CHECK) {
+        mprUnlock(imageLock);
+        return ip;
+    }
+    mprUnlock(imageLock);
+
+    if (mprGetPathInfo(path, &info) < 0 || !info.valid || info.isDir) {
+        return 0;
+    }
+    if (ip && ip->info.mtime == info.mtime && ip->info.size == info.size && ip->info.inode == info.inode) {
+        if (ip->data) {
+            ip->checked = now;
+            return ip;
+        }
+        /* Second load of an unmodified module file */
+        if ((data = mprReadPathContents(path, &len)) == 0 || len != info.size) {
+            return 0;
+        }
+    } else {
+        data = 0;
+        len = 0;
+    }
+    if ((ip = mprAllocObj(EjsModuleImage, manageModuleImage)) == 0) {
+        return 0;
+    }
+    ip->data = data;
+    ip->length = len;
+    ip->info = info;
+    ip->checked = now;
+
+    mprLock(imageLock);
+    if (mprGetHashLength(imageCache) >= EJS_MODULE_CACHE_MAX) {
+        /* Simple bounded cache. Discard all entries and start afresh */
+        mprRemoveRoot(imageCache);
+        imageCache = mprCreateHash(EJS_MODULE_CACHE_MAX / 4, 0);
+        mprAddRoot(imageCache);
+    }
+    mprAddKey(imageCache, path, ip);
+    mprUnlock(imageLock);
+    return data ? ip : 0;
+}
+
+
+void ejsRemoveModuleImage(cchar *path)
+{
+    if (imageLock) {
+        path = mprGetAbsPath(path);
+        mprLock(imageLock);
+        mprRemoveKey(imageCache, path);
+        mprUnlock(imageLock);
+    }
+}
+
+
+/*
+    Open a module file for reading. Use the cached module image if available.
+ */
+static MprFile *openModuleFile(cchar *path)
+{
+    EjsModuleImage  *ip;
+    EjsImageFile    *fp;
+
+    if ((ip = getModuleImage(path)) == 0) {
+        return mprOpenFile(path, O_RDONLY | O_BINARY, 0666);
+    }
+    if ((fp = mprAllocObj(EjsImageFile, manageImageFile)) == 0) {
+        return 0;
+    }
+    fp->image = ip;
+    fp->file.fileSystem = &imageFileSystem;
+    fp->file.path = sclone(path);
+    fp->file.mode = O_RDONLY | O_BINARY;
+    fp->file.size = ip->length;
+    fp->file.fd = -1;
+    return &fp->file;
+}
+
+
 static int loadScriptModule(Ejs *ejs, cchar *filename, int minVersion, int maxVersion, int flags)
 {
     EjsModuleHdr    hdr;
@@ -948,7 +1144,7 @@ static int loadScriptModule(Ejs *ejs, cchar *filename, int minVersion, int maxVe
     if ((path = search(ejs, filename, minVersion, maxVersion)) == 0) {
         return MPR_ERR_CANT_ACCESS;
     }
-    if ((file = mprOpenFile(path, O_RDONLY | O_BINARY, 0666)) == NULL) {
+    if ((file = openModuleFile(path)) == NULL) {
         ejsThrowIOError(ejs, "Cannot open module file %s", path);
         return MPR_ERR_CANT_OPEN;
     }
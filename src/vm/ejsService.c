@@ -289,6 +289,9 @@ static void manageEjs(Ejs *ejs, int flags)
         mprMark(ejs->doc);
         mprMark(ejs->http);
         mprMark(ejs->mutex);
+        for (next = 0; next < EJS_NUMBER_CACHE; next++) {
+            mprMark(ejs->numberStrings[next]);
+        }
 
     } else if (flags & MPR_MANAGE_FREE) {
         ejsDestroyVM(ejs);
@@ -628,6 +631,7 @@ static int configureEjs(Ejs *ejs)
         ejsConfigureStringType(ejs);
         ejsConfigureSystemType(ejs);
         ejsConfigureTimerType(ejs);
+        ejsConfigureTypedArrayTypes(ejs);
         ejsConfigureWorkerType(ejs);
         ejsConfigureXMLType(ejs);
         ejsConfigureXMLListType(ejs);